@@ -0,0 +1,616 @@
+/**
+ * @file neurolab_bench.c
+ * @brief Headless driver of the network benchmarks (make bench).
+ *
+ * Usage: neurolab-bench <workload|all> [options]
+ *   -n <neurons>     network size (workload default if omitted)
+ *   -k <synapses>    synapses per neuron
+ *   -d <ms>          simulated time
+ *   -t <list>        comma-separated thread counts (default 1, 2, 4, ... up to one per CPU)
+ *   -s <seed>        seed
+ *   -p <processes>   split the network across local processes (network workloads)
+ *   -m <placement>   none, pinned (pinned threads, first-touch state) or huge
+ *                    (pinned, with transparent huge pages) (network workloads)
+ *   -r <reorder>     none, sort (synapse rows by target) or rcm (Reverse
+ *                    Cuthill-McKee renumbering, then sort) (network workloads)
+ *
+ * Each network workload runs once per thread count and prints one table
+ * row per run, followed by its validation statistics. brette4, circuit
+ * and the single-neuron workloads ignore -t/-p/-m/-r; cable takes -t only
+ * and -n as its number of cells; for the sweep, -n is the number of grid
+ * points. The fit matches the spike train of a known parameter set; one
+ * current step does not identify the parameters, so the values found may
+ * differ from those that generated it.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils/parallel.h"
+#include "utils/disk_cache.h"
+#include "simulation/benchmark.h"
+#include "simulation/benchmark_izhikevich.h"
+#include "simulation/benchmark_vogels_abbott.h"
+#include "simulation/benchmark_polychronization.h"
+#include "simulation/benchmark_brette4.h"
+#include "simulation/parameter_sweep.h"
+#include "simulation/circuit.h"
+#include "model/neural/compartmental/cable_model.h"
+#include "analysis/fitting.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Maximum number of thread counts in one invocation. */
+#define MAX_THREAD_COUNTS 16
+
+/** @brief Current range (pA) and default grid points of the f-I sweep workload. */
+#define SWEEP_CURRENT_MAX 20.0f
+#define SWEEP_DEFAULT_POINTS 41
+
+/** @brief Drives (both populations) compared by the circuit workload: first, step and count. */
+#define CIRCUIT_DRIVE_FIRST -2.0f
+#define CIRCUIT_DRIVE_STEP 2.0f
+#define CIRCUIT_DRIVES 6
+
+/** @brief Default simulated time of the circuit workload, and the transient excluded from its rates (ms). */
+#define CIRCUIT_DEFAULT_DURATION 1000.0f
+#define CIRCUIT_TRANSIENT 200.0f
+
+/** @brief Ball-and-stick cells of the cable workload: soma and dendrite sizes (um), dendritic segments. */
+#define CABLE_SOMA_DIAMETER 30.0f
+#define CABLE_DENDRITE_LENGTH 1000.0f
+#define CABLE_DENDRITE_DIAMETER 2.0f
+#define CABLE_SEGMENTS 50
+
+/** @brief Somatic current (pA), time step (ms) and defaults of the cable workload. */
+#define CABLE_CURRENT 1000.0f
+#define CABLE_DT 0.025f
+#define CABLE_DEFAULT_CELLS 100
+#define CABLE_DEFAULT_DURATION 200.0f
+
+/** @brief Stimulus (pA) of the fit workload, and the Izhikevich (a, b, c, d) that generate its target. */
+#define FIT_CURRENT 10.0f
+static const float FIT_TARGET_PARAMETERS[4] = { 0.025f, 0.2f, -60.0f, 6.0f };
+
+/** @brief Spike distance below which the fitted model matches the target spike train. */
+#define FIT_MATCH_DISTANCE 0.05f
+
+/**
+ * @struct BenchOptions
+ * @brief Command-line options (0 means "workload default").
+ */
+typedef struct {
+    int neurons;
+    int synapses;
+    float duration;
+    unsigned long long seed;
+    int processes;
+    BenchmarkPlacement placement;
+    NetworkReorderMode reorder;
+    int threads[MAX_THREAD_COUNTS];
+    int threadCount;
+} BenchOptions;
+
+/**
+ * @struct BenchWorkload
+ * @brief A named workload and its runner.
+ */
+typedef struct {
+    const char *name;
+    const char *description;
+    bool (*run)(const BenchOptions *options);
+} BenchWorkload;
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Ends the process if it is a child rank of a distributed run (only
+ * rank 0 reports), with a failure status if its run failed.
+ */
+static void BenchEndChildRank(const BenchmarkResult *result, bool ok);
+
+/**
+ * @brief Runs the Izhikevich (2003) network for every thread count.
+ */
+static bool BenchIzhikevich2003(const BenchOptions *options);
+
+/**
+ * @brief Runs the COBA or CUBA network for every thread count.
+ */
+static bool BenchVogelsAbbott(const BenchOptions *options, LifNeuronType type);
+
+/**
+ * @brief Workload runners of the two Vogels-Abbott variants.
+ */
+static bool BenchCoba(const BenchOptions *options);
+static bool BenchCuba(const BenchOptions *options);
+
+/**
+ * @brief Runs the polychronization network (serial) and prints its phase times.
+ */
+static bool BenchPolychronization(const BenchOptions *options);
+
+/**
+ * @brief Runs benchmark 4 event-driven, then the clock-driven CUBA network
+ * of the same size (both serial), and prints both rows and the speedup.
+ */
+static bool BenchBrette4(const BenchOptions *options);
+
+/**
+ * @brief Runs an Izhikevich f-I sweep uncached, cached, re-run and refined,
+ * and prints the cache hits and wall time of each pass.
+ */
+static bool BenchSweep(const BenchOptions *options);
+
+/**
+ * @brief Fits a regular-spiking Izhikevich neuron to the spike train of a
+ * known parameter set and prints the match, the values found and the
+ * evaluation rate.
+ */
+static bool BenchFit(const BenchOptions *options);
+
+/**
+ * @brief Runs the default circuit as a spiking network and as a rate model
+ * over a range of drives, and prints the population rates and wall time of both.
+ */
+static bool BenchCircuit(const BenchOptions *options);
+
+/**
+ * @brief Steps a population of ball-and-stick cells (Crank-Nicolson Hines
+ * solver) with a somatic current for every thread count.
+ */
+static bool BenchCable(const BenchOptions *options);
+
+/**
+ * @brief Parses the options following the workload name.
+ * @return false on a malformed option.
+ */
+static bool BenchParseOptions(int argc, char **argv, BenchOptions *options);
+
+/**
+ * @brief Prints the usage and the available workloads.
+ */
+static void BenchUsage(const char *program);
+
+static const BenchWorkload WORKLOADS[] = {
+    { "izhikevich2003", "Izhikevich (2003) 80/20 random network with thalamic noise", BenchIzhikevich2003 },
+    { "coba",           "Brette et al. (2007) COBA: LIF with AMPA/GABA-A conductances", BenchCoba },
+    { "cuba",           "Brette et al. (2007) CUBA: LIF with exponential currents", BenchCuba },
+    { "polychronization", "Izhikevich (2006) network with 1-20 ms delays and STDP (serial)", BenchPolychronization },
+    { "brette4",        "Brette et al. (2007) benchmark 4: event-driven LIF with voltage jumps, vs clock-driven CUBA (serial)", BenchBrette4 },
+    { "sweep",          "Memoized f-I sweep of a regular-spiking Izhikevich neuron (serial)", BenchSweep },
+    { "fit",            "Nelder-Mead fit of Izhikevich (a, b, c, d) to a target spike train", BenchFit },
+    { "circuit",        "Sparse Izhikevich (2003) circuit: spiking network vs Wilson-Cowan rate model (serial)", BenchCircuit },
+    { "cable",          "Independent ball-and-stick HH cells, Hines solver, one cell per work item", BenchCable }
+};
+
+static const int WORKLOAD_COUNT = (int)(sizeof(WORKLOADS) / sizeof(WORKLOADS[0]));
+
+// --- Private (static) Function Implementations ---
+
+static void BenchEndChildRank(const BenchmarkResult *result, bool ok) {
+    if (result->rank > 0) exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+static bool BenchIzhikevich2003(const BenchOptions *options) {
+    Izhikevich2003Config config;
+    Izhikevich2003Defaults(&config);
+    if (options->neurons > 0)      config.neurons           = options->neurons;
+    if (options->synapses > 0)     config.synapsesPerNeuron = options->synapses;
+    if (options->duration > 0.0f)  config.duration          = options->duration;
+    if (options->seed > 0)         config.seed              = options->seed;
+    if (options->processes > 0)    config.processes         = options->processes;
+    config.placement         = options->placement;
+    config.reorder           = options->reorder;
+
+    BenchmarkPrintHeader(stdout);
+    Izhikevich2003Result result;
+    for (int t = 0; t < options->threadCount; t++) {
+        const bool ok = Izhikevich2003Run(&config, options->threads[t], &result);
+        BenchEndChildRank(&result.benchmark, ok);
+        if (!ok) {
+            fprintf(stderr, "Error: izhikevich2003 run failed\n");
+            return false;
+        }
+        BenchmarkPrintResult(stdout, &result.benchmark);
+    }
+
+    printf("  rates: excitatory %.2f Hz, inhibitory %.2f Hz\n", result.excitatoryRate, result.inhibitoryRate);
+    printf("  rhythm: peak %.1f Hz, alpha (8-13 Hz) %.0f%%, gamma (30-50 Hz) %.0f%% of 2-100 Hz power -> %s\n",
+           result.peakFrequency, 100.0f * result.alphaFraction, 100.0f * result.gammaFraction,
+           !result.rhythmChecked ? "not checked (run too short)"
+           : result.rhythmValid ? "OK (alpha/gamma, as published)" : "NOT in the published bands");
+    return true;
+}
+
+static bool BenchVogelsAbbott(const BenchOptions *options, LifNeuronType type) {
+    VogelsAbbottConfig config;
+    VogelsAbbottDefaults(&config, type);
+    if (options->neurons > 0)      config.neurons           = options->neurons;
+    if (options->synapses > 0)     config.synapsesPerNeuron = options->synapses;
+    if (options->duration > 0.0f)  config.duration          = options->duration;
+    if (options->seed > 0)         config.seed              = options->seed;
+    if (options->processes > 0)    config.processes         = options->processes;
+    config.placement         = options->placement;
+    config.reorder           = options->reorder;
+
+    BenchmarkPrintHeader(stdout);
+    VogelsAbbottResult result;
+    for (int t = 0; t < options->threadCount; t++) {
+        const bool ok = VogelsAbbottRun(&config, options->threads[t], &result);
+        BenchEndChildRank(&result.benchmark, ok);
+        if (!ok) {
+            fprintf(stderr, "Error: %s run failed\n", type == LIF_VOGELS_ABBOTT_COBA ? "coba" : "cuba");
+            return false;
+        }
+        BenchmarkPrintResult(stdout, &result.benchmark);
+    }
+
+    printf("  rates: excitatory %.2f Hz, inhibitory %.2f Hz, last 10%% %.2f Hz, ISI CV %.2f -> %s\n",
+           result.excitatoryRate, result.inhibitoryRate, result.finalRate, result.meanCv,
+           result.rateValid ? "OK (self-sustained, irregular)" : "NOT the published regime");
+    return true;
+}
+
+static bool BenchCoba(const BenchOptions *options) {
+    return BenchVogelsAbbott(options, LIF_VOGELS_ABBOTT_COBA);
+}
+
+static bool BenchCuba(const BenchOptions *options) {
+    return BenchVogelsAbbott(options, LIF_VOGELS_ABBOTT_CUBA);
+}
+
+static bool BenchPolychronization(const BenchOptions *options) {
+    PolychronizationConfig config;
+    PolychronizationDefaults(&config);
+    if (options->neurons > 0)      config.neurons           = options->neurons;
+    if (options->synapses > 0)     config.synapsesPerNeuron = options->synapses;
+    if (options->duration > 0.0f)  config.duration          = options->duration;
+    if (options->seed > 0)         config.seed              = options->seed;
+
+    PolychronizationResult result;
+    if (!PolychronizationRun(&config, &result)) {
+        fprintf(stderr, "Error: polychronization run failed\n");
+        return false;
+    }
+    BenchmarkPrintHeader(stdout);
+    BenchmarkPrintResult(stdout, &result.benchmark);
+
+    const double total = result.benchmark.wallTime > 0.0 ? result.benchmark.wallTime : 1.0;
+    printf("  phases: neuron update %.3f s (%.0f%%), delivery %.3f s (%.0f%%), plasticity %.3f s (%.0f%%)\n",
+           result.neuronTime, 100.0 * result.neuronTime / total,
+           result.deliveryTime, 100.0 * result.deliveryTime / total,
+           result.plasticityTime, 100.0 * result.plasticityTime / total);
+    printf("  rates: excitatory %.2f Hz, inhibitory %.2f Hz\n", result.excitatoryRate, result.inhibitoryRate);
+    printf("  weights: mean %.2f, %.0f%% above 90%% of max, %.0f%% below 10%% of max\n",
+           result.meanWeight, 100.0f * result.saturatedFraction, 100.0f * result.depressedFraction);
+    return true;
+}
+
+static bool BenchBrette4(const BenchOptions *options) {
+    Brette4Config config;
+    Brette4Defaults(&config);
+    if (options->neurons > 0)      config.neurons           = options->neurons;
+    if (options->synapses > 0)     config.synapsesPerNeuron = options->synapses;
+    if (options->duration > 0.0f)  config.duration          = options->duration;
+    if (options->seed > 0)         config.seed              = options->seed;
+
+    Brette4Result result;
+    if (!Brette4Run(&config, &result)) {
+        fprintf(stderr, "Error: brette4 run failed\n");
+        return false;
+    }
+
+    // Same size, connectivity, membrane and duration, advanced every 0.1 ms
+    VogelsAbbottConfig clocked;
+    VogelsAbbottDefaults(&clocked, LIF_VOGELS_ABBOTT_CUBA);
+    clocked.neurons           = config.neurons;
+    clocked.synapsesPerNeuron = config.synapsesPerNeuron;
+    clocked.duration          = config.duration;
+    clocked.seed              = config.seed;
+
+    VogelsAbbottResult clockedResult;
+    if (!VogelsAbbottRun(&clocked, 1, &clockedResult)) {
+        fprintf(stderr, "Error: cuba run failed\n");
+        return false;
+    }
+
+    BenchmarkPrintHeader(stdout);
+    BenchmarkPrintResult(stdout, &result.benchmark);
+    BenchmarkPrintResult(stdout, &clockedResult.benchmark);
+
+    printf("  rates: excitatory %.2f Hz, inhibitory %.2f Hz, last 10%% %.2f Hz -> %s\n",
+           result.excitatoryRate, result.inhibitoryRate, result.finalRate,
+           result.rateValid ? "OK (self-sustained)" : "NOT the published regime");
+    printf("  queue: %ld events, %ld deferred threshold events\n", result.queueEvents, result.deferredEvents);
+    printf("  event-driven vs clock-driven: %.2fx the speed per simulated second (cuba at %.2f Hz)\n",
+           clockedResult.benchmark.wallTime / (result.benchmark.wallTime > 0.0 ? result.benchmark.wallTime : 1e-9),
+           (clockedResult.excitatoryRate * 0.8 + clockedResult.inhibitoryRate * 0.2));
+    return true;
+}
+
+static bool BenchSweep(const BenchOptions *options) {
+    SweepConfig config;
+    SweepConfigDefaults(&config, IZHIKEVICH_MODEL);
+    if (options->duration > 0.0f) config.base.duration = options->duration;
+    config.axes[0] = (SweepAxis){ SWEEP_PARAM_CURRENT, 0.0f, SWEEP_CURRENT_MAX,
+                                  options->neurons > 1 ? options->neurons : SWEEP_DEFAULT_POINTS };
+
+    // Uncached baseline, then a cached pass (hits left by earlier invocations count), a re-run and a
+    // refinement that halves the spacing: every other point of it is already known
+    static const char *const PASSES[] = { "uncached", "cached", "re-run", "refined" };
+    printf("%-10s %7s %7s %9s\n", "pass", "points", "hits", "wall(s)");
+
+    SweepResult result;
+    for (int pass = 0; pass < 4; pass++) {
+        config.useCache = pass > 0;
+        if (pass == 3) config.axes[0].steps = 2 * config.axes[0].steps - 1;
+
+        const double start = BenchmarkNow();
+        if (!ParameterSweepRun(&config, &result)) {
+            fprintf(stderr, "Error: sweep failed\n");
+            return false;
+        }
+        printf("%-10s %7d %7d %9.3f\n", PASSES[pass], result.count, result.cacheHits, BenchmarkNow() - start);
+        if (pass < 3) ParameterSweepFree(&result);
+    }
+
+    // f-I summary of the refined grid
+    float rheobase = -1.0f;
+    for (int p = 0; p < result.count && rheobase < 0.0f; p++) {
+        if (result.points[p].metrics.spikeCount > 0) rheobase = result.points[p].values[0];
+    }
+    printf("  f-I: first spiking current %.2f, %.1f Hz at %.1f (cache in %s/%s)\n", rheobase,
+           result.points[result.count - 1].metrics.firingRate, result.points[result.count - 1].values[0],
+           DISK_CACHE_ROOT, SWEEP_CACHE_DIR);
+    ParameterSweepFree(&result);
+    return true;
+}
+
+static bool BenchFit(const BenchOptions *options) {
+    FitConfig config;
+    FitConfigDefaults(&config, IZHIKEVICH_MODEL);
+    config.base.externCurrent = FIT_CURRENT;
+    if (options->duration > 0.0f) config.base.duration = options->duration;
+
+    // Target: the spike train of the known parameter set under the same stimulus
+    RunSpec truth = config.base;
+    for (int p = 0; p < config.numParameters; p++) SweepApplyParameter(&truth, config.parameters[p], FIT_TARGET_PARAMETERS[p]);
+
+    float target[FIT_MAX_SPIKES];
+    RunNeuron neuron;
+    if (!RunNeuronInit(&neuron, &truth)) {
+        fprintf(stderr, "Error: fit target run failed\n");
+        return false;
+    }
+    const long steps = lround(truth.duration / truth.dt);
+    int count = 0;
+    for (long i = 0; i < steps; i++) {
+        if (RunNeuronStep(&neuron) && count < FIT_MAX_SPIKES) target[count++] = (i + 1) * truth.dt;
+    }
+    RunNeuronFree(&neuron);
+
+    config.targetSpikes     = target;
+    config.targetSpikeCount = count;
+
+    FitResult result;
+    const double start = BenchmarkNow();
+    if (!FitRun(&config, &result)) {
+        fprintf(stderr, "Error: fit failed\n");
+        return false;
+    }
+    const double wall = BenchmarkNow() - start;
+
+    printf("%-10s %7s %9s %9s %9s\n", "target", "iters", "evals", "wall(s)", "evals/s");
+    printf("%4d spikes %7d %9d %9.3f %9.0f\n", count, result.iterations, result.evaluations, wall,
+           wall > 0.0 ? result.evaluations / wall : 0.0);
+
+    static const char *const NAMES[] = { "a", "b", "c", "d" };
+    printf("  fit:");
+    for (int p = 0; p < config.numParameters; p++) {
+        printf(" %s %.3f (target from %.3f)%s", NAMES[p], result.best[p], FIT_TARGET_PARAMETERS[p],
+               p + 1 < config.numParameters ? "," : "");
+    }
+    printf("; spike distance %.4f (%s) -> %s\n", result.cost, result.converged ? "converged" : "iteration limit",
+           result.cost <= FIT_MATCH_DISTANCE ? "matches the target spike train" : "does NOT match the target spike train");
+    return true;
+}
+
+static bool BenchCircuit(const BenchOptions *options) {
+    const float duration = options->duration > CIRCUIT_TRANSIENT ? options->duration : CIRCUIT_DEFAULT_DURATION;
+
+    printf("%7s %10s %10s %10s %10s %12s %12s\n", "drive", "spike E", "spike I", "rate E", "rate I", "spiking(s)", "rate(s)");
+    for (int d = 0; d < CIRCUIT_DRIVES; d++) {
+        Circuit circuit;
+        CircuitDefaults(&circuit);
+        if (options->seed > 0) circuit.seed = options->seed;
+
+        const float drive = CIRCUIT_DRIVE_FIRST + d * CIRCUIT_DRIVE_STEP;
+        for (int k = 0; k < circuit.count; k++) circuit.populations[k].drive = drive;
+
+        const long steps     = lround(duration / circuit.dt);
+        const long transient = lround(CIRCUIT_TRANSIENT / circuit.dt);
+
+        // 1. Spiking representation: rates counted after the transient
+        double start = BenchmarkNow();
+        Network *network = CircuitBuildNetwork(&circuit, 1);
+        if (!network) {
+            fprintf(stderr, "Error: circuit network build failed\n");
+            return false;
+        }
+        Rng rng;
+        RngSeed(&rng, circuit.seed + 1);
+        long counts[CIRCUIT_MAX_POPULATIONS] = { 0 };
+        for (long step = 0; step < steps; step++) {
+            CircuitApplyDrive(&circuit, network, &rng);
+            NetworkStep(network);
+            if (step >= transient) CircuitCountSpikes(&circuit, network, counts);
+        }
+        NetworkFree(network);
+        const double spikingWall = BenchmarkNow() - start;
+
+        // 2. Rate representation: the rates at the end of the same time
+        start = BenchmarkNow();
+        RateModel model;
+        if (!CircuitBuildRateModel(&circuit, &model)) {
+            fprintf(stderr, "Error: circuit rate model build failed\n");
+            return false;
+        }
+        for (long step = 0; step < steps; step++) RateModelStep(&model);
+        const double rateWall = BenchmarkNow() - start;
+
+        const double seconds = (steps - transient) * (double)circuit.dt / 1000.0;
+        printf("%7.1f %10.2f %10.2f %10.2f %10.2f %12.4f %12.6f\n", drive,
+               counts[0] / (circuit.populations[0].size * seconds), counts[1] / (circuit.populations[1].size * seconds),
+               RateModelRate(&model, 0), RateModelRate(&model, 1), spikingWall, rateWall);
+        RateModelFree(&model);
+    }
+    printf("  rates in Hz (E: 800 regular spiking, I: 200 fast spiking); spiking rates exclude the first %.0f ms\n",
+           CIRCUIT_TRANSIENT);
+    return true;
+}
+
+static bool BenchCable(const BenchOptions *options) {
+    const int cells       = options->neurons > 0 ? options->neurons : CABLE_DEFAULT_CELLS;
+    const float duration  = options->duration > 0.0f ? options->duration : CABLE_DEFAULT_DURATION;
+    const long steps      = lround(duration / CABLE_DT);
+
+    CableMorphology morph;
+    CableMorphologyInit(&morph);
+    if (!CableMorphologyBallAndStick(&morph, CABLE_SOMA_DIAMETER, CABLE_DENDRITE_LENGTH, CABLE_DENDRITE_DIAMETER, CABLE_SEGMENTS)) {
+        fprintf(stderr, "Error: cable morphology failed\n");
+        return false;
+    }
+
+    BenchmarkPrintHeader(stdout);
+    BenchmarkResult result = { 0 };
+    int compartments = 0;
+    for (int t = 0; t < options->threadCount; t++) {
+        const double buildStart = BenchmarkNow();
+        CablePopulation *pop = CablePopulationCreate(&morph, cells, CABLE_DEFAULT_AXIAL_RESISTIVITY, CABLE_DT,
+                                                     CABLE_CRANK_NICOLSON, options->threads[t]);
+        if (!pop) {
+            CableMorphologyFree(&morph);
+            fprintf(stderr, "Error: cable population failed\n");
+            return false;
+        }
+        const double buildTime = BenchmarkNow() - buildStart;
+
+        // The soma is the first compartment in Hines order
+        for (int c = 0; c < pop->count; c++) pop->cells[c]->iExt[0] = CABLE_CURRENT;
+        compartments = pop->cells[0]->count;
+
+        long spikes = 0;
+        const double start = BenchmarkNow();
+        for (long step = 0; step < steps; step++) spikes += CablePopulationStep(pop);
+        const double wall = BenchmarkNow() - start;
+
+        result = (BenchmarkResult){
+            .name        = "cable",
+            .processes   = 1,
+            .threads     = ParallelPoolSize(pop->pool),
+            .placement   = BENCHMARK_PLACE_NONE,
+            .reorder     = NETWORK_REORDER_NONE,
+            .neurons     = cells,
+            .synapses    = 0,
+            .simulated   = steps * (double)CABLE_DT,
+            .buildTime   = buildTime,
+            .wallTime    = wall,
+            .spikes      = spikes,
+            .events      = 0,
+            .rowSpread   = -1.0,
+            .cacheMisses = -1
+        };
+        BenchmarkPrintResult(stdout, &result);
+        CablePopulationFree(pop);
+    }
+    CableMorphologyFree(&morph);
+
+    const double wall = result.wallTime > 0.0 ? result.wallTime : 1e-9;
+    printf("  cells: %d compartments each, %.3g compartment-steps/s; soma rate %.1f Hz at %.0f pA\n", compartments,
+           (double)cells * compartments * steps / wall, result.spikes / (cells * result.simulated / 1000.0), CABLE_CURRENT);
+    return true;
+}
+
+static bool BenchParseOptions(int argc, char **argv, BenchOptions *options) {
+    memset(options, 0, sizeof(*options));
+
+    for (int i = 0; i < argc; i++) {
+        if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2) return false;
+        const char *value = argv[++i];
+
+        switch (argv[i - 1][1]) {
+            case 'n': options->neurons  = atoi(value); break;
+            case 'k': options->synapses = atoi(value); break;
+            case 'd': options->duration = (float)atof(value); break;
+            case 's': options->seed     = strtoull(value, NULL, 10); break;
+            case 'p': options->processes = atoi(value); break;
+            case 'm': {
+                int p = BENCHMARK_PLACE_NONE;
+                while (p <= BENCHMARK_PLACE_HUGE && strcmp(value, BENCHMARK_PLACEMENT_NAMES[p]) != 0) p++;
+                if (p > BENCHMARK_PLACE_HUGE) return false;
+                options->placement = (BenchmarkPlacement)p;
+            } break;
+            case 'r': {
+                int r = NETWORK_REORDER_NONE;
+                while (r <= NETWORK_REORDER_RCM && strcmp(value, NETWORK_REORDER_NAMES[r]) != 0) r++;
+                if (r > NETWORK_REORDER_RCM) return false;
+                options->reorder = (NetworkReorderMode)r;
+            } break;
+            case 't': {
+                char list[256];
+                snprintf(list, sizeof(list), "%s", value);
+                for (char *item = strtok(list, ","); item && options->threadCount < MAX_THREAD_COUNTS;
+                     item = strtok(NULL, ",")) {
+                    const int threads = atoi(item);
+                    if (threads < 1) return false;
+                    options->threads[options->threadCount++] = threads;
+                }
+            } break;
+            default: return false;
+        }
+    }
+
+    // Default: powers of two up to one thread per CPU, plus that count
+    if (options->threadCount == 0) {
+        const int cpus = ParallelWorkerCount();
+        for (int threads = 1; threads < cpus && options->threadCount < MAX_THREAD_COUNTS - 1; threads *= 2) {
+            options->threads[options->threadCount++] = threads;
+        }
+        options->threads[options->threadCount++] = cpus;
+    }
+    return true;
+}
+
+static void BenchUsage(const char *program) {
+    fprintf(stderr, "Usage: %s <workload|all> [-n neurons] [-k synapses] [-d ms] [-t threads,...] [-s seed] [-p processes] [-m none|pinned|huge] [-r none|sort|rcm]\n\n", program);
+    fprintf(stderr, "Workloads:\n");
+    for (int w = 0; w < WORKLOAD_COUNT; w++) fprintf(stderr, "  %-18s %s\n", WORKLOADS[w].name, WORKLOADS[w].description);
+}
+
+// --- Entry Point ---
+
+int main(int argc, char **argv) {
+    BenchOptions options;
+    if (argc < 2 || !BenchParseOptions(argc - 2, argv + 2, &options)) {
+        BenchUsage(argv[0]);
+        return 1;
+    }
+
+    const bool all = strcmp(argv[1], "all") == 0;
+    bool found = false, ok = true;
+    for (int w = 0; w < WORKLOAD_COUNT; w++) {
+        if (!all && strcmp(argv[1], WORKLOADS[w].name) != 0) continue;
+
+        found = true;
+        printf("== %s: %s\n", WORKLOADS[w].name, WORKLOADS[w].description);
+        ok = WORKLOADS[w].run(&options) && ok;
+        printf("\n");
+    }
+
+    if (!found) {
+        BenchUsage(argv[0]);
+        return 1;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file fitting.h
+ * @brief Public interface for fitting model parameters to target recordings.
+ *
+ * Fits any subset of the sweepable parameters (Izhikevich a, b, c, d, HH
+ * conductances, stimulus) so that a headless run reproduces a target
+ * voltage trace or spike train. The optimizer is a bounded Nelder-Mead
+ * simplex working in coordinates normalized to [0, 1]. Each iteration
+ * evaluates its whole candidate population at once as a batch of
+ * independent parallel simulations: the reflection, expansion and both
+ * contraction points are computed speculatively together, and the
+ * initial simplex and shrink steps are batched as well. Each candidate is
+ * a scalar RunNeuron run on its own ParallelFor index, so a batch of at
+ * most FIT_MAX_PARAMETERS + 1 runs uses at most that many threads.
+ */
+#ifndef FITTING_H
+#define FITTING_H
+
+#include <stdbool.h>
+#include "simulation/simulation_run.h"
+#include "simulation/parameter_sweep.h"
+
+/** @brief Maximum number of fitted parameters. */
+#define FIT_MAX_PARAMETERS 8
+
+/** @brief Maximum number of spikes recorded per candidate run. */
+#define FIT_MAX_SPIKES 1024
+
+/**
+ * @enum FitDistance
+ * @brief How a candidate run is compared with the target.
+ */
+typedef enum {
+    FIT_DISTANCE_TRACE = 0,    ///< RMS difference of the voltage traces (mV)
+    FIT_DISTANCE_SPIKE_TIMES,  ///< Symmetric nearest-spike distance, capped at FIT_SPIKE_WINDOW, in [0, 1]
+    FIT_DISTANCE_FEATURES      ///< Relative errors of spike count, first-spike latency, mean ISI and ISI CV
+} FitDistance;
+
+/** @brief Time window (ms) of the spike-time distance; farther spikes count as unmatched. */
+#define FIT_SPIKE_WINDOW 10.0f
+
+/**
+ * @struct FitConfig
+ * @brief Complete description of a fit.
+ */
+typedef struct {
+    RunSpec base;                                ///< Model, stimulus, dt and duration of every candidate run
+    SweepParameter parameters[FIT_MAX_PARAMETERS]; ///< Fitted parameters
+    int numParameters;
+    float initial[FIT_MAX_PARAMETERS];           ///< Starting point
+    float lower[FIT_MAX_PARAMETERS];             ///< Lower bounds
+    float upper[FIT_MAX_PARAMETERS];             ///< Upper bounds
+
+    FitDistance distance;
+    const float *targetTrace;                    ///< Target V(t), evenly sampled over 'base.duration' (FIT_DISTANCE_TRACE)
+    int targetTraceLength;
+    const float *targetSpikes;                   ///< Target spike times in ms, ascending (spike distances)
+    int targetSpikeCount;
+
+    int maxIterations;                           ///< Simplex iterations
+    float tolerance;                             ///< Stop when the simplex cost spread falls below this
+} FitConfig;
+
+/**
+ * @struct FitResult
+ * @brief Outcome of a fit.
+ */
+typedef struct {
+    float best[FIT_MAX_PARAMETERS]; ///< Best parameter values found
+    float cost;                     ///< Distance of the best candidate
+    int iterations;                 ///< Simplex iterations run
+    int evaluations;                ///< Simulations run
+    bool converged;                 ///< true if the tolerance was reached
+} FitResult;
+
+/**
+ * @brief Fills a FitConfig with defaults for the given model.
+ *
+ * Fits a, b, c, d (Izhikevich, around the REGULAR_SPIKING preset) or
+ * gNa, gK, gL (HH, around HH_CONFIG) within a factor of two of the
+ * defaults, with the spike-time distance, 200 iterations and a tolerance
+ * of 1e-4. The target must still be set.
+ *
+ * @param config Output config.
+ * @param neuronModel The model to fit.
+ */
+void FitConfigDefaults(FitConfig *config, NeuronModel neuronModel);
+
+/**
+ * @brief Evaluates the distance of one parameter vector to the target.
+ * @param config The fit description.
+ * @param values Parameter values, in the order of config->parameters.
+ * @return The distance, or a very large value if the run fails.
+ */
+float FitCost(const FitConfig *config, const float *values);
+
+/**
+ * @brief Runs the optimizer.
+ * @param config The fit description.
+ * @param result Output result.
+ * @return false on an invalid config (no parameters, bad bounds, missing target).
+ */
+bool FitRun(const FitConfig *config, FitResult *result);
+
+#endif // FITTING_H
@@ -0,0 +1,142 @@
+/**
+ * @file phase_plane.h
+ * @brief Public interface for phase-plane analysis of 2D neuron models.
+ *
+ * Supports the Izhikevich model (u, v) and a reduced 2D projection of the
+ * Hodgkin-Huxley model (n, V), with m = m_inf(V) (instantaneous sodium
+ * activation) and h = 0.89 - 1.1 n (Rinzel's h-n relation). The analysis
+ * computes both nullclines, a vector-field grid evaluated with batched
+ * derivative kernels, and the fixed points with their stability, found by
+ * Newton's method.
+ *
+ * Coordinates follow the GUI phase plots: x is the recovery variable
+ * (u or n) and y is the membrane potential (v or V).
+ */
+#ifndef PHASE_PLANE_H
+#define PHASE_PLANE_H
+
+#include <stdbool.h>
+#include "model/neural/izhikevich/izhikevich_config.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_struct.h"
+
+/** @brief Vector-field grid resolution (arrows per axis). */
+#define PHASE_PLANE_FIELD_RES 20
+
+/** @brief Number of rows scanned when tracing the nullclines. */
+#define PHASE_PLANE_SCAN_ROWS 256
+
+/** @brief Number of columns scanned per row when tracing the nullclines. */
+#define PHASE_PLANE_SCAN_COLS 256
+
+/** @brief Maximum number of points stored per nullcline. */
+#define PHASE_PLANE_MAX_NULLCLINE_POINTS 1024
+
+/** @brief Maximum number of fixed points reported. */
+#define PHASE_PLANE_MAX_EQUILIBRIA 4
+
+/**
+ * @enum PhaseSystem
+ * @brief The 2D system being analyzed.
+ */
+typedef enum {
+    PHASE_SYSTEM_IZHIKEVICH = 0, ///< x = u, y = v
+    PHASE_SYSTEM_HH_REDUCED      ///< x = n, y = V (m = m_inf(V), h = 0.89 - 1.1 n)
+} PhaseSystem;
+
+/**
+ * @enum EquilibriumType
+ * @brief Linear stability class of a fixed point.
+ */
+typedef enum {
+    EQUILIBRIUM_STABLE_NODE = 0,
+    EQUILIBRIUM_STABLE_FOCUS,
+    EQUILIBRIUM_UNSTABLE_NODE,
+    EQUILIBRIUM_UNSTABLE_FOCUS,
+    EQUILIBRIUM_SADDLE,
+    EQUILIBRIUM_CENTER
+} EquilibriumType;
+
+/**
+ * @struct PhasePlaneModel
+ * @brief The system and parameters to analyze.
+ */
+typedef struct {
+    PhaseSystem system;
+    IzhikevichConfig izParams;      ///< Used when system == PHASE_SYSTEM_IZHIKEVICH
+    HodgkinHuxleyParams hhParams;   ///< Used when system == PHASE_SYSTEM_HH_REDUCED
+    float externCurrent;            ///< Constant input current
+} PhasePlaneModel;
+
+/**
+ * @struct PhasePlaneViewport
+ * @brief Region of the (x, y) plane to analyze.
+ */
+typedef struct {
+    float xMin, xMax;
+    float yMin, yMax;
+} PhasePlaneViewport;
+
+/**
+ * @struct PhaseEquilibrium
+ * @brief A fixed point and its linearization.
+ */
+typedef struct {
+    float x, y;             ///< Position
+    float trace;            ///< Trace of the Jacobian
+    float determinant;      ///< Determinant of the Jacobian
+    EquilibriumType type;   ///< Stability class
+} PhaseEquilibrium;
+
+/**
+ * @struct PhasePlaneAnalysis
+ * @brief Result of a phase-plane analysis over one viewport.
+ */
+typedef struct {
+    PhasePlaneViewport viewport;
+
+    // Vector field on a regular grid (row-major, row 0 at yMin)
+    float fieldDx[PHASE_PLANE_FIELD_RES * PHASE_PLANE_FIELD_RES];
+    float fieldDy[PHASE_PLANE_FIELD_RES * PHASE_PLANE_FIELD_RES];
+
+    // Nullclines as unordered point clouds (x, y pairs)
+    int xNullclineCount;                                    ///< Points where dx/dt = 0
+    float xNullcline[PHASE_PLANE_MAX_NULLCLINE_POINTS][2];
+    int yNullclineCount;                                    ///< Points where dy/dt = 0
+    float yNullcline[PHASE_PLANE_MAX_NULLCLINE_POINTS][2];
+
+    int equilibriumCount;
+    PhaseEquilibrium equilibria[PHASE_PLANE_MAX_EQUILIBRIA];
+} PhasePlaneAnalysis;
+
+/**
+ * @brief Evaluates (dx/dt, dy/dt) for a batch of points.
+ *
+ * @param model The system to evaluate.
+ * @param x Array of recovery values.
+ * @param y Array of potentials.
+ * @param dx Output array for dx/dt.
+ * @param dy Output array for dy/dt.
+ * @param n Number of points.
+ */
+void PhasePlaneDerivativesBatch(const PhasePlaneModel *model, const float *x, const float *y, float *dx, float *dy, int n);
+
+/**
+ * @brief Computes the nullclines, vector field and fixed points in a viewport.
+ *
+ * @param model The system to analyze.
+ * @param viewport The region of the plane.
+ * @param analysis Output analysis.
+ */
+void PhasePlaneAnalyze(const PhasePlaneModel *model, const PhasePlaneViewport *viewport, PhasePlaneAnalysis *analysis);
+
+/**
+ * @brief Refines a fixed point with Newton's method.
+ *
+ * @param model The system.
+ * @param x In: initial guess, out: converged x.
+ * @param y In: initial guess, out: converged y.
+ * @return true if the iteration converged.
+ */
+bool PhasePlaneNewton(const PhasePlaneModel *model, float *x, float *y);
+
+#endif // PHASE_PLANE_H
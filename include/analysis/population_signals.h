@@ -0,0 +1,111 @@
+/**
+ * @file population_signals.h
+ * @brief Aggregate observables of a network run: LFP proxy, population rate
+ * and Kuramoto synchrony, binned over time.
+ *
+ * The signals are never computed from stored traces. Each chunk of the
+ * network update accumulates a PopulationPartial while it advances its
+ * neurons; the partials are merged once per step (a parallel reduction)
+ * and the step totals are folded into fixed-width time bins here. Bins
+ * are kept in a ring, so a long run only retains the most recent history.
+ */
+#ifndef POPULATION_SIGNALS_H
+#define POPULATION_SIGNALS_H
+
+#include <stdbool.h>
+
+/** @brief Default bin width (ms). */
+#define POPULATION_SIGNALS_DEFAULT_BIN 1.0f
+
+/** @brief Default number of retained bins. */
+#define POPULATION_SIGNALS_DEFAULT_CAPACITY 4096
+
+/** @brief Synchrony is sampled this many times per bin. */
+#define POPULATION_SIGNALS_PHASE_SAMPLES 4
+
+/**
+ * @struct PopulationPartial
+ * @brief Per-chunk (then per-step) sums produced by the fused update pass.
+ */
+typedef struct {
+    double iSyn;        ///< Sum of the synaptic currents of the chunk's neurons
+    int spikes;         ///< Spikes emitted by the chunk during the step
+    double phaseCos;    ///< Sum of cos(theta_i) over neurons with a defined phase
+    double phaseSin;    ///< Sum of sin(theta_i)
+    int phaseCount;     ///< Neurons that contributed a phase (0 when not sampled)
+} PopulationPartial;
+
+/**
+ * @struct PopulationSignals
+ * @brief Ring of binned population signals plus the accumulator of the open bin.
+ */
+typedef struct {
+    int neuronCount;
+    float binWidth;         ///< Bin width (ms)
+    int capacity;           ///< Number of bins the ring holds
+    int total;              ///< Bins closed since the last reset
+
+    float *lfp;             ///< Step-averaged summed synaptic current per bin
+    float *rate;            ///< Mean firing rate per neuron (Hz) per bin
+    float *synchrony;       ///< Kuramoto order parameter R in [0, 1] per bin
+
+    double binTime;         ///< Time accumulated in the open bin (ms)
+    double lfpSum;          ///< Sum over steps of the summed current
+    int binSteps;
+    long binSpikes;
+    double syncSum;         ///< Sum over phase samples of R
+    int syncSamples;
+} PopulationSignals;
+
+/**
+ * @brief Resets a partial to zero.
+ */
+void PopulationPartialClear(PopulationPartial *partial);
+
+/**
+ * @brief Adds 'from' into 'into'.
+ */
+void PopulationPartialMerge(PopulationPartial *into, const PopulationPartial *from);
+
+/**
+ * @brief Allocates the bin ring.
+ * @param signals Output structure.
+ * @param neuronCount Population size (normalizes the rate).
+ * @param binWidth Bin width (ms, > 0).
+ * @param capacity Number of retained bins (> 0).
+ * @return false on invalid arguments or allocation failure.
+ */
+bool PopulationSignalsInit(PopulationSignals *signals, int neuronCount, float binWidth, int capacity);
+
+/**
+ * @brief Discards all bins, keeping the configuration.
+ */
+void PopulationSignalsReset(PopulationSignals *signals);
+
+/**
+ * @brief Folds the merged totals of one step into the open bin, closing it
+ * when it spans 'binWidth'.
+ * @param signals The signals.
+ * @param step Reduction of all chunks for this step.
+ * @param dt Step length (ms).
+ */
+void PopulationSignalsAccumulate(PopulationSignals *signals, const PopulationPartial *step, float dt);
+
+/**
+ * @brief Returns the number of bins currently held (at most 'capacity').
+ */
+int PopulationSignalsCount(const PopulationSignals *signals);
+
+/**
+ * @brief Reads one held bin, 0 being the oldest.
+ * @param lfp, rate, synchrony Outputs (each may be NULL).
+ * @return false if 'index' is out of range.
+ */
+bool PopulationSignalsGet(const PopulationSignals *signals, int index, float *lfp, float *rate, float *synchrony);
+
+/**
+ * @brief Frees the bin ring.
+ */
+void PopulationSignalsFree(PopulationSignals *signals);
+
+#endif // POPULATION_SIGNALS_H
@@ -0,0 +1,78 @@
+/**
+ * @file prc.h
+ * @brief Public interface for phase response curve (PRC) computation.
+ *
+ * The neuron is driven onto its limit cycle by a constant current, and the
+ * state at one spike is captured as the cycle checkpoint. From that single
+ * checkpoint, N runs are launched in parallel; run k applies a short
+ * current pulse at phase k/N of the unperturbed period T0 and measures the
+ * perturbed period T1. The PRC value is the normalized phase advance
+ * (T0 - T1) / T0: positive when the pulse advances the next spike.
+ */
+#ifndef PRC_H
+#define PRC_H
+
+#include <stdbool.h>
+#include "simulation/simulation_run.h"
+
+/** @brief Maximum number of phases sampled by one PRC. */
+#define PRC_MAX_PHASES 256
+
+/** @brief Default file written by the GUI export button. */
+#define PRC_DEFAULT_EXPORT_PATH "prc.csv"
+
+/**
+ * @struct PrcConfig
+ * @brief PRC settings.
+ */
+typedef struct {
+    RunSpec base;          ///< Model, parameters, dt and the periodic drive ('externCurrent')
+    int phases;            ///< Number of sampled phases (N, at most PRC_MAX_PHASES)
+    float pulseAmplitude;  ///< Current added during the pulse
+    float pulseWidth;      ///< Pulse duration (ms)
+    float transient;       ///< Time simulated before the cycle checkpoint is taken (ms)
+} PrcConfig;
+
+/**
+ * @struct PrcResult
+ * @brief A computed PRC.
+ */
+typedef struct {
+    bool periodic;                  ///< false if the drive does not produce repetitive firing
+    float period;                   ///< Unperturbed period T0 (ms)
+    int count;                      ///< Number of valid samples
+    float phase[PRC_MAX_PHASES];    ///< Pulse phase in [0, 1)
+    float shift[PRC_MAX_PHASES];    ///< Normalized phase advance (T0 - T1) / T0
+} PrcResult;
+
+/**
+ * @brief Fills a PrcConfig with defaults for the given model.
+ *
+ * 100 phases, a 0.5 ms pulse of 10% of the drive (at least 1), and a
+ * 200 ms transient.
+ *
+ * @param config Output config.
+ * @param neuronModel The model to characterize.
+ * @param externCurrent The periodic drive.
+ */
+void PrcConfigDefaults(PrcConfig *config, NeuronModel neuronModel, float externCurrent);
+
+/**
+ * @brief Computes the PRC of the limit cycle selected by the config.
+ *
+ * @param config PRC settings.
+ * @param result Output PRC.
+ * @return true if the computation ran (check result->periodic), false on an
+ * invalid config or allocation failure.
+ */
+bool PrcCompute(const PrcConfig *config, PrcResult *result);
+
+/**
+ * @brief Writes a PRC as CSV (columns: phase, shift).
+ * @param result The PRC to export.
+ * @param path Destination file path.
+ * @return true on success, false on I/O error or if the PRC is empty.
+ */
+bool PrcExportCsv(const PrcResult *result, const char *path);
+
+#endif // PRC_H
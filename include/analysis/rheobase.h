@@ -0,0 +1,80 @@
+/**
+ * @file rheobase.h
+ * @brief Public interface for the automated rheobase and threshold search.
+ *
+ * The rheobase is the smallest constant current step (applied from rest)
+ * that makes the neuron fire at least one spike within the probe window.
+ * The search first brackets it by expanding the upper bound geometrically,
+ * then shrinks the bracket by parallel multisection: every level probes
+ * several currents inside the bracket at once (each probe is an independent
+ * headless run), which reduces the bracket by (probes + 1) per level
+ * instead of 2 for plain bisection.
+ *
+ * The voltage threshold is read from the first spike at the rheobase: the
+ * potential at which dV/dt first exceeds RHEOBASE_THRESHOLD_SLOPE.
+ */
+#ifndef RHEOBASE_H
+#define RHEOBASE_H
+
+#include <stdbool.h>
+#include "simulation/simulation_run.h"
+
+/** @brief dV/dt (mV/ms) that defines the voltage threshold of the first spike. */
+#define RHEOBASE_THRESHOLD_SLOPE 10.0f
+
+/** @brief Maximum number of currents probed in parallel per level. */
+#define RHEOBASE_MAX_PROBES 32
+
+/**
+ * @struct RheobaseConfig
+ * @brief Search settings.
+ */
+typedef struct {
+    RunSpec base;          ///< Model, parameters, dt and probe duration ('externCurrent' is ignored)
+    float currentMin;      ///< Lower end of the initial bracket (must not fire)
+    float currentMax;      ///< Upper end of the initial bracket (expanded if it does not fire)
+    float tolerance;       ///< Width of the final bracket
+    int probesPerLevel;    ///< Currents probed per level (0 = one per worker thread)
+} RheobaseConfig;
+
+/**
+ * @struct RheobaseResult
+ * @brief Outcome of a search.
+ */
+typedef struct {
+    bool found;                 ///< true if the rheobase was bracketed to the tolerance
+    bool firesAtMin;            ///< currentMin already fires: the rheobase is at or below it (found is false)
+    float rheobase;             ///< Smallest firing current (upper end of the final bracket), or currentMin if firesAtMin
+    float thresholdPotential;   ///< Potential at the onset of the first spike (mV)
+    float firstSpikeLatency;    ///< Time from the step to the first spike at the rheobase (ms)
+    int levels;                 ///< Parallel probe levels run (bracketing + refinement)
+    int probeCount;             ///< Total number of simulations run
+} RheobaseResult;
+
+/**
+ * @brief Fills a RheobaseConfig with defaults for the given model.
+ *
+ * Probes last 500 ms from the settled resting state, the initial bracket
+ * is [0, 10] and the tolerance 0.01.
+ *
+ * @param config Output config.
+ * @param neuronModel The model to characterize.
+ */
+void RheobaseConfigDefaults(RheobaseConfig *config, NeuronModel neuronModel);
+
+/**
+ * @brief Searches the rheobase and voltage threshold of one model/parameter set.
+ *
+ * found and firesAtMin both false means that no current in the searched
+ * range fires. With firesAtMin, the threshold and latency are those of
+ * currentMin, an upper estimate of the rheobase; search again with a
+ * lower currentMin to bracket it.
+ *
+ * @param config Search settings.
+ * @param result Output result.
+ * @return true if the search ran (check result->found), false on an invalid
+ * config or if a probe could not be simulated.
+ */
+bool RheobaseFind(const RheobaseConfig *config, RheobaseResult *result);
+
+#endif // RHEOBASE_H
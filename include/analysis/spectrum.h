@@ -0,0 +1,162 @@
+/**
+ * @file spectrum.h
+ * @brief Public interface for incremental spectral analysis (Welch PSD and impedance).
+ *
+ * A SpectrumEstimator consumes one (input current, membrane potential)
+ * sample per simulation step. Samples are block-averaged down to a lower
+ * rate, collected into Hann-windowed segments with 50% overlap, and every
+ * complete segment is transformed once and accumulated. The estimates are
+ * therefore always up to date while a run is recorded, at an amortized
+ * cost of O(log N) per sample, without revisiting the stored trace.
+ *
+ * Both signals are transformed with a single complex FFT (current in the
+ * imaginary part), which yields the Welch power spectrum of V(t) and the
+ * cross-spectrum used for the input impedance Z(f) = S_IV(f) / S_II(f).
+ * Driving the neuron with a ZAP (chirp) current makes S_II cover the whole
+ * swept band, so Z(f) becomes the impedance profile of the cell.
+ */
+#ifndef SPECTRUM_H
+#define SPECTRUM_H
+
+#include <stdbool.h>
+#include "simulation/simulation_run.h"
+
+/** @brief Largest supported segment length (power of two). */
+#define SPECTRUM_MAX_SEGMENT 4096
+
+/** @brief Number of one-sided frequency bins of the largest segment. */
+#define SPECTRUM_MAX_BINS (SPECTRUM_MAX_SEGMENT / 2 + 1)
+
+/** @brief Default segment length of the live estimator (decimated samples). */
+#define SPECTRUM_DEFAULT_SEGMENT 1024
+
+/** @brief Default block-averaging factor of the live estimator (raw samples per decimated sample). */
+#define SPECTRUM_DEFAULT_DECIMATION 10
+
+/**
+ * @struct SpectrumEstimator
+ * @brief Incremental Welch estimator of the V(t) power spectrum and the I -> V cross-spectrum.
+ */
+typedef struct {
+    int segmentLength;                      ///< Samples per segment (power of two)
+    int hop;                                ///< Samples between segment starts (50% overlap)
+    int decimation;                         ///< Raw samples averaged into one decimated sample
+    float sampleRate;                       ///< Decimated sampling rate (Hz)
+    double windowPower;                     ///< Sum of the squared window coefficients
+
+    float window[SPECTRUM_MAX_SEGMENT];     ///< Hann window
+    float input[SPECTRUM_MAX_SEGMENT];      ///< Pending decimated current samples
+    float output[SPECTRUM_MAX_SEGMENT];     ///< Pending decimated potential samples
+    int filled;                             ///< Pending samples in 'input'/'output'
+
+    double blockInput;                      ///< Running sum of the current decimation block
+    double blockOutput;
+    int blockCount;
+
+    double powerOutput[SPECTRUM_MAX_BINS];  ///< Accumulated |V|^2
+    double powerInput[SPECTRUM_MAX_BINS];   ///< Accumulated |I|^2
+    double crossRe[SPECTRUM_MAX_BINS];      ///< Accumulated conj(I) * V, real part
+    double crossIm[SPECTRUM_MAX_BINS];      ///< Accumulated conj(I) * V, imaginary part
+    int segments;                           ///< Segments accumulated so far
+
+    float scratchRe[SPECTRUM_MAX_SEGMENT];  ///< FFT work buffers
+    float scratchIm[SPECTRUM_MAX_SEGMENT];
+} SpectrumEstimator;
+
+/**
+ * @struct ZapConfig
+ * @brief Linear chirp (ZAP) stimulus: amplitude * sin(2*pi*f(t)*t), with f
+ * sweeping from fStart to fEnd over 'duration' and the sweep repeating.
+ */
+typedef struct {
+    float amplitude;    ///< Peak current
+    float fStart;       ///< Start frequency (Hz)
+    float fEnd;         ///< End frequency (Hz)
+    float duration;     ///< Sweep duration (ms)
+} ZapConfig;
+
+/**
+ * @brief Initializes (and clears) an estimator.
+ * @param estimator The estimator.
+ * @param segmentLength Segment length, a power of two up to SPECTRUM_MAX_SEGMENT.
+ * @param decimation Raw samples per decimated sample (>= 1).
+ * @param dt Raw sampling interval (ms).
+ * @return false on invalid arguments.
+ */
+bool SpectrumInit(SpectrumEstimator *estimator, int segmentLength, int decimation, float dt);
+
+/**
+ * @brief Discards all samples and accumulated spectra, keeping the configuration.
+ * @param estimator The estimator.
+ */
+void SpectrumReset(SpectrumEstimator *estimator);
+
+/**
+ * @brief Feeds one raw sample; transforms a segment whenever one completes.
+ * @param estimator The estimator.
+ * @param input Injected current at this step.
+ * @param output Membrane potential at this step (mV).
+ */
+void SpectrumPush(SpectrumEstimator *estimator, float input, float output);
+
+/**
+ * @brief Returns the number of one-sided frequency bins.
+ */
+int SpectrumBinCount(const SpectrumEstimator *estimator);
+
+/**
+ * @brief Returns the frequency of a bin (Hz).
+ */
+float SpectrumBinFrequency(const SpectrumEstimator *estimator, int bin);
+
+/**
+ * @brief Writes the one-sided Welch PSD of the potential (mV^2/Hz).
+ * @param estimator The estimator.
+ * @param psd Output array of SpectrumBinCount() values.
+ * @return false if no segment has completed yet.
+ */
+bool SpectrumGetPower(const SpectrumEstimator *estimator, float *psd);
+
+/**
+ * @brief Writes the input impedance |Z(f)| and its phase (radians).
+ *
+ * Bins where the stimulus carries no power are reported as zero.
+ *
+ * @param estimator The estimator.
+ * @param magnitude Output array of SpectrumBinCount() values (mV per current unit).
+ * @param phase Output array of SpectrumBinCount() values (may be NULL).
+ * @return false if no segment has completed yet.
+ */
+bool SpectrumGetImpedance(const SpectrumEstimator *estimator, float *magnitude, float *phase);
+
+/**
+ * @brief Fills a ZapConfig with the default 1-100 Hz sweep.
+ * @param zap Output config.
+ * @param amplitude Peak current.
+ * @param duration Sweep duration (ms).
+ */
+void ZapConfigDefaults(ZapConfig *zap, float amplitude, float duration);
+
+/**
+ * @brief Evaluates the ZAP current at time t.
+ * @param zap The stimulus.
+ * @param t Time since the start of the stimulus (ms).
+ * @return The stimulus current.
+ */
+float ZapCurrent(const ZapConfig *zap, float t);
+
+/**
+ * @brief Measures the impedance profile of a neuron with a headless ZAP run.
+ *
+ * The neuron is held at spec->externCurrent and the chirp is added on top
+ * for one sweep. The estimator must be initialized with spec->dt; it is
+ * reset before the run.
+ *
+ * @param spec The neuron (model, parameters, bias current, dt).
+ * @param zap The stimulus.
+ * @param estimator Output estimator (read with SpectrumGetImpedance).
+ * @return false on an invalid spec.
+ */
+bool SpectrumImpedanceProfile(const RunSpec *spec, const ZapConfig *zap, SpectrumEstimator *estimator);
+
+#endif // SPECTRUM_H
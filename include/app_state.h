@@ -74,7 +74,10 @@ typedef struct {
 /** @brief Defines the tabs in the auxiliary (right-hand) panel. */
 typedef enum {
     TAB_STATE = 0,
-    TAB_EVENTS
+    TAB_EVENTS,
+    TAB_PRC,
+    TAB_SPECTRUM,
+    TAB_NETWORK
 } AuxiliaryTabType;
 
 /** @brief Defines the tabs in the main (center) panel. */
@@ -0,0 +1,71 @@
+/**
+ * @file gui_heatmap.h
+ * @brief Public interface for the population voltage heat map widget.
+ *
+ * Neurons x time image of the membrane potential. Each pushed column maps
+ * the potentials through a 256-entry color lookup table into one column
+ * of a scrolling texture (gui_scroll_texture.h), which is sent to the GPU
+ * as a texture sub-upload. Neurons sharing a row are averaged.
+ */
+#ifndef GUI_HEATMAP_H
+#define GUI_HEATMAP_H
+
+#include <stdbool.h>
+#include "raylib.h"
+#include "gui/components/gui_scroll_texture.h"
+
+/** @brief Number of entries of the color lookup table. */
+#define GUI_HEATMAP_LUT_SIZE 256
+
+/**
+ * @struct GuiHeatmap
+ * @brief Persistent state of one voltage heat map.
+ */
+typedef struct {
+    GuiScrollTexture scroll;               ///< Scrolling voltage image
+    Color lut[GUI_HEATMAP_LUT_SIZE];       ///< Colormap, low to high
+    float vMin;                            ///< Potential mapped to the first LUT entry (mV)
+    float vMax;                            ///< Potential mapped to the last LUT entry (mV)
+    float *rowSum;                         ///< Per-row accumulator ('rows' entries)
+    int *rowCount;                         ///< Neurons per row
+} GuiHeatmap;
+
+/**
+ * @brief Creates the heat map texture.
+ * @param widget The widget (zero-initialized before the first call).
+ * @param neuronCount Number of neurons.
+ * @param columns Number of time bins on screen.
+ * @param msPerColumn Time covered by one column (ms).
+ * @param vMin Potential of the coldest color (mV).
+ * @param vMax Potential of the hottest color (mV).
+ * @return false on invalid arguments or allocation failure.
+ */
+bool GuiHeatmapInit(GuiHeatmap *widget, int neuronCount, int columns, float msPerColumn, float vMin, float vMax);
+
+/**
+ * @brief Writes the potentials of all neurons at one time into the heat map.
+ *
+ * Steps falling into the same column overwrite it, so pushing every
+ * simulation step or only once per column both work.
+ *
+ * @param widget The widget.
+ * @param time Time of the sample (ms).
+ * @param potentials One potential per neuron (neuronCount entries).
+ */
+void GuiHeatmapPushColumn(GuiHeatmap *widget, float time, const float *potentials);
+
+/**
+ * @brief Draws the heat map (time window on x, neuron index on y).
+ * @param widget The widget.
+ * @param bounds Outer rectangle of the plot.
+ * @param time Current simulation time (ms), used for the x-axis range.
+ */
+void GuiHeatmapDraw(GuiHeatmap *widget, Rectangle bounds, float time);
+
+/**
+ * @brief Releases the texture and the buffers.
+ * @param widget The widget.
+ */
+void GuiHeatmapUnload(GuiHeatmap *widget);
+
+#endif // GUI_HEATMAP_H
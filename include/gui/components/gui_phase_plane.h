@@ -0,0 +1,61 @@
+/**
+ * @file gui_phase_plane.h
+ * @brief Public interface for the phase-plane overlay widget.
+ *
+ * Draws the nullclines, vector field and fixed points of a PhasePlaneModel
+ * underneath a phase plot. The overlay is rendered once into a texture and
+ * only recomputed when the model parameters, the viewport (axis ranges) or
+ * the widget size change.
+ */
+#ifndef GUI_PHASE_PLANE_H
+#define GUI_PHASE_PLANE_H
+
+#include <stdbool.h>
+#include "raylib.h"
+#include "analysis/phase_plane.h"
+#include "gui/components/gui_plot.h"
+
+/**
+ * @struct GuiPhasePlane
+ * @brief Persistent state of one phase-plane overlay (cached texture and analysis).
+ */
+typedef struct {
+    bool loaded;                    ///< true once 'texture' holds a valid render
+    RenderTexture2D texture;        ///< Cached overlay
+    PhasePlaneModel model;          ///< Model of the cached render
+    PhasePlaneViewport viewport;    ///< Viewport of the cached render
+    PhasePlaneAnalysis analysis;    ///< Analysis of the cached render
+} GuiPhasePlane;
+
+/**
+ * @brief Re-renders the cached overlay if the model, the viewport or the
+ * plot size changed.
+ *
+ * The viewport is taken from the x/y ranges of 'cfg'. Call outside any
+ * scissor mode: the scissor test stays active while rendering into the
+ * texture and would clip the cached overlay.
+ *
+ * @param widget Pointer to the persistent widget state.
+ * @param model The system to analyze.
+ * @param cfg The plot configuration the overlay belongs to.
+ */
+void GuiPhasePlaneUpdate(GuiPhasePlane *widget, const PhasePlaneModel *model, const PlotCfg *cfg);
+
+/**
+ * @brief Draws the cached overlay inside the data area of a plot.
+ *
+ * Call after GuiPhasePlaneUpdate and before drawing the trajectory so that
+ * it appears on top.
+ *
+ * @param widget Pointer to the widget state.
+ * @param cfg The plot configuration the overlay belongs to.
+ */
+void GuiPhasePlaneDraw(const GuiPhasePlane *widget, const PlotCfg *cfg);
+
+/**
+ * @brief Releases the cached texture.
+ * @param widget Pointer to the widget state.
+ */
+void GuiPhasePlaneUnload(GuiPhasePlane *widget);
+
+#endif // GUI_PHASE_PLANE_H
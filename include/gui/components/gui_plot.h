@@ -42,6 +42,13 @@ typedef struct {
  */
 void GuiPlotDraw(const PlotCfg *cfg);
 
+/**
+ * @brief Computes the inner rectangle where data is drawn (bounds minus axis margins).
+ * @param cfg Pointer to the PlotCfg configuration structure.
+ * @return The data area, in screen coordinates.
+ */
+Rectangle GuiPlotGetDataRect(const PlotCfg *cfg);
+
 /**
  * @brief Draws the axes, labels, and tick marks for the plot.
  * @param cfg Pointer to the PlotCfg configuration structure.
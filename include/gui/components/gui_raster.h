@@ -0,0 +1,59 @@
+/**
+ * @file gui_raster.h
+ * @brief Public interface for the spike raster widget.
+ *
+ * Spikes are written as pixels into a scrolling column texture
+ * (gui_scroll_texture.h): one column per time bin, one row per neuron (or
+ * group of neurons for large populations). Adding a spike is a single
+ * pixel write; drawing uploads only the columns that changed.
+ */
+#ifndef GUI_RASTER_H
+#define GUI_RASTER_H
+
+#include <stdbool.h>
+#include "raylib.h"
+#include "gui/components/gui_scroll_texture.h"
+
+/**
+ * @struct GuiRaster
+ * @brief Persistent state of one spike raster.
+ */
+typedef struct {
+    GuiScrollTexture scroll;    ///< Scrolling spike image
+    Color spikeColor;           ///< Color of a spike pixel
+} GuiRaster;
+
+/**
+ * @brief Creates the raster texture.
+ * @param widget The widget (zero-initialized before the first call).
+ * @param neuronCount Number of neurons.
+ * @param columns Number of time bins on screen.
+ * @param msPerColumn Time covered by one column (ms).
+ * @return false on invalid arguments or allocation failure.
+ */
+bool GuiRasterInit(GuiRaster *widget, int neuronCount, int columns, float msPerColumn);
+
+/**
+ * @brief Records the spikes of one simulation step.
+ * @param widget The widget.
+ * @param time Time of the step (ms).
+ * @param neurons Indices of the neurons that spiked.
+ * @param count Number of entries in 'neurons'.
+ */
+void GuiRasterAddSpikes(GuiRaster *widget, float time, const int *neurons, int count);
+
+/**
+ * @brief Draws the raster (time window on x, neuron index on y).
+ * @param widget The widget.
+ * @param bounds Outer rectangle of the plot.
+ * @param time Current simulation time (ms), used for the x-axis range.
+ */
+void GuiRasterDraw(GuiRaster *widget, Rectangle bounds, float time);
+
+/**
+ * @brief Releases the texture and the CPU buffer.
+ * @param widget The widget.
+ */
+void GuiRasterUnload(GuiRaster *widget);
+
+#endif // GUI_RASTER_H
@@ -0,0 +1,91 @@
+/**
+ * @file gui_scroll_texture.h
+ * @brief Public interface for a scrolling column texture (shared by the raster and heat map widgets).
+ *
+ * A fixed-size texture whose columns are time bins and whose rows are
+ * (groups of) neurons. Columns are written into a ring: the write head
+ * advances with simulated time and the oldest column is overwritten, so
+ * nothing is ever shifted. The CPU copy is stored column-major, which
+ * makes every column one contiguous block that is sent with a 1-pixel
+ * wide texture sub-upload. Per frame only the columns touched since the
+ * last draw are uploaded, so the cost depends on the texture height and
+ * the elapsed time, not on the neuron count.
+ */
+#ifndef GUI_SCROLL_TEXTURE_H
+#define GUI_SCROLL_TEXTURE_H
+
+#include <stdbool.h>
+#include "raylib.h"
+#include "gui/components/gui_plot.h"
+
+/** @brief Maximum texture height (rows); larger populations share rows. */
+#define GUI_SCROLL_TEXTURE_MAX_ROWS 2048
+
+/**
+ * @struct GuiScrollTexture
+ * @brief Persistent state of one scrolling column texture.
+ */
+typedef struct {
+    bool loaded;            ///< true once the texture exists
+    Texture2D texture;      ///< GPU copy
+    Color *pixels;          ///< CPU copy, column-major ('rows' pixels per column)
+    int columns;            ///< Texture width (time bins)
+    int rows;               ///< Texture height
+    int neuronCount;        ///< Neurons mapped onto the rows
+    float msPerColumn;      ///< Time covered by one column (ms)
+    Color background;       ///< Color of an empty pixel
+
+    long head;              ///< Absolute index of the column being written
+    long uploaded;          ///< Absolute index of the first column not yet uploaded
+    bool headDirty;         ///< The head column changed since the last upload
+} GuiScrollTexture;
+
+/**
+ * @brief Allocates the CPU buffer and the texture.
+ *
+ * The widget must be zero-initialized before the first call (static
+ * storage); calling it again re-creates the texture.
+ * @param widget The widget.
+ * @param neuronCount Number of neurons (rows are min(neuronCount, GUI_SCROLL_TEXTURE_MAX_ROWS)).
+ * @param columns Number of time bins kept on screen.
+ * @param msPerColumn Time covered by one column (ms).
+ * @param background Color of empty pixels.
+ * @return false on invalid arguments or allocation failure.
+ */
+bool GuiScrollTextureInit(GuiScrollTexture *widget, int neuronCount, int columns, float msPerColumn, Color background);
+
+/**
+ * @brief Returns the texture row of a neuron (neuron 0 is drawn at the bottom).
+ */
+int GuiScrollTextureRow(const GuiScrollTexture *widget, int neuron);
+
+/**
+ * @brief Advances the write head to the column containing 'time', clearing
+ * every column it passes over.
+ * @param widget The widget.
+ * @param time Simulation time (ms).
+ */
+void GuiScrollTextureSeek(GuiScrollTexture *widget, float time);
+
+/**
+ * @brief Returns the pixels of the head column ('rows' entries) for writing.
+ *
+ * Marks the head column dirty.
+ */
+Color *GuiScrollTextureHeadColumn(GuiScrollTexture *widget);
+
+/**
+ * @brief Uploads the dirty columns and draws the ring, oldest column on
+ * the left, inside the data area of 'cfg' (axes drawn from 'cfg').
+ * @param widget The widget.
+ * @param cfg Frame of the plot (bounds, labels, ranges; no data).
+ */
+void GuiScrollTextureDraw(GuiScrollTexture *widget, const PlotCfg *cfg);
+
+/**
+ * @brief Releases the CPU buffer and the texture.
+ * @param widget The widget.
+ */
+void GuiScrollTextureUnload(GuiScrollTexture *widget);
+
+#endif // GUI_SCROLL_TEXTURE_H
@@ -23,4 +23,11 @@
  */
 void ScreenMainMenuDraw(AppContext *ctx);
 
+/**
+ * @brief Releases the GPU resources (cached textures) owned by the main menu.
+ *
+ * Must be called before CloseWindow().
+ */
+void ScreenMainMenuUnload(void);
+
 #endif // MAIN_MENU_SCREEN_H
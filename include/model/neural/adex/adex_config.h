@@ -0,0 +1,54 @@
+/**
+ * @file adex_config.h
+ * @brief Defines the configuration structure and parameter sets for the
+ * adaptive exponential integrate-and-fire (AdEx) neuron model.
+ */
+#ifndef ADEX_CONFIG_H
+#define ADEX_CONFIG_H
+
+/**
+ * @enum AdexNeuronType
+ * @brief Enumerates the preset parameter sets in ADEX_PARAMETERS.
+ */
+typedef enum {
+    ADEX_BRETTE_GERSTNER = 0,
+    ADEX_TONIC,
+    ADEX_ADAPTING,
+    ADEX_INITIAL_BURST,
+    ADEX_BURSTING
+} AdexNeuronType;
+
+/**
+ * @struct AdexConfig
+ * @brief Parameters of an AdEx neuron with exponential current synapses.
+ *
+ * C dV/dt = -gL (V - EL) + gL dT exp((V - VT) / dT) - w + I
+ * tauW dw/dt = a (V - EL) - w
+ *
+ * Units: capacitance in pF, conductances in nS, potentials in mV, times in
+ * ms and currents in pA.
+ */
+typedef struct {
+    float capacitance;
+    float leakConductance;
+    float leakReversal;
+    float thresholdPotential;    ///< VT, the soft threshold
+    float slopeFactor;           ///< dT, sharpness of the spike initiation
+    float cutoff;                ///< A spike is registered when V reaches this value
+    float resetPotential;
+    float subthresholdAdaptation;///< a (nS)
+    float spikeAdaptation;       ///< b, added to w at each spike (pA)
+    float adaptationTau;         ///< tauW (ms)
+    float tauExcitatory;         ///< Decay time constant of excitatory currents
+    float tauInhibitory;         ///< Decay time constant of inhibitory currents
+} AdexConfig;
+
+/**
+ * @brief Array of preset configurations, indexed by AdexNeuronType.
+ *
+ * Sourced from Brette & Gerstner (2005) and the firing-pattern table of
+ * Naud, Marcille, Clopath & Gerstner (2008).
+ */
+extern const AdexConfig ADEX_PARAMETERS[];
+
+#endif // ADEX_CONFIG_H
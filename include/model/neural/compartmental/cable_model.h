@@ -0,0 +1,124 @@
+/**
+ * @file cable_model.h
+ * @brief Multi-compartment neurons: cable compartments with HH channels,
+ * solved implicitly with the Hines algorithm.
+ *
+ * Each step first advances the gates exactly for the current potentials
+ * (exponential Euler, stable for any dt), then solves the linearized
+ * cable equation for the new potentials with backward Euler or
+ * Crank-Nicolson. Because the compartments form a tree stored in Hines
+ * order (every parent before its children), the implicit system is
+ * solved by one elimination sweep from the leaves to the soma and one
+ * substitution sweep back, in O(compartments) time and without fill-in.
+ *
+ * Units follow the single-compartment HH model: potentials in mV (rest
+ * near 0), currents in pA, capacitances in pF, conductances in nS and
+ * time in ms. HH_CONFIG is read as the channel densities of a 30 um
+ * spherical soma, which is what the single-compartment model represents.
+ */
+#ifndef CABLE_MODEL_H
+#define CABLE_MODEL_H
+
+#include <stdbool.h>
+#include "utils/parallel.h"
+#include "model/neural/compartmental/cable_morphology.h"
+
+/** @brief Default axial resistivity (Ohm cm). */
+#define CABLE_DEFAULT_AXIAL_RESISTIVITY 100.0f
+
+/**
+ * @enum CableScheme
+ * @brief Time discretization of the cable equation.
+ */
+typedef enum {
+    CABLE_BACKWARD_EULER = 0,   ///< First order, strongly damped
+    CABLE_CRANK_NICOLSON        ///< Second order in the potentials
+} CableScheme;
+
+/**
+ * @struct CableCell
+ * @brief One cell: compartments in Hines order with structure-of-arrays state.
+ */
+typedef struct {
+    int count;
+    int *parent;           ///< Parent position (parent[i] < i; -1 for the soma at 0)
+    int *position;         ///< position[morphologyIndex] = index in this cell
+
+    float *v;              ///< Potential (mV)
+    float *m;
+    float *h;
+    float *n;
+    float *iExt;           ///< Injected current (pA)
+
+    float *capacitance;    ///< pF
+    float *gNa;            ///< Maximal conductances (nS), zero on passive compartments
+    float *gK;
+    float *gL;
+    float *eL;             ///< Leak reversal (mV)
+    float *axial;          ///< Conductance to the parent (nS)
+
+    float *diag;           ///< Solver scratch: diagonal
+    float *rhs;            ///< Solver scratch: right-hand side, then solution
+    float *coupling;       ///< Solver scratch: matrix entry between each compartment and its parent
+    float *buffer;
+
+    bool somaAbove;        ///< Soma above HH_SPIKE_THRESHOLD after the last step
+} CableCell;
+
+/**
+ * @brief Builds a cell from a morphology, placed at rest.
+ *
+ * @param morph The morphology (copied; may be freed afterwards).
+ * @param axialResistivity Axial resistivity (Ohm cm).
+ * @return The cell, or NULL if the morphology is not a valid tree or on
+ * allocation failure.
+ */
+CableCell *CableCellCreate(const CableMorphology *morph, float axialResistivity);
+
+/**
+ * @brief Advances a cell by one step.
+ * @param cell The cell.
+ * @param dt Time step (ms).
+ * @param scheme Discretization of the potentials.
+ * @return true if the soma crossed HH_SPIKE_THRESHOLD upwards during the step.
+ */
+bool CableCellStep(CableCell *cell, float dt, CableScheme scheme);
+
+/**
+ * @brief Frees a cell.
+ */
+void CableCellFree(CableCell *cell);
+
+/**
+ * @struct CablePopulation
+ * @brief Independent cells of one morphology, stepped in parallel.
+ */
+typedef struct {
+    int count;
+    CableCell **cells;
+    float dt;
+    CableScheme scheme;
+    bool *spiked;          ///< Per cell: soma spike during the last step
+    ParallelPool *pool;
+} CablePopulation;
+
+/**
+ * @brief Creates 'count' identical cells.
+ * @param threads Pool threads (<= 0 for one per CPU).
+ * @return The population, or NULL on failure.
+ */
+CablePopulation *CablePopulationCreate(const CableMorphology *morph, int count, float axialResistivity,
+                                       float dt, CableScheme scheme, int threads);
+
+/**
+ * @brief Advances every cell by one step, cells distributed over the pool.
+ * @return Number of cells whose soma spiked.
+ */
+int CablePopulationStep(CablePopulation *pop);
+
+/**
+ * @brief Frees a population and its cells.
+ */
+void CablePopulationFree(CablePopulation *pop);
+
+#endif // CABLE_MODEL_H
@@ -0,0 +1,83 @@
+/**
+ * @file cable_morphology.h
+ * @brief Tree description of a neuron's morphology as cable compartments.
+ *
+ * A morphology is a list of compartments, each attached to a parent. The
+ * root is the soma (a sphere); every other compartment is a cylinder.
+ * Sections (unbranched cables) are added as runs of equal segments, so a
+ * dendritic tree is built by attaching sections to the distal end of
+ * other sections.
+ *
+ * Lengths and diameters are in um.
+ */
+#ifndef CABLE_MORPHOLOGY_H
+#define CABLE_MORPHOLOGY_H
+
+#include <stdbool.h>
+
+/**
+ * @struct CableMorphology
+ * @brief Growable compartment list. parent[0] is -1 (the soma).
+ */
+typedef struct {
+    int count;
+    int capacity;
+    int *parent;       ///< Parent compartment, -1 for the soma
+    float *length;     ///< Cylinder length (0 for the soma)
+    float *diameter;   ///< Cylinder (or soma sphere) diameter
+    bool *active;      ///< HH channels if true, passive leak only otherwise
+} CableMorphology;
+
+/**
+ * @brief Initializes an empty morphology.
+ */
+void CableMorphologyInit(CableMorphology *morph);
+
+/**
+ * @brief Adds the spherical, active soma. Must be the first compartment.
+ * @return Its index (0), or -1 if the morphology is not empty or on allocation failure.
+ */
+int CableMorphologyAddSoma(CableMorphology *morph, float diameter);
+
+/**
+ * @brief Appends an unbranched section of 'segments' equal compartments.
+ *
+ * @param morph The morphology.
+ * @param parent Compartment the proximal end attaches to.
+ * @param length Total section length.
+ * @param diameter Section diameter.
+ * @param segments Number of compartments the section is split into (>= 1).
+ * @param active Whether the section carries HH channels.
+ * @return Index of the distal compartment (to attach further sections),
+ * or -1 on invalid arguments or allocation failure.
+ */
+int CableMorphologyAddSection(CableMorphology *morph, int parent, float length, float diameter, int segments, bool active);
+
+/**
+ * @brief Builds the classic ball-and-stick cell: a soma and one passive dendrite.
+ * @return false on allocation failure.
+ */
+bool CableMorphologyBallAndStick(CableMorphology *morph, float somaDiameter,
+                                 float dendriteLength, float dendriteDiameter, int segments);
+
+/**
+ * @brief Computes the Hines order of the compartments.
+ *
+ * The order is a depth-first traversal from the soma: every parent comes
+ * before its children (which the solver requires) and the compartments of
+ * each unbranched section are consecutive, so the solver sweeps contiguous
+ * memory.
+ *
+ * @param morph The morphology.
+ * @param order Output: order[k] is the morphology index placed at position k
+ * (room for morph->count values).
+ * @return false if the morphology is not a single tree rooted at compartment 0.
+ */
+bool CableMorphologyHinesOrder(const CableMorphology *morph, int *order);
+
+/**
+ * @brief Frees the compartment arrays.
+ */
+void CableMorphologyFree(CableMorphology *morph);
+
+#endif // CABLE_MORPHOLOGY_H
@@ -31,4 +31,12 @@ typedef struct {
  */
 extern const HodgkinHuxleyConfig HH_CONFIG;
 
+/**
+ * @brief Upward voltage crossing (in mV) counted as a spike.
+ *
+ * The HH equations use the shifted convention where the settled rest is
+ * near 0 mV and action potentials peak near +100 mV.
+ */
+extern const float HH_SPIKE_THRESHOLD;
+
 #endif // HODGKIN_HUXLEY_CONFIG_H
@@ -34,6 +34,24 @@ HodgkinHuxleyModel* HodgkinHuxleyInitModel(const float dt);
  */
 bool HodgkinHuxleySetExternalCurent(HodgkinHuxleyModel *model, float iExt);
 
+/**
+ * @brief Replaces the neuron parameters (conductances, reversals, capacitance).
+ *
+ * @param model Pointer to the HH model.
+ * @param params Pointer to the new parameter set.
+ * @return true on success, false if any pointer is NULL.
+ */
+bool HodgkinHuxleySetParameters(HodgkinHuxleyModel *model, const HodgkinHuxleyParams *params);
+
+/**
+ * @brief Puts the neuron back into its initial state (resting potential,
+ * resting gate values).
+ *
+ * @param model Pointer to the HH model.
+ * @return true on success, false if the model pointer is NULL.
+ */
+bool HodgkinHuxleyResetState(HodgkinHuxleyModel *model);
+
 /**
  * @brief Advances the model simulation by one time step (dt).
  *
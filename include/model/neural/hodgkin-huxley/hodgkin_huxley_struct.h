@@ -7,6 +7,11 @@
 
 #include "utils/rk4.h"
 
+/** @brief Dimension of the system of ODEs (V, m, h, n) */
+#define HODGKIN_HUXLEY_SYS_DIM 4
+/** @brief Number of currents stored in the internal buffer (iNa, iK, iL, iSyn, iExt) */
+#define HODGKIN_HUXLEY_NUM_CURRENTS 5
+
 /**
  * @struct HodgkinHuxleyParams
  * @brief Neuron parameters (conductances and reversal potentials).
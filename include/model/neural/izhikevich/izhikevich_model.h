@@ -22,6 +22,19 @@
  */
 IzhikevichModel* IzhikevichInitModel(const IzNeuronType type, const float dt);
 
+/**
+ * @brief Allocates and initializes a new Izhikevich model with arbitrary parameters.
+ *
+ * Same as IzhikevichInitModel, but takes (a, b, c, d) from 'config' instead
+ * of one of the IZHIKEVICH_PARAMETERS presets (used by sweeps and fitting).
+ *
+ * @param config Pointer to the parameter set (the 'type' field is ignored).
+ * @param dt The simulation time step (delta t) (in ms).
+ * @return A pointer to the allocated IzhikevichModel, or NULL if 'config'
+ * is NULL or memory allocation fails.
+ */
+IzhikevichModel* IzhikevichInitModelFromConfig(const IzhikevichConfig *config, const float dt);
+
 /**
  * @brief Sets the external current injected into the neuron.
  *
@@ -32,6 +45,15 @@ IzhikevichModel* IzhikevichInitModel(const IzNeuronType type, const float dt);
  */
 bool IzhikevichSetExternalCurrent(IzhikevichModel *model, float iExt);
 
+/**
+ * @brief Puts the neuron back into its initial state ('v' 10 mV below the
+ * reset potential 'c', 'u' = b * v).
+ *
+ * @param model Pointer to the Izhikevich model.
+ * @return true on success, false if the model pointer is NULL.
+ */
+bool IzhikevichResetState(IzhikevichModel *model);
+
 /**
  * @brief Advances the model simulation by one time step (dt).
  *
@@ -45,6 +67,25 @@ bool IzhikevichSetExternalCurrent(IzhikevichModel *model, float iExt);
  */
 float IzhikevichUpdateModel(IzhikevichModel *model);
 
+/**
+ * @brief Evaluates the sub-threshold derivatives for a batch of (v, u) points.
+ *
+ * Structure-of-arrays kernel without branches or pointer aliasing, so the
+ * compiler can vectorize it. Used for vector fields and population updates.
+ *
+ * @param v Array of membrane potentials.
+ * @param u Array of recovery values.
+ * @param dv Output array for dv/dt.
+ * @param du Output array for du/dt.
+ * @param n Number of points.
+ * @param a Time scale of the recovery variable.
+ * @param b Sensitivity of the recovery variable.
+ * @param current Total input current (same for every point).
+ */
+void IzhikevichDerivativesBatch(const float *restrict v, const float *restrict u,
+                                float *restrict dv, float *restrict du,
+                                int n, float a, float b, float current);
+
 /**
  * @brief Gets the current value of the recovery variable 'u'.
  *
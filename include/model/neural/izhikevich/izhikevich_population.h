@@ -0,0 +1,122 @@
+/**
+ * @file izhikevich_population.h
+ * @brief Structure-of-arrays population of Izhikevich neurons for network runs.
+ *
+ * Every state variable, parameter and current lives in its own contiguous
+ * array, so a range of neurons is updated with unit-stride loads and the
+ * population can be split across threads in contiguous chunks. Populations
+ * use the forward Euler scheme of Izhikevich (2003), which is the standard
+ * choice at network scale; the single-neuron model keeps its RK4 integrator.
+ *
+ * The parameters a, b, c, d are parameter columns (parameter_column.h):
+ * stored once while uniform, per neuron only once some neuron differs.
+ */
+#ifndef IZHIKEVICH_POPULATION_H
+#define IZHIKEVICH_POPULATION_H
+
+#include <stdbool.h>
+#include "model/neural/parameter_column.h"
+#include "model/neural/izhikevich/izhikevich_config.h"
+
+/** @brief Number of per-neuron arrays in 'buffer' (v, u, iExt, iSyn). */
+#define IZHIKEVICH_POPULATION_ARRAYS 4
+
+/**
+ * @struct IzhikevichPopulation
+ * @brief State, parameters and inputs of 'count' Izhikevich neurons.
+ *
+ * The state and input arrays point into one allocation ('buffer').
+ */
+typedef struct {
+    int count;
+    float *v;       ///< Membrane potential (mV)
+    float *u;       ///< Recovery variable
+    ParameterColumn a;
+    ParameterColumn b;
+    ParameterColumn c;
+    ParameterColumn d;
+    float *iExt;    ///< Constant external current per neuron
+    float *iSyn;    ///< Synaptic current delivered for the next step
+    float *buffer;
+} IzhikevichPopulation;
+
+/**
+ * @brief Allocates a population where every neuron uses the same parameters.
+ *
+ * Neurons start at v = c - 10 with u = b * v, like IzhikevichInitModel.
+ *
+ * @param count Number of neurons (> 0).
+ * @param config Parameters shared by all neurons.
+ * @return The population, or NULL on invalid arguments or allocation failure.
+ */
+IzhikevichPopulation *IzhikevichPopulationInit(int count, const IzhikevichConfig *config);
+
+/**
+ * @brief Overrides the parameters of one neuron and resets its state.
+ *
+ * Only the parameters that differ from a uniform column make it per neuron.
+ *
+ * @return false if 'index' is out of range or on allocation failure.
+ */
+bool IzhikevichPopulationSetNeuron(IzhikevichPopulation *pop, int index, const IzhikevichConfig *config);
+
+/**
+ * @brief Returns every parameter column whose values are all equal to uniform storage.
+ *
+ * Useful after overriding every neuron with the same values.
+ */
+void IzhikevichPopulationCompact(IzhikevichPopulation *pop);
+
+/**
+ * @brief Advances one neuron by one forward Euler step.
+ *
+ * Inline so that network loops can fuse their own per-neuron work (input
+ * bookkeeping, observables) into the same pass over the arrays.
+ *
+ * @param pop The population.
+ * @param i Neuron index.
+ * @param current Total input current for this step.
+ * @param dt Time step (ms).
+ * @return true if the neuron reached IZHIKEVICH_SPIKE_PEAK and was reset.
+ */
+static inline bool IzhikevichPopulationStepNeuron(IzhikevichPopulation *pop, int i, float current, float dt) {
+    const float v = pop->v[i];
+    const float u = pop->u[i];
+
+    const float vNext = v + dt * (0.04f * v * v + 5.0f * v + 140.0f - u + current);
+    const float uNext = u + dt * ParameterColumnGet(&pop->a, i) * (ParameterColumnGet(&pop->b, i) * v - u);
+
+    if (vNext >= IZHIKEVICH_SPIKE_PEAK) {
+        pop->v[i] = ParameterColumnGet(&pop->c, i);
+        pop->u[i] = uNext + ParameterColumnGet(&pop->d, i);
+        return true;
+    }
+
+    pop->v[i] = vNext;
+    pop->u[i] = uNext;
+    return false;
+}
+
+/**
+ * @brief Advances neurons [begin, end) by one step with input iExt + iSyn.
+ *
+ * Works in blocks of PARAMETER_BLOCK neurons: a branch-free Euler pass
+ * over the block, then a scan for neurons at the peak. iSyn is consumed
+ * (cleared) by the step.
+ *
+ * @param pop The population.
+ * @param begin First neuron.
+ * @param end One past the last neuron.
+ * @param dt Time step (ms).
+ * @param spikes Output: indices of the neurons that fired (room for end - begin).
+ * @param inputSum Accumulates the summed iSyn of the range (may be NULL).
+ * @return Number of neurons that fired.
+ */
+int IzhikevichPopulationStep(IzhikevichPopulation *pop, int begin, int end, float dt, int *spikes, double *inputSum);
+
+/**
+ * @brief Frees a population.
+ */
+void IzhikevichPopulationFree(IzhikevichPopulation *pop);
+
+#endif // IZHIKEVICH_POPULATION_H
@@ -7,6 +7,11 @@
 
 #include "utils/rk4.h"
 
+/** @brief Dimension of the system of ODEs (v, u) */
+#define IZHIKEVICH_SYS_DIM 2
+/** @brief Size of the internal buffer (a, b, c, d, Iext, Isyn) */
+#define IZHIKEVICH_INTERNAL_SIZE 6
+
 /**
  * @struct IzhikevichParams
  * @brief Pointers to the model parameters (a, b, c, d).
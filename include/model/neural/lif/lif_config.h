@@ -0,0 +1,56 @@
+/**
+ * @file lif_config.h
+ * @brief Defines the configuration structure and parameter sets for the
+ * leaky integrate-and-fire (LIF) neuron model.
+ */
+#ifndef LIF_CONFIG_H
+#define LIF_CONFIG_H
+
+/**
+ * @enum LifSynapseMode
+ * @brief How synaptic input enters the membrane equation.
+ */
+typedef enum {
+    LIF_CURRENT_BASED = 0,   ///< Exponentially decaying currents (pA)
+    LIF_CONDUCTANCE_BASED    ///< Exponentially decaying conductances (nS) with reversal potentials
+} LifSynapseMode;
+
+/**
+ * @enum LifNeuronType
+ * @brief Enumerates the preset parameter sets in LIF_PARAMETERS.
+ */
+typedef enum {
+    LIF_VOGELS_ABBOTT_COBA = 0,
+    LIF_VOGELS_ABBOTT_CUBA
+} LifNeuronType;
+
+/**
+ * @struct LifConfig
+ * @brief Parameters of a LIF neuron with exponential synapses.
+ *
+ * Units: capacitance in pF, conductances in nS, potentials in mV, times in
+ * ms and currents in pA (so that pA / pF = mV / ms).
+ */
+typedef struct {
+    float capacitance;
+    float leakConductance;
+    float leakReversal;
+    float threshold;
+    float resetPotential;
+    float refractoryPeriod;
+    float tauExcitatory;        ///< Decay time constant of excitatory input
+    float tauInhibitory;        ///< Decay time constant of inhibitory input
+    float excitatoryReversal;   ///< Used in conductance mode only
+    float inhibitoryReversal;   ///< Used in conductance mode only
+    LifSynapseMode mode;
+} LifConfig;
+
+/**
+ * @brief Array of preset configurations, indexed by LifNeuronType.
+ *
+ * Sourced from Vogels & Abbott (2005) as used in the benchmarks of
+ * Brette et al. (2007), "Simulation of networks of spiking neurons".
+ */
+extern const LifConfig LIF_PARAMETERS[];
+
+#endif // LIF_CONFIG_H
@@ -0,0 +1,154 @@
+/**
+ * @file lif_population.h
+ * @brief Structure-of-arrays population of leaky integrate-and-fire neurons.
+ *
+ * Between spikes the LIF equations are linear, so each step applies exact
+ * exponential propagators instead of a numerical integrator:
+ *
+ * - Current-based: the membrane and both exponential synaptic currents form
+ *   a linear system whose solution over one step is a fixed matrix
+ *   (Rotter & Diesmann, 1999). All its coefficients depend only on dt and
+ *   are computed once, so a step is a handful of multiply-adds.
+ * - Conductance-based: with the conductances replaced by their exact
+ *   average over the step, the membrane relaxes exponentially towards the
+ *   effective reversal potential with time constant C / g_total. This needs
+ *   one exp per neuron and is unconditionally stable.
+ *
+ * Refractoriness is a per-neuron countdown of steps during which the
+ * membrane is clamped at the reset potential.
+ */
+#ifndef LIF_POPULATION_H
+#define LIF_POPULATION_H
+
+#include <math.h>
+#include <stdbool.h>
+#include "model/neural/lif/lif_config.h"
+
+/** @brief Number of per-neuron float arrays in 'buffer' (v, excitatory, inhibitory, iExt). */
+#define LIF_POPULATION_FLOAT_ARRAYS 4
+
+/**
+ * @struct LifPropagators
+ * @brief Per-step coefficients derived from a LifConfig and dt.
+ */
+typedef struct {
+    float membraneDecay;      ///< exp(-dt / tau_m)
+    float excitatoryDecay;    ///< exp(-dt / tau_e)
+    float inhibitoryDecay;    ///< exp(-dt / tau_i)
+    float currentGain;        ///< Response to a constant current over one step (mV / pA)
+    float excitatoryGain;     ///< Response to a unit decaying excitatory current (current mode)
+    float inhibitoryGain;     ///< Response to a unit decaying inhibitory current (current mode)
+    float excitatoryMean;     ///< Step average of a unit decaying excitatory conductance
+    float inhibitoryMean;     ///< Step average of a unit decaying inhibitory conductance
+    int refractorySteps;
+} LifPropagators;
+
+/**
+ * @struct LifPopulation
+ * @brief State and inputs of 'count' LIF neurons sharing one LifConfig.
+ */
+typedef struct {
+    int count;
+    float dt;
+    LifConfig config;
+    LifPropagators prop;
+
+    float *v;              ///< Membrane potential (mV)
+    float *excitatory;     ///< Excitatory current (pA) or conductance (nS)
+    float *inhibitory;     ///< Inhibitory current (pA) or conductance (nS), >= 0
+    float *iExt;           ///< Constant external current (pA)
+    int *refractory;       ///< Remaining refractory steps
+    float *buffer;
+} LifPopulation;
+
+/**
+ * @brief Computes the step propagators of a configuration.
+ */
+void LifComputePropagators(const LifConfig *config, float dt, LifPropagators *prop);
+
+/**
+ * @brief Allocates a population at the leak reversal potential.
+ * @param count Number of neurons (> 0).
+ * @param config Parameters shared by all neurons.
+ * @param dt Time step (ms).
+ * @return The population, or NULL on invalid arguments or allocation failure.
+ */
+LifPopulation *LifPopulationInit(int count, const LifConfig *config, float dt);
+
+/**
+ * @brief Adds a synaptic event to one neuron.
+ *
+ * Positive weights increase the excitatory variable, negative weights the
+ * inhibitory one (by |weight|), in pA or nS depending on the mode.
+ */
+static inline void LifPopulationAddInput(LifPopulation *pop, int i, float weight) {
+    if (weight >= 0.0f) pop->excitatory[i] += weight;
+    else pop->inhibitory[i] -= weight;
+}
+
+/**
+ * @brief Advances one neuron by one exact step.
+ *
+ * @param pop The population.
+ * @param i Neuron index.
+ * @param current External current for this step (pA).
+ * @return true if the neuron crossed threshold (it is then reset and made
+ * refractory).
+ */
+static inline bool LifPopulationStepNeuron(LifPopulation *pop, int i, float current) {
+    const LifConfig *cfg = &pop->config;
+    const LifPropagators *p = &pop->prop;
+    const float ge = pop->excitatory[i];
+    const float gi = pop->inhibitory[i];
+
+    pop->excitatory[i] = ge * p->excitatoryDecay;
+    pop->inhibitory[i] = gi * p->inhibitoryDecay;
+
+    if (pop->refractory[i] > 0) {
+        pop->refractory[i]--;
+        pop->v[i] = cfg->resetPotential;
+        return false;
+    }
+
+    float v = pop->v[i];
+    if (cfg->mode == LIF_CURRENT_BASED) {
+        v = cfg->leakReversal + (v - cfg->leakReversal) * p->membraneDecay
+          + current * p->currentGain + ge * p->excitatoryGain - gi * p->inhibitoryGain;
+    } else {
+        const float geMean = ge * p->excitatoryMean;
+        const float giMean = gi * p->inhibitoryMean;
+        const float gTotal = cfg->leakConductance + geMean + giMean;
+        const float vInf = (cfg->leakConductance * cfg->leakReversal + geMean * cfg->excitatoryReversal
+                          + giMean * cfg->inhibitoryReversal + current) / gTotal;
+        v = vInf + (v - vInf) * expf(-pop->dt * gTotal / cfg->capacitance);
+    }
+
+    if (v >= cfg->threshold) {
+        pop->v[i] = cfg->resetPotential;
+        pop->refractory[i] = p->refractorySteps;
+        return true;
+    }
+
+    pop->v[i] = v;
+    return false;
+}
+
+/**
+ * @brief Advances neurons [begin, end) by one step with their iExt.
+ *
+ * @param pop The population.
+ * @param begin First neuron.
+ * @param end One past the last neuron.
+ * @param spikes Output: indices of the neurons that fired (room for end - begin).
+ * @param inputSum Accumulates the summed synaptic current of the range at
+ * the start of the step (pA, may be NULL).
+ * @return Number of neurons that fired.
+ */
+int LifPopulationStep(LifPopulation *pop, int begin, int end, int *spikes, double *inputSum);
+
+/**
+ * @brief Frees a population.
+ */
+void LifPopulationFree(LifPopulation *pop);
+
+#endif // LIF_POPULATION_H
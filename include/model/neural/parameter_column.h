@@ -0,0 +1,76 @@
+/**
+ * @file parameter_column.h
+ * @brief Per-neuron model parameters stored once when they are uniform.
+ *
+ * Populations keep each parameter in a column. A column starts uniform:
+ * one value, broadcast into a small block-sized buffer that stays in L1.
+ * It only allocates a per-neuron array when a neuron is given a different
+ * value, so homogeneous populations stream no parameter data at all, and
+ * mixed ones (e.g. Izhikevich (2003), where a and b are shared by the
+ * excitatory neurons but c and d are drawn per neuron) pay only for the
+ * parameters that actually vary.
+ *
+ * Kernels walk a range in blocks of PARAMETER_BLOCK neurons and fetch one
+ * unit-stride pointer per column and block, so the same loop body serves
+ * both storage forms without a per-neuron branch.
+ */
+#ifndef PARAMETER_COLUMN_H
+#define PARAMETER_COLUMN_H
+
+#include <stdbool.h>
+
+/** @brief Neurons per kernel block (length of the broadcast buffer). */
+#define PARAMETER_BLOCK 64
+
+/**
+ * @struct ParameterColumn
+ * @brief One parameter of a population, uniform or per neuron.
+ */
+typedef struct {
+    float *values;                        ///< Per-neuron values, or NULL while the column is uniform
+    float broadcast[PARAMETER_BLOCK];     ///< The uniform value, repeated (valid while 'values' is NULL)
+} ParameterColumn;
+
+/**
+ * @brief Initializes a uniform column.
+ */
+void ParameterColumnInit(ParameterColumn *column, float value);
+
+/**
+ * @brief Sets the value of one neuron, allocating the per-neuron array on
+ * the first value that differs from the uniform one.
+ * @param column The column.
+ * @param count Number of neurons of the population.
+ * @param index Neuron index.
+ * @param value The new value.
+ * @return false on allocation failure (the column is unchanged).
+ */
+bool ParameterColumnSet(ParameterColumn *column, int count, int index, float value);
+
+/**
+ * @brief Returns to uniform storage if every neuron holds the same value.
+ * @return true if the column is uniform after the call.
+ */
+bool ParameterColumnCompact(ParameterColumn *column, int count);
+
+/**
+ * @brief Returns the value of one neuron.
+ */
+static inline float ParameterColumnGet(const ParameterColumn *column, int index) {
+    return column->values ? column->values[index] : column->broadcast[0];
+}
+
+/**
+ * @brief Returns the values of neurons [begin, begin + PARAMETER_BLOCK) as a
+ * unit-stride array (the broadcast buffer when the column is uniform).
+ */
+static inline const float *ParameterColumnBlock(const ParameterColumn *column, int begin) {
+    return column->values ? column->values + begin : column->broadcast;
+}
+
+/**
+ * @brief Frees the per-neuron array of a column.
+ */
+void ParameterColumnFree(ParameterColumn *column);
+
+#endif // PARAMETER_COLUMN_H
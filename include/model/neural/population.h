@@ -0,0 +1,195 @@
+/**
+ * @file population.h
+ * @brief Uniform interface over the structure-of-arrays neuron populations.
+ *
+ * Network code holds a Population and never touches a concrete model, so
+ * the neuron model of a network is a configuration choice. Dispatch on the
+ * model happens once per range of neurons (or per synapse row), never per
+ * neuron, so the indirection is invisible next to the update itself.
+ */
+#ifndef POPULATION_H
+#define POPULATION_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "model/neural/izhikevich/izhikevich_population.h"
+#include "model/neural/lif/lif_population.h"
+#include "model/neural/adex/adex_population.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_implicit.h"
+
+/** @brief Most separate per-neuron allocations of any model (Izhikevich: state and four parameter columns). */
+#define POPULATION_MAX_REGIONS 5
+
+/**
+ * @enum PopulationModel
+ * @brief Neuron models available for populations.
+ */
+typedef enum {
+    POPULATION_IZHIKEVICH = 0,
+    POPULATION_LIF,
+    POPULATION_ADEX,
+    POPULATION_HODGKIN_HUXLEY        ///< Integrated with implicit BDF2 (stable at network time steps)
+} PopulationModel;
+
+/**
+ * @struct PopulationConfig
+ * @brief Selects a model and carries its parameters (only the selected one is read).
+ *
+ * Synaptic weights are interpreted in the units of the model: for
+ * Izhikevich a spike adds weight / dt to the target's current for one
+ * step (the charge of a 1 ms pulse, as in Izhikevich (2003) at dt = 1,
+ * independent of dt), and the same for HH in pA; pA or nS for LIF (by
+ * mode) and pA for AdEx.
+ */
+typedef struct {
+    PopulationModel model;
+    IzhikevichConfig izhikevich;
+    LifConfig lif;
+    AdexConfig adex;
+    HodgkinHuxleyParams hodgkinHuxley;
+} PopulationConfig;
+
+/**
+ * @struct Population
+ * @brief A population of one model. Exactly one of the model pointers is set.
+ */
+typedef struct {
+    PopulationModel model;
+    int count;
+    float dt;
+    IzhikevichPopulation *izhikevich;
+    LifPopulation *lif;
+    AdexPopulation *adex;
+    HodgkinHuxleyImplicitBatch *hodgkinHuxley;
+} Population;
+
+/**
+ * @brief Fills a config with the default preset of a model (Izhikevich
+ * regular spiking, Vogels-Abbott conductance-based LIF, Brette-Gerstner
+ * AdEx, HH_CONFIG).
+ */
+void PopulationConfigDefaults(PopulationConfig *config, PopulationModel model);
+
+/**
+ * @brief Allocates a population of 'count' neurons.
+ * @return The population, or NULL on invalid arguments or allocation failure.
+ */
+Population *PopulationCreate(const PopulationConfig *config, int count, float dt);
+
+/**
+ * @brief Advances neurons [begin, end) by one step.
+ *
+ * @param spikes Output: indices of the neurons that fired (room for end - begin).
+ * @param inputSum Accumulates the summed synaptic current of the range (may be NULL).
+ * @return Number of neurons that fired.
+ */
+int PopulationStep(Population *pop, int begin, int end, int *spikes, double *inputSum);
+
+/**
+ * @brief Delivers one row of synaptic events (targets[k] receives weights[k]).
+ */
+void PopulationDeliver(Population *pop, const int *targets, const float *weights, int count);
+
+/**
+ * @brief Bytes of dynamic state (variables, pending inputs, external
+ * current) of one neuron, i.e. everything a step reads besides the
+ * parameters.
+ */
+size_t PopulationStateBytes(const Population *pop);
+
+/**
+ * @brief Copies the dynamic state of neurons [begin, end) to 'out'
+ * ((end - begin) * PopulationStateBytes bytes, array by array).
+ */
+void PopulationSaveState(const Population *pop, int begin, int end, void *out);
+
+/**
+ * @brief Restores the dynamic state of neurons [begin, end) written by
+ * PopulationSaveState on a population of the same model.
+ */
+void PopulationLoadState(Population *pop, int begin, int end, const void *in);
+
+/**
+ * @struct PopulationMove
+ * @brief New copies of the per-neuron arrays of a population (state,
+ * inputs and per-neuron parameters), filled range by range.
+ *
+ * The new pages are untouched until a range is copied, so on Linux each
+ * neuron lands on the NUMA node of the thread that copies it: moving every
+ * range from the thread that updates it places the population next to
+ * its threads.
+ */
+typedef struct {
+    int count;                                  ///< Neurons of the population
+    int regionCount;                            ///< Separate allocations
+    void *from[POPULATION_MAX_REGIONS];         ///< Current allocations
+    void *to[POPULATION_MAX_REGIONS];           ///< New allocations
+    int blocks[POPULATION_MAX_REGIONS];         ///< Per-neuron arrays stored back to back in each allocation
+    size_t elementSize[POPULATION_MAX_REGIONS];
+} PopulationMove;
+
+/**
+ * @brief Allocates untouched copies of the per-neuron arrays (see
+ * MemoryAllocate for 'hugePages').
+ * @return false on allocation failure (nothing to undo).
+ */
+bool PopulationMoveBegin(const Population *pop, PopulationMove *move, bool hugePages);
+
+/**
+ * @brief Copies neurons [begin, end) to the new arrays (may run
+ * concurrently for disjoint ranges).
+ */
+void PopulationMoveRange(const PopulationMove *move, int begin, int end);
+
+/**
+ * @brief Frees the new arrays of a move that is abandoned.
+ */
+void PopulationMoveCancel(PopulationMove *move);
+
+/**
+ * @brief Switches the population to the new arrays and frees the old ones
+ * (every neuron must have been copied).
+ */
+void PopulationMoveEnd(Population *pop, const PopulationMove *move);
+
+/**
+ * @brief Returns the scratch space PopulationPermute needs (bytes).
+ */
+size_t PopulationPermuteBytes(const Population *pop);
+
+/**
+ * @brief Moves every neuron i to index destination[i] (state, inputs and
+ * per-neuron parameters alike).
+ * @param destination A permutation of [0, count).
+ * @param scratch At least PopulationPermuteBytes(pop) bytes.
+ */
+void PopulationPermute(Population *pop, const int *destination, void *scratch);
+
+/**
+ * @brief Returns the membrane potential array (count values, mV).
+ */
+float *PopulationPotential(const Population *pop);
+
+/**
+ * @brief Returns the external current array (count values, model units).
+ */
+float *PopulationExternalCurrent(const Population *pop);
+
+/**
+ * @brief Returns the value of the membrane potential at which a spike is
+ * registered (peak, threshold or cutoff), for display ranges.
+ */
+float PopulationSpikeLevel(const Population *pop);
+
+/**
+ * @brief Returns the neuron steps accepted without the solver converging
+ * (Newton steps of the implicit HH batch; 0 for the other models).
+ */
+long PopulationUnconvergedSteps(const Population *pop);
+
+/**
+ * @brief Frees a population.
+ */
+void PopulationFree(Population *pop);
+
+#endif // POPULATION_H
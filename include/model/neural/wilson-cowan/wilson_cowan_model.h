@@ -0,0 +1,90 @@
+/**
+ * @file wilson_cowan_model.h
+ * @brief Mean-field rate model of coupled neural populations (Wilson-Cowan).
+ *
+ * Each population k is described by its active fraction a_k in [0, 1]:
+ *
+ *   tau_k da_k/dt = -a_k + (1 - r_k a_k) S_k(sum_j W_kj a_j + P_k)
+ *
+ * with the logistic S(x) = 1 / (1 + exp(-g (x - theta))), optionally
+ * shifted by -1 / (1 + exp(g theta)) so that S(0) = 0 as in the original
+ * Wilson-Cowan formulation. The system is
+ * integrated with the shared RK4 integrator; a step costs a few dozen
+ * operations regardless of how many neurons the populations stand for.
+ */
+#ifndef WILSON_COWAN_MODEL_H
+#define WILSON_COWAN_MODEL_H
+
+#include <stdbool.h>
+#include "utils/rk4.h"
+
+/** @brief Maximum number of populations of a rate model. */
+#define RATE_MAX_POPULATIONS 8
+
+/**
+ * @struct RateModelConfig
+ * @brief Populations, coupling and inputs of a rate model.
+ */
+typedef struct {
+    int count;                                                ///< Number of populations
+    float tau[RATE_MAX_POPULATIONS];                          ///< Time constants (ms)
+    float refractory[RATE_MAX_POPULATIONS];                   ///< r_k (0 disables the refractory term)
+    float gain[RATE_MAX_POPULATIONS];                         ///< Sigmoid slope g_k
+    float threshold[RATE_MAX_POPULATIONS];                    ///< Sigmoid threshold theta_k
+    float maxRate[RATE_MAX_POPULATIONS];                      ///< Firing rate of a fully active population (Hz)
+    float weight[RATE_MAX_POPULATIONS][RATE_MAX_POPULATIONS]; ///< W[k][j]: input to k per unit activity of j
+    float input[RATE_MAX_POPULATIONS];                        ///< External input P_k
+    bool shiftedSigmoid;                                      ///< Subtract S at zero input (Wilson-Cowan form)
+} RateModelConfig;
+
+/**
+ * @struct RateModel
+ * @brief A running rate model.
+ */
+typedef struct {
+    RateModelConfig config;
+    float activity[RATE_MAX_POPULATIONS];   ///< a_k
+    float dt;                               ///< Time step (ms)
+    double time;                            ///< Simulated time (ms)
+    RK4 integrator;
+} RateModel;
+
+/**
+ * @brief Fills a config with the classic excitatory/inhibitory pair of
+ * Wilson & Cowan (1972) in its limit-cycle (oscillatory) regime.
+ *
+ * Population 0 is excitatory and population 1 inhibitory.
+ */
+void WilsonCowanConfigDefaults(RateModelConfig *config);
+
+/**
+ * @brief Evaluates the shifted Wilson-Cowan sigmoid.
+ */
+float WilsonCowanSigmoid(float x, float gain, float threshold);
+
+/**
+ * @brief Initializes a model with all populations silent.
+ *
+ * The integrator keeps a pointer into the model, so an initialized model
+ * must not be copied or moved.
+ *
+ * @return false on an invalid config or allocation failure.
+ */
+bool RateModelInit(RateModel *model, const RateModelConfig *config, float dt);
+
+/**
+ * @brief Advances the model by one RK4 step.
+ */
+void RateModelStep(RateModel *model);
+
+/**
+ * @brief Returns the firing rate of a population (Hz).
+ */
+float RateModelRate(const RateModel *model, int population);
+
+/**
+ * @brief Frees the integrator buffers.
+ */
+void RateModelFree(RateModel *model);
+
+#endif // WILSON_COWAN_MODEL_H
@@ -0,0 +1,97 @@
+/**
+ * @file benchmark.h
+ * @brief Common timing and reporting of the headless network benchmarks.
+ *
+ * Every benchmark workload fills a BenchmarkResult per run (one run per
+ * thread count) and the driver prints them as one table, so throughput
+ * figures of different workloads are directly comparable: wall time per
+ * simulated second, spikes per wall second and synaptic events (spike
+ * deliveries to one target) per wall second.
+ *
+ * Where the kernel exposes hardware counters (Linux perf events), runs
+ * also report the last-level cache misses of the simulation loop per
+ * synaptic event; elsewhere, or without permission, the column reads n/a.
+ */
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "simulation/network_reorder.h"
+
+/**
+ * @enum BenchmarkPlacement
+ * @brief Thread and memory placement of a network run (see NetworkPlace).
+ */
+typedef enum {
+    BENCHMARK_PLACE_NONE,       ///< Floating threads, state where the network was built
+    BENCHMARK_PLACE_PINNED,     ///< Pinned threads, state first-touched by its threads
+    BENCHMARK_PLACE_HUGE        ///< As PINNED, with transparent huge pages
+} BenchmarkPlacement;
+
+/** @brief Short names of the placements ("none", "pinned", "huge"). */
+extern const char *const BENCHMARK_PLACEMENT_NAMES[];
+
+/**
+ * @struct BenchmarkResult
+ * @brief Size and throughput of one benchmark run.
+ */
+typedef struct {
+    const char *name;       ///< Workload name
+    int processes;          ///< Processes of a distributed run (0 or 1 = single process)
+    int rank;               ///< Process that returned the result (> 0: a child rank, which reports nothing)
+    int threads;            ///< Update threads (per process)
+    BenchmarkPlacement placement;
+    NetworkReorderMode reorder;
+    int neurons;
+    long synapses;
+    double simulated;       ///< Simulated time (ms)
+    double buildTime;       ///< Wall time to build the network (s)
+    double wallTime;        ///< Wall time of the simulation loop (s)
+    long spikes;
+    long events;            ///< Synaptic events delivered
+    double rowSpread;       ///< NetworkRowSpread of the simulated network
+    long long cacheMisses;  ///< Cache misses of the simulation loop (< 0 if not measured)
+} BenchmarkResult;
+
+/**
+ * @brief Returns a monotonic wall-clock time (s).
+ */
+double BenchmarkNow(void);
+
+/**
+ * @brief Opens a disabled cache-miss counter for this process and the
+ * threads and processes it creates afterwards.
+ *
+ * Open it before the network (and its thread pool) is built.
+ *
+ * @return The counter, or -1 if hardware counters are unavailable.
+ */
+int BenchmarkCounterOpen(void);
+
+/**
+ * @brief Starts or stops counting (no-op on -1).
+ */
+void BenchmarkCounterEnable(int counter, bool enable);
+
+/**
+ * @brief Closes a counter and returns its total.
+ *
+ * Counts of inherited threads and processes are only added when they
+ * exit: call after the network is freed.
+ *
+ * @return The cache misses, or -1 if not measured.
+ */
+long long BenchmarkCounterClose(int counter);
+
+/**
+ * @brief Prints the column header of the result table.
+ */
+void BenchmarkPrintHeader(FILE *out);
+
+/**
+ * @brief Prints one result as a table row.
+ */
+void BenchmarkPrintResult(FILE *out, const BenchmarkResult *result);
+
+#endif // BENCHMARK_H
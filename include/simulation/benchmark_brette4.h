@@ -0,0 +1,61 @@
+/**
+ * @file benchmark_brette4.h
+ * @brief Benchmark 4 of Brette et al. (2007), simulated event by event.
+ *
+ * The CUBA network of benchmark_vogels_abbott.h (4000 LIF neurons, 80%
+ * excitatory, 2% connectivity, resting potential above threshold) with
+ * instantaneous synapses: each spike makes its targets' potentials jump by
+ * 0.25 mV (excitatory) or -2.25 mV (inhibitory) after a fixed delay. The
+ * network is run by EventNetwork (event_network.h), whose cost follows the
+ * spikes and synaptic events rather than neurons times steps.
+ *
+ * A run is valid when the activity is still present in its last 10% and
+ * the mean rate lies in 2-50 Hz, as for the clock-driven CUBA network it
+ * is compared with.
+ */
+#ifndef BENCHMARK_BRETTE4_H
+#define BENCHMARK_BRETTE4_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "simulation/benchmark.h"
+
+/**
+ * @struct Brette4Config
+ * @brief Size and run parameters of the workload.
+ */
+typedef struct {
+    int neurons;                ///< Total neurons (80% excitatory)
+    int synapsesPerNeuron;      ///< Expected in-degree (connection probability * neurons)
+    float delay;                ///< Synaptic delay (ms)
+    float duration;             ///< Simulated time (ms)
+    uint64_t seed;              ///< Seed of the connectivity and initial state
+} Brette4Config;
+
+/**
+ * @struct Brette4Result
+ * @brief Throughput and validation statistics of one run.
+ */
+typedef struct {
+    BenchmarkResult benchmark;
+    double excitatoryRate;      ///< Mean firing rate (Hz)
+    double inhibitoryRate;
+    double finalRate;           ///< Mean rate over the last 10% of the run (Hz)
+    long queueEvents;           ///< Events taken off the queue (spikes, arrivals and synaptic updates)
+    long deferredEvents;        ///< Threshold events queued again because inputs delayed the crossing
+    bool rateValid;             ///< Self-sustained activity at the expected rate
+} Brette4Result;
+
+/**
+ * @brief Fills a config with the original network: 4000 neurons, 2%
+ * connectivity, 0.1 ms delay, 1 s of simulated time.
+ */
+void Brette4Defaults(Brette4Config *config);
+
+/**
+ * @brief Builds and runs the workload (serial), measuring throughput and rates.
+ * @return false on invalid configs, allocation failure or a failed event queue.
+ */
+bool Brette4Run(const Brette4Config *config, Brette4Result *result);
+
+#endif // BENCHMARK_BRETTE4_H
@@ -0,0 +1,103 @@
+/**
+ * @file benchmark_izhikevich.h
+ * @brief The Izhikevich (2003) random cortical network as a reference workload.
+ *
+ * 80% excitatory neurons with a = 0.02, b = 0.2, c = -65 + 15 r^2,
+ * d = 8 - 6 r^2 and 20% inhibitory neurons with a = 0.02 + 0.08 r,
+ * b = 0.25 - 0.05 r, c = -65, d = 2 (r uniform per neuron), driven by
+ * thalamic noise of standard deviation 5 (excitatory) and 2 (inhibitory).
+ * Excitatory weights are uniform in [0, 0.5], inhibitory ones in [-1, 0].
+ *
+ * The original network is all-to-all on 1000 neurons. Here every neuron
+ * receives a fixed number of synapses (80% from excitatory sources), which
+ * is the original network at 1000 neurons and 1000 synapses and scales to
+ * 10^5 neurons and beyond. With fewer synapses the weights are scaled up
+ * so that the mean input per neuron is unchanged.
+ *
+ * The run validates the rhythm against the paper: the spectral peak of
+ * the population activity should lie in the alpha (~10 Hz) or gamma
+ * (~40 Hz) band (which one changes from seed to seed), and that band
+ * should hold clearly more power than under a flat spectrum. Runs shorter
+ * than IZHIKEVICH_2003_MIN_DURATION are too noisy to judge and are not
+ * validated.
+ */
+#ifndef BENCHMARK_IZHIKEVICH_H
+#define BENCHMARK_IZHIKEVICH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "simulation/network.h"
+#include "simulation/benchmark.h"
+
+/** @brief Synapses per neuron of the original network. */
+#define IZHIKEVICH_2003_SYNAPSES 1000
+
+/**
+ * @brief Shortest run whose rhythm is validated (ms): eight half-overlapping
+ * 512 ms segments of the activity spectrum.
+ */
+#define IZHIKEVICH_2003_MIN_DURATION 2304.0f
+
+/**
+ * @struct Izhikevich2003Config
+ * @brief Size and run parameters of the workload.
+ */
+typedef struct {
+    int neurons;                ///< Total neurons (80% excitatory)
+    int synapsesPerNeuron;      ///< In-degree (clamped to the network size)
+    float dt;                   ///< Time step (ms)
+    float duration;             ///< Simulated time (ms)
+    float excitatoryNoise;      ///< Thalamic input std, per sqrt(ms)
+    float inhibitoryNoise;
+    uint64_t seed;              ///< Seed of the parameters, connectivity and noise
+    int processes;              ///< Local processes sharing the run (see network_distributed.h)
+    BenchmarkPlacement placement; ///< Thread and memory placement
+    NetworkReorderMode reorder; ///< Locality pass after the build (see network_reorder.h)
+} Izhikevich2003Config;
+
+/**
+ * @struct Izhikevich2003Result
+ * @brief Throughput and validation statistics of one run.
+ */
+typedef struct {
+    BenchmarkResult benchmark;
+    double excitatoryRate;      ///< Mean firing rate (Hz)
+    double inhibitoryRate;
+    float peakFrequency;        ///< Dominant frequency of the population activity (Hz)
+    float alphaFraction;        ///< Share of the 2-100 Hz power in 8-13 Hz
+    float gammaFraction;        ///< Share of the 2-100 Hz power in 30-50 Hz
+    bool rhythmChecked;         ///< Run long enough for the rhythm to be judged
+    bool rhythmValid;           ///< Peak in alpha or gamma, with that band well above a flat spectrum
+} Izhikevich2003Result;
+
+/**
+ * @brief Fills a config with the original network: 1000 neurons, 1000
+ * synapses each, dt = 0.5 ms, IZHIKEVICH_2003_MIN_DURATION of simulated
+ * time (the paper shows 1 s, too short for a stable spectrum).
+ */
+void Izhikevich2003Defaults(Izhikevich2003Config *config);
+
+/**
+ * @brief Builds the network of a config.
+ * @param config The workload.
+ * @param threads Update threads (<= 0 for one per CPU).
+ * @return The network, or NULL on invalid configs or allocation failure.
+ */
+Network *Izhikevich2003Build(const Izhikevich2003Config *config, int threads);
+
+/**
+ * @brief Builds and runs the workload, measuring throughput and rhythm.
+ *
+ * Results do not depend on the thread or process count (the noise is
+ * drawn per chunk from streams seeded by the step and chunk indices).
+ *
+ * A distributed run (config->processes > 1) returns in every process;
+ * only the one with result->benchmark.rank 0 gets the results, and the
+ * caller should end the others (see NetworkJoin).
+ *
+ * @return false on invalid configs, allocation failure or a failed
+ * exchange between the processes.
+ */
+bool Izhikevich2003Run(const Izhikevich2003Config *config, int threads, Izhikevich2003Result *result);
+
+#endif // BENCHMARK_IZHIKEVICH_H
@@ -0,0 +1,125 @@
+/**
+ * @file benchmark_polychronization.h
+ * @brief The Izhikevich (2006) polychronization network as a stress test.
+ *
+ * 1000 Izhikevich neurons (80% regular spiking, 20% fast spiking), 100
+ * synapses each. Excitatory axons carry conduction delays spread evenly
+ * over 1-20 ms and reach any neuron; inhibitory ones have a 1 ms delay and
+ * reach excitatory neurons only. Excitatory weights follow spike-timing
+ * dependent plasticity. Each millisecond one random neuron receives a
+ * 20 pA thalamic pulse.
+ *
+ * The network exercises together what the plain Network never sees:
+ * - Delay buffers: the spikes of the last 20 ms are kept in a ring, and
+ *   each millisecond every one of them delivers the synapses whose delay
+ *   expires now (synapses are stored sorted by source, then delay).
+ * - Plasticity: additive STDP with exponential traces (tau 20 ms). A
+ *   presynaptic arrival depresses the synapse by the postsynaptic trace; a
+ *   postsynaptic spike potentiates each incoming synapse by the trace its
+ *   source had one delay earlier (kept in a ring of trace rows). Weight
+ *   changes accumulate in a derivative that is applied once per second,
+ *   as in the original.
+ *
+ * Each phase is timed separately (neuron update, spike delivery including
+ * the depression at arrival, plasticity) so the bottleneck is visible.
+ * The run is serial, like the reference implementation.
+ */
+#ifndef BENCHMARK_POLYCHRONIZATION_H
+#define BENCHMARK_POLYCHRONIZATION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "model/neural/izhikevich/izhikevich_population.h"
+#include "simulation/benchmark.h"
+
+/** @brief Maximum conduction delay of the original network (ms). */
+#define POLYCHRONIZATION_MAX_DELAY 20
+
+/** @brief Upper bound of the excitatory weights. */
+#define POLYCHRONIZATION_MAX_WEIGHT 10.0f
+
+/**
+ * @struct PolychronizationConfig
+ * @brief Size and run parameters of the workload.
+ */
+typedef struct {
+    int neurons;                ///< Total neurons (80% excitatory)
+    int synapsesPerNeuron;      ///< Out-degree
+    int maxDelay;               ///< Largest excitatory delay (ms)
+    float duration;             ///< Simulated time (ms, in steps of 1 ms)
+    uint64_t seed;              ///< Seed of the connectivity and thalamic input
+} PolychronizationConfig;
+
+/**
+ * @struct PolychronizationNetwork
+ * @brief Neurons, delay-sorted synapses, spike history and STDP traces.
+ *
+ * The synapses of source p with delay d (1..maxDelay) are
+ * [delayStart[p * maxDelay + d - 1], delayStart[p * maxDelay + d]).
+ * Excitatory sources come first, so the plastic synapses are the prefix
+ * [0, delayStart[excitatory * maxDelay]).
+ */
+typedef struct {
+    int neuronCount;
+    int excitatoryCount;
+    int maxDelay;
+    long time;                  ///< Completed steps (ms)
+    IzhikevichPopulation *neurons;
+
+    int *delayStart;            ///< neuronCount * maxDelay + 1 offsets
+    int *target;
+    float *weight;
+    float *derivative;          ///< Pending weight change, applied every second
+    int synapseCount;
+
+    int *incomingStart;         ///< neuronCount + 1 offsets of the excitatory synapses onto each neuron
+    int *incomingSynapse;       ///< Synapse index
+    int *incomingSource;
+    int *incomingDelay;
+
+    float *preTrace;            ///< (maxDelay + 1) rows of presynaptic traces, indexed by time
+    float *postTrace;           ///< Postsynaptic trace per neuron
+    int *fired;                 ///< (maxDelay + 1) rows of fired neurons, indexed by time
+    int *firedCount;            ///< Spikes per row of 'fired'
+} PolychronizationNetwork;
+
+/**
+ * @struct PolychronizationResult
+ * @brief Throughput, per-phase time and state of one run.
+ */
+typedef struct {
+    BenchmarkResult benchmark;
+    double neuronTime;          ///< Wall time in the neuron update (s)
+    double deliveryTime;        ///< Wall time delivering delayed spikes (s)
+    double plasticityTime;      ///< Wall time in traces, potentiation and weight updates (s)
+    double excitatoryRate;      ///< Mean firing rate (Hz)
+    double inhibitoryRate;
+    float meanWeight;           ///< Mean excitatory weight at the end
+    float saturatedFraction;    ///< Share of excitatory weights above 90% of the maximum
+    float depressedFraction;    ///< Share of excitatory weights below 10% of the maximum
+} PolychronizationResult;
+
+/**
+ * @brief Fills a config with the original network: 1000 neurons, 100
+ * synapses each, delays up to 20 ms, 10 s of simulated time.
+ */
+void PolychronizationDefaults(PolychronizationConfig *config);
+
+/**
+ * @brief Builds the network of a config (weights 6 / -5, all at rest).
+ * @return The network, or NULL on invalid configs or allocation failure.
+ */
+PolychronizationNetwork *PolychronizationBuild(const PolychronizationConfig *config);
+
+/**
+ * @brief Builds and runs the workload, timing each phase.
+ * @return false on invalid configs or allocation failure.
+ */
+bool PolychronizationRun(const PolychronizationConfig *config, PolychronizationResult *result);
+
+/**
+ * @brief Frees a network.
+ */
+void PolychronizationFree(PolychronizationNetwork *network);
+
+#endif // BENCHMARK_POLYCHRONIZATION_H
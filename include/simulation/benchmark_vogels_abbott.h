@@ -0,0 +1,99 @@
+/**
+ * @file benchmark_vogels_abbott.h
+ * @brief The COBA and CUBA benchmark networks of Brette et al. (2007).
+ *
+ * 4000 LIF neurons (80% excitatory) after Vogels & Abbott (2005), randomly
+ * connected with probability 2% and no external input: the activity is
+ * started by random initial potentials and conductances and sustains
+ * itself through recurrent excitation balanced by inhibition.
+ *
+ * - COBA: exponential conductances (tau 5 / 10 ms) with the AMPA (0 mV)
+ *   and GABA-A (-80 mV) reversal potentials, increments of 6 / 67 nS.
+ * - CUBA: exponential currents with the same time constants, increments
+ *   of 16.2 / -90 pA (the 1.62 / -9 mV jumps of the original).
+ *
+ * Each neuron's synaptic drive is the sum over all its synapses of one
+ * exponential per receptor, so the population keeps a single excitatory
+ * and inhibitory variable per neuron instead of one kinetic state per
+ * synapse. This is exact for the exponential kinetics of the benchmark.
+ *
+ * Larger networks keep the expected in-degree (80 synapses), so the
+ * dynamics stay those of the original while the size scales.
+ *
+ * A run is valid when the activity is still present in its last 10%, the
+ * mean rate lies in 2-50 Hz and the firing is irregular (mean ISI CV of at
+ * least 0.5), as in the asynchronous irregular state of the original
+ * (about 18 Hz for COBA and 5-6 Hz for CUBA here).
+ */
+#ifndef BENCHMARK_VOGELS_ABBOTT_H
+#define BENCHMARK_VOGELS_ABBOTT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "model/neural/lif/lif_config.h"
+#include "simulation/network.h"
+#include "simulation/benchmark.h"
+
+/** @brief Expected synapses per neuron of the original network (4000 x 2%). */
+#define VOGELS_ABBOTT_SYNAPSES 80
+
+/**
+ * @struct VogelsAbbottConfig
+ * @brief Size and run parameters of the workload.
+ */
+typedef struct {
+    LifNeuronType type;         ///< LIF_VOGELS_ABBOTT_COBA or LIF_VOGELS_ABBOTT_CUBA
+    int neurons;                ///< Total neurons (80% excitatory)
+    int synapsesPerNeuron;      ///< Expected in-degree (connection probability * neurons)
+    float dt;                   ///< Time step (ms)
+    float duration;             ///< Simulated time (ms)
+    uint64_t seed;              ///< Seed of the connectivity and initial state
+    int processes;              ///< Local processes sharing the run (see network_distributed.h)
+    BenchmarkPlacement placement; ///< Thread and memory placement
+    NetworkReorderMode reorder; ///< Locality pass after the build (see network_reorder.h)
+} VogelsAbbottConfig;
+
+/**
+ * @struct VogelsAbbottResult
+ * @brief Throughput and validation statistics of one run.
+ */
+typedef struct {
+    BenchmarkResult benchmark;
+    double excitatoryRate;      ///< Mean firing rate (Hz)
+    double inhibitoryRate;
+    double meanCv;              ///< Mean coefficient of variation of the inter-spike intervals
+    double finalRate;           ///< Mean rate over the last 10% of the run (Hz)
+    bool rateValid;             ///< Self-sustained, irregular activity at the expected rate
+} VogelsAbbottResult;
+
+/**
+ * @brief Fills a config with the original network: 4000 neurons, 2%
+ * connectivity, dt = 0.1 ms, 1 s of simulated time.
+ * @param type LIF_VOGELS_ABBOTT_COBA or LIF_VOGELS_ABBOTT_CUBA.
+ */
+void VogelsAbbottDefaults(VogelsAbbottConfig *config, LifNeuronType type);
+
+/**
+ * @brief Builds the network of a config, with its random initial state.
+ * @param config The workload.
+ * @param threads Update threads (<= 0 for one per CPU).
+ * @return The network, or NULL on invalid configs or allocation failure.
+ */
+Network *VogelsAbbottBuild(const VogelsAbbottConfig *config, int threads);
+
+/**
+ * @brief Builds and runs the workload, measuring throughput and rates.
+ *
+ * The run is deterministic: the network has no noise source, and spikes
+ * are delivered in a fixed order whatever the thread or process count.
+ *
+ * A distributed run (config->processes > 1) returns in every process;
+ * only the one with result->benchmark.rank 0 gets the results, and the
+ * caller should end the others (see NetworkJoin).
+ *
+ * @return false on invalid configs, allocation failure or a failed
+ * exchange between the processes.
+ */
+bool VogelsAbbottRun(const VogelsAbbottConfig *config, int threads, VogelsAbbottResult *result);
+
+#endif // BENCHMARK_VOGELS_ABBOTT_H
@@ -0,0 +1,150 @@
+/**
+ * @file checkpoint_format.h
+ * @brief On-disk layout shared by every checkpoint file.
+ *
+ * A checkpoint is a single versioned binary file: a fixed header followed
+ * by tagged chunks, each payload zero-padded to 8 bytes. The single-neuron
+ * simulation (simulation_checkpoint.h) and the networks
+ * (network_checkpoint.h) write their own sets of tags into the same
+ * format. Writers stream chunks into a temporary file that replaces the
+ * destination only once complete; readers map the file with mmap and
+ * copy chunk payloads straight into the live buffers.
+ */
+#ifndef CHECKPOINT_FORMAT_H
+#define CHECKPOINT_FORMAT_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/** @brief Magic bytes at the start of every checkpoint file. */
+#define CHECKPOINT_MAGIC "NLCK"
+
+/** @brief Current checkpoint format version. Bumped on incompatible changes. */
+#define CHECKPOINT_VERSION 1u
+
+/** @brief Alignment (in bytes) of every chunk payload inside the file. */
+#define CHECKPOINT_CHUNK_ALIGN 8
+
+/**
+ * @enum CheckpointChunkTag
+ * @brief Identifies the content of each chunk inside a checkpoint file.
+ *
+ * Unknown tags are skipped on restore, so new chunks can be appended
+ * without breaking older readers of the same version. Integer arrays are
+ * stored as int32.
+ */
+typedef enum {
+    CKPT_TAG_META                   = 1,  ///< CheckpointMeta: model selection, inputs and clock
+    CKPT_TAG_PLOT_AXES              = 2,  ///< PlotState: axis boundaries at save time
+    CKPT_TAG_MODEL_STATE            = 3,  ///< float[]: the model 'stateVector'
+    CKPT_TAG_MODEL_BUFFER           = 4,  ///< float[]: the model 'internalBuffer'
+    CKPT_TAG_HH_PARAMS              = 5,  ///< HodgkinHuxleyParams (HH model only)
+    CKPT_TAG_TRACES                 = 6,  ///< Vector2[]: recorded series up to the recording cursor
+    CKPT_TAG_STIMULUS               = 7,  ///< CheckpointStimulus: time-varying stimulus on top of the constant current
+    CKPT_TAG_NETWORK_META           = 8,  ///< CheckpointNetworkMeta: sizes, clock and signal accumulators
+    CKPT_TAG_NETWORK_GROUPS         = 9,  ///< CheckpointNetworkGroup[]: model and size of each group
+    CKPT_TAG_NETWORK_ORDER          = 10, ///< int[]: network order -> caller index
+    CKPT_TAG_NETWORK_STATE          = 11, ///< PopulationSaveState of every group, in group order
+    CKPT_TAG_NETWORK_SPIKE_TIMES    = 12, ///< float[]: 'lastSpike', then 'period'
+    CKPT_TAG_NETWORK_SYNAPSE_START  = 13, ///< int[]: row offsets of the synapse matrix
+    CKPT_TAG_NETWORK_SYNAPSE_TARGET = 14, ///< int[]: synapse targets local to their group
+    CKPT_TAG_NETWORK_SYNAPSE_WEIGHT = 15, ///< float[]: synapse weights
+    CKPT_TAG_NETWORK_SIGNALS        = 16, ///< float[]: the lfp, rate and synchrony rings
+    CKPT_TAG_NETWORK_SPIKES         = 17  ///< int[]: neurons that fired during the last step
+} CheckpointChunkTag;
+
+/** @brief One past the highest chunk tag this reader knows. */
+#define CHECKPOINT_TAG_COUNT (CKPT_TAG_NETWORK_SPIKES + 1)
+
+/**
+ * @struct CheckpointHeader
+ * @brief Fixed-size header at offset 0 of the file.
+ */
+typedef struct {
+    char magic[4];       ///< Always CHECKPOINT_MAGIC
+    uint32_t version;    ///< CHECKPOINT_VERSION of the writer
+    uint32_t chunkCount; ///< Number of chunks following the header
+    uint32_t reserved;   ///< Padding, keeps chunks 8-byte aligned
+} CheckpointHeader;
+
+/**
+ * @struct CheckpointChunkHeader
+ * @brief Header preceding each chunk payload.
+ *
+ * Payloads are zero-padded to a multiple of CHECKPOINT_CHUNK_ALIGN bytes
+ * so that arrays stay aligned when the file is mapped into memory.
+ */
+typedef struct {
+    uint32_t tag;      ///< A CheckpointChunkTag value
+    uint32_t reserved; ///< Padding
+    uint64_t size;     ///< Payload size in bytes (without padding)
+} CheckpointChunkHeader;
+
+/**
+ * @struct CheckpointMapping
+ * @brief A checkpoint file mapped read-only, with its chunks located by tag.
+ */
+typedef struct {
+    const uint8_t *base;                          ///< Start of the mapping
+    size_t size;                                  ///< File size (bytes)
+    const uint8_t *chunks[CHECKPOINT_TAG_COUNT];  ///< Payload of each known tag (NULL if absent)
+    uint64_t sizes[CHECKPOINT_TAG_COUNT];         ///< Payload size of each known tag (bytes)
+} CheckpointMapping;
+
+/**
+ * @brief Opens the temporary file of a checkpoint and writes its header.
+ *
+ * @param path Destination file path.
+ * @param chunkCount Number of chunks that will follow.
+ * @param tmpPath Receives the temporary file path.
+ * @param tmpSize Size of 'tmpPath' (bytes).
+ * @return The stream, or NULL on error.
+ */
+FILE *CheckpointCreate(const char *path, uint32_t chunkCount, char *tmpPath, size_t tmpSize);
+
+/**
+ * @brief Closes the temporary file and renames it over 'path' if every
+ * write succeeded; removes it otherwise.
+ *
+ * @param ok Whether all writes succeeded.
+ * @return true if the checkpoint is in place.
+ */
+bool CheckpointCommit(FILE *file, const char *tmpPath, const char *path, bool ok);
+
+/**
+ * @brief Writes one chunk (header, payload and alignment padding).
+ * @return true on success, false on I/O error.
+ */
+bool CheckpointWriteChunk(FILE *file, CheckpointChunkTag tag, const void *data, uint64_t size);
+
+/**
+ * @brief Writes the header of a chunk whose payload is streamed by the
+ * caller, which then ends it with CheckpointWritePadding.
+ * @return true on success, false on I/O error.
+ */
+bool CheckpointWriteChunkHeader(FILE *file, CheckpointChunkTag tag, uint64_t size);
+
+/**
+ * @brief Writes the zero padding after a payload of 'size' bytes.
+ * @return true on success, false on I/O error.
+ */
+bool CheckpointWritePadding(FILE *file, uint64_t size);
+
+/**
+ * @brief Maps a checkpoint file, validates its header and locates its chunks.
+ *
+ * @param path Checkpoint file path.
+ * @param mapping Receives the mapping (release with CheckpointUnmap).
+ * @return true on success, false if the file is missing, malformed or
+ * was written by an incompatible version.
+ */
+bool CheckpointMap(const char *path, CheckpointMapping *mapping);
+
+/**
+ * @brief Releases a mapping obtained from CheckpointMap.
+ */
+void CheckpointUnmap(CheckpointMapping *mapping);
+
+#endif // CHECKPOINT_FORMAT_H
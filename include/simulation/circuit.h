@@ -0,0 +1,103 @@
+/**
+ * @file circuit.h
+ * @brief Population-level description of a circuit that can be run either
+ * as a spiking network or as a Wilson-Cowan rate model.
+ *
+ * A Circuit lists populations (size, sign, drive) and block connectivity
+ * (connection probability and weight between every pair of populations).
+ * CircuitBuildNetwork instantiates it neuron by neuron; CircuitBuildRateModel
+ * collapses every population to one rate variable, with the mean-field
+ * coupling W_kj = p_kj * N_j * J_kj * (charge of one spike) * (rate of j),
+ * and a logistic per population that approximates its f-I curve under
+ * the population's input noise. Both
+ * representations report population rates in Hz, so a regime found with
+ * the rate model can be checked directly against the spiking network.
+ */
+#ifndef CIRCUIT_H
+#define CIRCUIT_H
+
+#include <stdbool.h>
+#include "utils/random.h"
+#include "simulation/network.h"
+#include "model/neural/wilson-cowan/wilson_cowan_model.h"
+
+/** @brief Maximum number of populations in a circuit. */
+#define CIRCUIT_MAX_POPULATIONS RATE_MAX_POPULATIONS
+
+/**
+ * @struct CircuitPopulation
+ * @brief One population of a circuit.
+ */
+typedef struct {
+    int size;                      ///< Number of neurons
+    bool inhibitory;               ///< Sign of the outgoing synapses
+    IzhikevichConfig izhikevich;   ///< Neuron parameters when the circuit uses Izhikevich neurons
+    float drive;                   ///< Mean external current
+    float noise;                   ///< Std of the external current noise, per sqrt(ms)
+
+    // Rate representation
+    float tau;                     ///< Time constant (ms)
+    float gain;                    ///< Logistic slope (per current unit)
+    float threshold;               ///< Logistic midpoint (current units)
+    float maxRate;                 ///< Rate at full activity (Hz)
+} CircuitPopulation;
+
+/**
+ * @struct Circuit
+ * @brief Populations, block connectivity and the neuron model of the spiking representation.
+ */
+typedef struct {
+    int count;
+    CircuitPopulation populations[CIRCUIT_MAX_POPULATIONS];
+    float probability[CIRCUIT_MAX_POPULATIONS][CIRCUIT_MAX_POPULATIONS]; ///< [target][source]
+    float weight[CIRCUIT_MAX_POPULATIONS][CIRCUIT_MAX_POPULATIONS];      ///< [target][source], magnitude
+    PopulationConfig neuron;       ///< Model of the spiking representation
+    float dt;                      ///< Time step of both representations (ms)
+    uint64_t seed;                 ///< Seed of the connectivity
+} Circuit;
+
+/**
+ * @brief Fills a circuit with a sparse version of the Izhikevich (2003)
+ * cortical network: 800 regular-spiking excitatory and 200 fast-spiking
+ * inhibitory neurons, 10% connectivity and thalamic noise. The logistic
+ * transfer functions are fitted to the f-I curves of the two neuron types
+ * under that noise.
+ */
+void CircuitDefaults(Circuit *circuit);
+
+/**
+ * @brief Returns the first neuron index of a population in the network representation.
+ */
+int CircuitPopulationOffset(const Circuit *circuit, int population);
+
+/**
+ * @brief Instantiates the spiking representation.
+ *
+ * Each neuron of population k receives round(p_kj * N_j) synapses from
+ * distinct random neurons of population j (fixed in-degree), drawn from
+ * the circuit seed.
+ *
+ * @param circuit The circuit.
+ * @param threads Update threads (<= 0 for one per CPU).
+ * @return The network, or NULL on invalid circuits or allocation failure.
+ */
+Network *CircuitBuildNetwork(const Circuit *circuit, int threads);
+
+/**
+ * @brief Writes the drive and a fresh noise sample into the external
+ * currents of every neuron. Call once before each NetworkStep.
+ */
+void CircuitApplyDrive(const Circuit *circuit, Network *network, Rng *rng);
+
+/**
+ * @brief Adds the spikes of the network's last step to per-population counters.
+ */
+void CircuitCountSpikes(const Circuit *circuit, const Network *network, long *counts);
+
+/**
+ * @brief Instantiates the rate representation.
+ * @return false on invalid circuits or allocation failure.
+ */
+bool CircuitBuildRateModel(const Circuit *circuit, RateModel *model);
+
+#endif // CIRCUIT_H
@@ -0,0 +1,202 @@
+/**
+ * @file network.h
+ * @brief Public interface for multi-threaded simulation of spiking networks.
+ *
+ * A Network is a set of structure-of-arrays populations (groups) plus a
+ * sparse synapse matrix in compressed-row form (one row of outgoing
+ * synapses per source neuron). Neurons may mix models and parameter
+ * presets: each distinct PopulationConfig becomes one group, groups are
+ * laid out contiguously (sorted by model), and every group runs its own
+ * model kernel over its range, so the update never branches on the model
+ * per neuron. Callers address neurons by their own indices; the network
+ * maps them to its grouped layout ('index' and 'order'), and stores
+ * synapse targets directly as (group, local index) so delivery needs no
+ * lookup.
+ *
+ * Each step advances the groups in fixed-size chunks (never spanning two
+ * groups) on a persistent thread pool; while a chunk walks its
+ * neurons it also accumulates the population observables (see
+ * population_signals.h), so the signals cost no extra pass over the model
+ * state. Each thread has a home range of chunks of about equal cost
+ * and helps the others once it is done (see network_partition.h).
+ * Spikes are then delivered serially in chunk order, which makes results
+ * independent of the number of threads.
+ *
+ * A spike adds the synaptic weight to the input of each target for the
+ * following step, in the units of the population model.
+ *
+ * A network can also be split across local processes (see
+ * network_distributed.h): each one then updates its own range of chunks
+ * and the spikes are exchanged every step.
+ */
+#ifndef NETWORK_H
+#define NETWORK_H
+
+#include <stdbool.h>
+#include "utils/parallel.h"
+#include "analysis/population_signals.h"
+#include "model/neural/population.h"
+
+/** @brief Neurons per work item of the parallel update. */
+#define NETWORK_CHUNK_SIZE 256
+
+/**
+ * @struct NetworkChunk
+ * @brief One contiguous range of neurons of one group and the results of its last update.
+ */
+typedef struct {
+    int group;                    ///< Group the range belongs to
+    int begin;                    ///< First neuron, in network order
+    int end;
+    int spikeCount;               ///< Spikes written at spikeBuffer[begin..]
+    PopulationPartial partial;    ///< Observables accumulated during the update
+    int synapses;                 ///< Synapses onto the range
+    double cost;                  ///< Estimated or measured cost per step (ns, see network_partition.h)
+    double sampled;               ///< Update time of the last sampled step (ns)
+} NetworkChunk;
+
+/**
+ * @struct Network
+ * @brief The neuron groups, their synapses, the thread pool and the online signals.
+ *
+ * Per-neuron arrays of the network (lastSpike, period) are in network
+ * order: group by group, caller indices ascending within a group unless
+ * the network was reordered (see network_reorder.h).
+ */
+typedef struct {
+    int neuronCount;
+    int groupCount;
+    Population **groups;          ///< One population per distinct config
+    int *groupStart;              ///< groupCount + 1 offsets of the groups in network order
+    int *index;                   ///< Caller index -> network order
+    int *order;                   ///< Network order -> caller index
+
+    int synapseCount;
+    int *synapseStart;            ///< Row offsets per (source in network order, target group): neuronCount * groupCount + 1
+    int *synapseTarget;           ///< Target index local to its group
+    float *synapseWeight;
+
+    float dt;                     ///< Time step (ms)
+    double time;                  ///< Simulated time (ms)
+    long step;                    ///< Steps taken
+
+    ParallelPool *pool;
+    int chunkCount;
+    NetworkChunk *chunks;
+    int chunkBegin;               ///< Chunks updated by this process: [chunkBegin, chunkEnd)
+    int chunkEnd;
+    int *chunkOrder;              ///< Chunks of this process by home thread, most expensive first within each home
+    int homeCount;                ///< Update threads with home chunks
+    int homeChunk[PARALLEL_MAX_THREADS + 1]; ///< Home chunks of update thread t: [homeChunk[t], homeChunk[t + 1])
+    bool placed;                  ///< Threads pinned and state moved next to them (NetworkPlace)
+    bool hugePages;               ///< Placed arrays use transparent huge pages
+    bool sampleCost;              ///< Whether the current step times the chunk updates
+    double deliveryCost;          ///< Moving average of the delivery time per step (ns)
+    int *spikeBuffer;             ///< Per-chunk spike scratch (indexed like the neurons)
+
+    int *spikes;                  ///< Neurons (caller indices) that fired during the last step, in network order
+    int spikeCount;
+
+    float *lastSpike;             ///< Time of each neuron's last spike (ms, < 0 if none)
+    float *period;                ///< Last inter-spike interval (ms, 0 if undefined)
+    int phaseStride;              ///< Steps between synchrony samples
+    bool samplePhase;             ///< Whether the current step samples phases
+
+    PopulationSignals signals;
+
+    struct NetworkDistribution *distribution; ///< Split across processes (NULL unless distributed)
+} Network;
+
+/**
+ * @brief Creates an unconnected network of identical neurons.
+ *
+ * @param neuronCount Number of neurons.
+ * @param config Model and parameters of every neuron.
+ * @param dt Time step (ms).
+ * @param threads Threads of the update pool (<= 0 for one per CPU).
+ * @return The network, or NULL on invalid arguments or allocation failure.
+ */
+Network *NetworkCreate(int neuronCount, const PopulationConfig *config, float dt, int threads);
+
+/**
+ * @brief Creates an unconnected network mixing several models or presets.
+ *
+ * @param neuronCount Number of neurons.
+ * @param configs The distinct neuron configurations.
+ * @param configCount Number of entries in 'configs'.
+ * @param configIndex Config of each neuron (caller index -> entry of 'configs').
+ * @param dt Time step (ms).
+ * @param threads Threads of the update pool (<= 0 for one per CPU).
+ * @return The network, or NULL on invalid arguments or allocation failure.
+ */
+Network *NetworkCreateMixed(int neuronCount, const PopulationConfig *configs, int configCount,
+                            const int *configIndex, float dt, int threads);
+
+/**
+ * @brief Finds the population holding a neuron.
+ * @param network The network.
+ * @param neuron Caller index of the neuron.
+ * @param local Output: index of the neuron within the returned population.
+ * @return The population, or NULL if 'neuron' is out of range.
+ */
+Population *NetworkNeuronPopulation(const Network *network, int neuron, int *local);
+
+/**
+ * @brief Replaces the synapses of a network with a list of (source, target, weight).
+ *
+ * Indices are caller indices. The list may be in any order; it is bucketed
+ * by source and target group into compressed rows, keeping the list order
+ * within each row.
+ *
+ * @return false on an out-of-range index or allocation failure (the
+ * previous synapses are kept).
+ */
+bool NetworkConnect(Network *network, const int *sources, const int *targets, const float *weights, int count);
+
+/**
+ * @brief Advances the network by one time step.
+ *
+ * After the call, network->spikes lists the neurons that fired and the
+ * step has been folded into network->signals.
+ *
+ * @return false if the spike exchange of a distributed network failed
+ * (see NetworkExchangeSpikes); the network must not be stepped again.
+ * Single-process steps always succeed.
+ */
+bool NetworkStep(Network *network);
+
+/**
+ * @brief Runs body(c, userData) for every chunk c of this process, each
+ * starting on the thread whose home holds the chunk (for per-neuron work
+ * besides the step, such as input generation, on the same cores and
+ * memory as the update).
+ */
+void NetworkRunChunks(Network *network, ParallelBody body, void *userData);
+
+/**
+ * @brief Pins the update threads to cores and moves the neuron state of
+ * every home range to memory first touched by its thread.
+ *
+ * Without this, the state is allocated and initialized by the building
+ * thread and so sits on a single NUMA node. Thread t of rank r runs on
+ * CPU number r * threads + t of the caller's affinity mask (see
+ * ParallelPoolPin); NetworkFree gives the caller its affinity back. The
+ * synapses are moved to memory touched by the calling thread, which
+ * delivers the spikes. When a rebalance changes the home ranges, the
+ * state is moved again. Call after the network is connected (and
+ * distributed, if it is).
+ *
+ * @param network The network.
+ * @param hugePages Back arrays of at least MEMORY_HUGE_PAGE with
+ * transparent huge pages (fewer TLB misses, placement per 2 MB).
+ * @return false if the threads could not be pinned or an array could not
+ * be moved (the network still runs, with that array where it was).
+ */
+bool NetworkPlace(Network *network, bool hugePages);
+
+/**
+ * @brief Frees a network and stops its thread pool.
+ */
+void NetworkFree(Network *network);
+
+#endif // NETWORK_H
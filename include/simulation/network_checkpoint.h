@@ -0,0 +1,85 @@
+/**
+ * @file network_checkpoint.h
+ * @brief Saving and restoring the state of a network.
+ *
+ * A network checkpoint (see checkpoint_format.h) holds everything a step
+ * reads or changes: the dynamic state of every group, the numbering
+ * ('order'), the synapse matrix (weights may have been changed by the
+ * caller since NetworkConnect), the spike times, the clock, the spikes of
+ * the last step and the online signals.
+ *
+ * Construction is not stored: the parameters, the time step and the
+ * signal bins come from the network restored into, which must be built
+ * with the same configurations (NetworkCreateMixed with the same
+ * arguments). Inputs driven from outside (noise streams of the
+ * benchmarks) are the caller's to resume.
+ */
+#ifndef NETWORK_CHECKPOINT_H
+#define NETWORK_CHECKPOINT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "simulation/network.h"
+#include "simulation/checkpoint_format.h"
+
+/**
+ * @struct CheckpointNetworkMeta
+ * @brief Sizes, clock and signal accumulators stored in the CKPT_TAG_NETWORK_META chunk.
+ */
+typedef struct {
+    int32_t neuronCount;
+    int32_t groupCount;
+    int32_t synapseCount;
+    int32_t spikeCount;      ///< Spikes of the last step
+    float dt;                ///< Time step (ms)
+    int32_t signalCapacity;  ///< Bins of the signal rings
+    int64_t step;            ///< Steps taken
+    double time;             ///< Simulated time (ms)
+    float binWidth;          ///< Signal bin width (ms)
+    int32_t signalTotal;     ///< Bins closed since the last reset
+    int32_t binSteps;        ///< Accumulators of the open bin (see PopulationSignals)
+    int32_t syncSamples;
+    int64_t binSpikes;
+    double binTime;
+    double lfpSum;
+    double syncSum;
+} CheckpointNetworkMeta;
+
+/**
+ * @struct CheckpointNetworkGroup
+ * @brief One entry of the CKPT_TAG_NETWORK_GROUPS chunk.
+ */
+typedef struct {
+    int32_t model;           ///< PopulationModel of the group
+    int32_t count;           ///< Neurons of the group
+    int32_t stateBytes;      ///< PopulationStateBytes of the group
+    int32_t reserved;        ///< Padding
+} CheckpointNetworkGroup;
+
+/**
+ * @brief Writes the state of a network to a checkpoint file.
+ *
+ * The write goes to a temporary file which is renamed over 'path' on
+ * success, so an interrupted save never corrupts an existing checkpoint.
+ *
+ * @return false if the network is distributed (no process holds all of
+ * its state) or on I/O error.
+ */
+bool NetworkCheckpointSave(const Network *network, const char *path);
+
+/**
+ * @brief Restores the state written by NetworkCheckpointSave into a
+ * network built with the same configurations.
+ *
+ * The network may have been connected or reordered differently: its
+ * synapses and numbering are replaced (per-neuron parameters follow
+ * their neurons), and the chunk costs restart from the estimate. Call
+ * before the network is distributed or placed. Nothing is changed unless
+ * the whole checkpoint is accepted.
+ *
+ * @return false if the file is missing or malformed, or does not match
+ * the network (sizes, group models, time step or signal bins).
+ */
+bool NetworkCheckpointRestore(Network *network, const char *path);
+
+#endif // NETWORK_CHECKPOINT_H
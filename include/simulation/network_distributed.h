@@ -0,0 +1,109 @@
+/**
+ * @file network_distributed.h
+ * @brief Running one network across several local processes.
+ *
+ * A single process eventually saturates the memory bandwidth of its
+ * socket. NetworkDistribute forks the calling process into several
+ * ranks (the program continues in all of them, SPMD style). Each rank
+ * owns a contiguous range of chunks of about equal cost (see
+ * network_partition.h) and delivers only along the synapses onto its own
+ * neurons. Every step it updates its chunks, then all ranks exchange
+ * their spikes, chunk observables and chunk costs through a
+ * SpikeTransport. Every rank then knows the full spike list and delivers
+ * it to its own targets.
+ *
+ * Since every rank holds the same costs, all of them compute the same new
+ * split when rebalancing; the state of the chunks that change owner is
+ * then exchanged in a second gather.
+ *
+ * The network has a fixed delay of one step, so the minimum delay, and
+ * hence the exchange interval, is one step. Gathered blocks are unpacked
+ * in rank order, which is chunk order, so spike lists, signals and every
+ * neuron's input are bitwise identical to a single-process run.
+ */
+#ifndef NETWORK_DISTRIBUTED_H
+#define NETWORK_DISTRIBUTED_H
+
+#include <stdbool.h>
+#include "simulation/network.h"
+#include "simulation/spike_transport.h"
+
+/** @brief Upper bound on the number of processes of one network. */
+#define NETWORK_MAX_PROCESSES 64
+
+/**
+ * @struct NetworkDistribution
+ * @brief The processes of a distributed network, as seen by one rank.
+ */
+typedef struct NetworkDistribution {
+    SpikeTransport *transport;    ///< Exchange with the other processes
+    unsigned char *block;         ///< Outgoing block of this process
+    int rank;                     ///< This process
+    int processCount;
+    int *processIds;              ///< Child process ids (rank 0 only)
+    int firstChunk[NETWORK_MAX_PROCESSES + 1]; ///< Chunk ranges of the ranks
+    long migrations;              ///< Rebalances that moved chunks
+
+    int synapseCount;             ///< The complete synapse matrix (the network keeps the rows onto its own chunks)
+    int *synapseStart;
+    int *synapseTarget;
+    float *synapseWeight;
+} NetworkDistribution;
+
+/**
+ * @brief Splits a connected network across 'processes' local processes.
+ *
+ * Call after the network is built, connected and initialized, and before
+ * the first step. Returns in every process. Rank 0 is the calling process
+ * and the only one that should report results; the caller ends the other
+ * ranks after NetworkJoin. The update pool is recreated in every rank
+ * with 'threads' threads.
+ *
+ * @param network The network.
+ * @param processes Number of processes, at most NETWORK_MAX_PROCESSES and
+ * the number of chunks (1 leaves the network untouched).
+ * @param threads Update threads per process (<= 0 for one per CPU).
+ * @return The rank of the calling process, or -1 on failure (no process
+ * was created and the network is unchanged).
+ */
+int NetworkDistribute(Network *network, int processes, int threads);
+
+/**
+ * @brief Ends a distributed run, in every rank.
+ *
+ * First aborts the exchange, so that ranks still waiting in a step (this
+ * one stopped early) fail instead of waiting forever. Every rank then gets
+ * the complete synapses back, but only its own part of the neuron state:
+ * the network can be read (spike-derived statistics are complete) and
+ * freed, but not stepped. Child ranks return at once and should then be
+ * ended by the caller (e.g. exit, with a non-zero status if their run
+ * failed); rank 0 waits for them to exit.
+ * Does nothing for a network that was never distributed.
+ *
+ * @return false in rank 0 if a child did not exit with status 0.
+ */
+bool NetworkJoin(Network *network);
+
+/**
+ * @brief Exchanges this step's spikes and chunk observables with the
+ * other ranks (called by NetworkStep after the update).
+ *
+ * Fills the spike lists, partials and costs of the chunks owned by other
+ * ranks and updates their lastSpike / period, as their owners did.
+ *
+ * @return false if the exchange failed (a rank died or aborted); the
+ * foreign chunks are then stale and the run cannot go on.
+ */
+bool NetworkExchangeSpikes(Network *network);
+
+/**
+ * @brief Recomputes the split of the chunks from their costs and, if it
+ * lowers the largest rank cost by NETWORK_REBALANCE_GAIN, moves the
+ * chunks that change owner (called by NetworkStep on every rank at the
+ * same step).
+ *
+ * @return false if the exchange of the moving chunks failed.
+ */
+bool NetworkRedistribute(Network *network);
+
+#endif // NETWORK_DISTRIBUTED_H
@@ -0,0 +1,90 @@
+/**
+ * @file network_partition.h
+ * @brief Cost model and load balancing of the network update.
+ *
+ * Neurons of different models cost very different amounts per step (an
+ * implicit HH neuron about sixty times an Izhikevich one), and the serial
+ * delivery grows with the synapses onto a neuron. Every chunk therefore
+ * carries a cost in nanoseconds per step: first an estimate from its
+ * model and incoming synapses, then a moving average of its measured
+ * update time plus its share of the delivery, sampled every
+ * NETWORK_COST_STRIDE steps.
+ *
+ * The costs balance two levels:
+ *  - each update thread has a home range of contiguous chunks of about
+ *    equal cost, which it runs most expensive first before helping the
+ *    other threads, so a step ends on cheap chunks and no thread waits long
+ *    at the end-of-step barrier. Homes keep a thread on the same data
+ *    (caches, NUMA placement) and only change when that clearly helps;
+ *  - processes own contiguous ranges of chunks with the smallest largest
+ *    total cost. Every NETWORK_REBALANCE_STEPS steps the ranks recompute
+ *    the split from the measured costs and move the chunks that change
+ *    owner (see network_distributed.h).
+ *
+ * Only the schedule depends on timings: results stay bitwise identical.
+ */
+#ifndef NETWORK_PARTITION_H
+#define NETWORK_PARTITION_H
+
+#include "simulation/network.h"
+
+/** @brief Steps between two timings of the chunk updates. */
+#define NETWORK_COST_STRIDE 8
+
+/** @brief Weight of a new timing in the moving average of a chunk's cost. */
+#define NETWORK_COST_SMOOTHING 0.25
+
+/** @brief Steps between two rebalances. */
+#define NETWORK_REBALANCE_STEPS 500
+
+/** @brief Minimum relative drop of the largest process cost for chunks to be moved. */
+#define NETWORK_REBALANCE_GAIN 0.05
+
+/**
+ * @brief Estimated update cost of one neuron per step (ns), by
+ * PopulationModel, measured on a single core at dt = 0.1 ms.
+ */
+extern const double NETWORK_MODEL_COST[POPULATION_HODGKIN_HUXLEY + 1];
+
+/**
+ * @brief Returns a monotonic time stamp (ns).
+ */
+double NetworkCostClock(void);
+
+/**
+ * @brief Counts the synapses onto every chunk and resets the chunk costs
+ * to the estimate (model cost plus delivery at an assumed firing rate).
+ */
+void NetworkEstimateCosts(Network *network);
+
+/**
+ * @brief Folds the timings of a sampled step into the chunk costs of this
+ * process (called by NetworkStep when network->sampleCost is set).
+ */
+void NetworkUpdateCosts(Network *network);
+
+/**
+ * @brief Splits the chunks [begin, end) into 'parts' contiguous ranges (at
+ * least one chunk each) minimizing the largest total cost.
+ * @param firstChunk Output: parts + 1 range boundaries.
+ */
+void NetworkPartitionChunks(const Network *network, int begin, int end, int parts, int *firstChunk);
+
+/**
+ * @brief Whether the split 'next' beats 'current' by NETWORK_REBALANCE_GAIN.
+ */
+bool NetworkSplitImproves(const Network *network, const int *current, const int *next, int parts);
+
+/**
+ * @brief Assigns the chunks of this process to the update threads
+ * (network->homeChunk) and sorts each home by decreasing cost into
+ * network->chunkOrder.
+ *
+ * The homes are recomputed when the chunks of the process or the pool
+ * size changed, or when a new split improves on them.
+ *
+ * @return true if the homes changed.
+ */
+bool NetworkAssignChunks(Network *network);
+
+#endif // NETWORK_PARTITION_H
@@ -0,0 +1,126 @@
+/**
+ * @file parameter_sweep.h
+ * @brief Public interface for parameter sweeps over headless runs.
+ *
+ * A sweep varies up to two parameters of a base RunSpec over a regular
+ * grid and collects the RunMetrics (and optionally a decimated voltage
+ * trace) of every grid point. Per-point results are memoized in an
+ * on-disk key/value cache indexed by a hash of the model, parameters,
+ * stimulus, dt, duration and integrator, so re-running or refining a grid
+ * only simulates the points that were never computed before.
+ */
+#ifndef PARAMETER_SWEEP_H
+#define PARAMETER_SWEEP_H
+
+#include <stdbool.h>
+#include "simulation/simulation_run.h"
+
+/** @brief Cache sub-directory (under DISK_CACHE_ROOT) for sweep points. */
+#define SWEEP_CACHE_DIR "sweep"
+
+/** @brief Maximum number of swept parameters (grid dimensions). */
+#define SWEEP_MAX_AXES 2
+
+/**
+ * @enum SweepParameter
+ * @brief Parameters of a RunSpec that can be swept.
+ */
+typedef enum {
+    SWEEP_PARAM_CURRENT = 0, ///< externCurrent
+    SWEEP_PARAM_IZ_A,        ///< Izhikevich 'a'
+    SWEEP_PARAM_IZ_B,        ///< Izhikevich 'b'
+    SWEEP_PARAM_IZ_C,        ///< Izhikevich 'c'
+    SWEEP_PARAM_IZ_D,        ///< Izhikevich 'd'
+    SWEEP_PARAM_HH_GNA,      ///< HH sodium conductance
+    SWEEP_PARAM_HH_GK,       ///< HH potassium conductance
+    SWEEP_PARAM_HH_GL        ///< HH leak conductance
+} SweepParameter;
+
+/**
+ * @struct SweepAxis
+ * @brief One grid dimension: 'steps' evenly spaced values in [min, max].
+ *
+ * Values are computed in double precision and rounded to a power of ten
+ * of about a millionth of the span, so that grids sharing a point (a
+ * refinement, or an overlapping range) give it the same cache key.
+ */
+typedef struct {
+    SweepParameter param;
+    float min;
+    float max;
+    int steps;
+} SweepAxis;
+
+/**
+ * @struct SweepConfig
+ * @brief Description of a complete sweep.
+ */
+typedef struct {
+    RunSpec base;                    ///< Values of every non-swept parameter
+    SweepAxis axes[SWEEP_MAX_AXES];  ///< Swept parameters (first axis varies slowest)
+    int numAxes;                     ///< 1 or 2
+    int traceLength;                 ///< Decimated trace samples per point (0 = metrics only)
+    bool useCache;                   ///< Read and write the on-disk memoization cache
+} SweepConfig;
+
+/**
+ * @struct SweepPoint
+ * @brief Result of one grid point.
+ */
+typedef struct {
+    float values[SWEEP_MAX_AXES]; ///< Swept parameter values of this point
+    RunMetrics metrics;           ///< Response metrics
+    bool fromCache;               ///< true if the result was memoized
+} SweepPoint;
+
+/**
+ * @struct SweepResult
+ * @brief All points of a sweep, in grid order.
+ */
+typedef struct {
+    int count;          ///< Number of points
+    int cacheHits;      ///< Number of points loaded from the cache
+    int traceLength;    ///< Samples per trace (0 if no traces)
+    SweepPoint *points; ///< 'count' points
+    float *traces;      ///< 'count * traceLength' samples, or NULL
+} SweepResult;
+
+/**
+ * @brief Fills a SweepConfig with defaults for the given model.
+ *
+ * The base spec is RunSpecDefaults with warm start on: every point starts
+ * from the cached steady state at its own input, or from the reset state
+ * where that does not converge (above threshold), instead of settling
+ * from scratch. One axis sweeps the current over [0, 10] in 11 steps,
+ * without traces, through the memoization cache.
+ *
+ * @param config Output config.
+ * @param neuronModel The model to sweep.
+ */
+void SweepConfigDefaults(SweepConfig *config, NeuronModel neuronModel);
+
+/**
+ * @brief Applies a swept parameter value to a RunSpec.
+ * @param spec The spec to modify.
+ * @param param The parameter to set.
+ * @param value The new value.
+ */
+void SweepApplyParameter(RunSpec *spec, SweepParameter param, float value);
+
+/**
+ * @brief Runs (or recalls from the cache) every point of the sweep grid.
+ *
+ * @param config Pointer to the sweep description.
+ * @param result Output result; release with ParameterSweepFree.
+ * @return true on success, false on invalid config, allocation failure or
+ * if any run fails.
+ */
+bool ParameterSweepRun(const SweepConfig *config, SweepResult *result);
+
+/**
+ * @brief Frees the buffers of a SweepResult.
+ * @param result The result to release.
+ */
+void ParameterSweepFree(SweepResult *result);
+
+#endif // PARAMETER_SWEEP_H
@@ -0,0 +1,79 @@
+/**
+ * @file simulation_checkpoint.h
+ * @brief Public interface for saving and restoring the full simulation state.
+ *
+ * The checkpoint (see checkpoint_format.h) holds the model selection,
+ * inputs, stimulus, runtime clock, model state vectors, parameters,
+ * recording cursor and recorded traces. Restoring maps the file with
+ * mmap and copies each chunk straight into the live buffers, so a long
+ * run can be paused, resumed later, or branched from a warmed-up state.
+ * Networks are checkpointed separately (see network_checkpoint.h).
+ */
+#ifndef SIMULATION_CHECKPOINT_H
+#define SIMULATION_CHECKPOINT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "app_state.h"
+#include "simulation/checkpoint_format.h"
+
+/** @brief Default file used by the GUI shortcuts (F5 save / F9 restore). */
+#define CHECKPOINT_DEFAULT_PATH "neurolab.ckpt"
+
+/**
+ * @struct CheckpointMeta
+ * @brief Scalar simulation state stored in the CKPT_TAG_META chunk.
+ */
+typedef struct {
+    int32_t neuronModel;    ///< NeuronModel of the saved run
+    int32_t izhikevichType; ///< IzNeuronType of the saved run
+    float externCurrent;    ///< Stimulus level at save time
+    float ampaConductancy;
+    float gabaaConductancy;
+    float currentTime;      ///< Simulated time (ms)
+    float dt;               ///< Time step the state was produced with (ms)
+    int32_t dataCount;      ///< Recording cursor (number of recorded points)
+} CheckpointMeta;
+
+/**
+ * @struct CheckpointStimulus
+ * @brief Stimulus settings stored in the CKPT_TAG_STIMULUS chunk.
+ *
+ * The ZAP phase follows from the restored clock. A checkpoint without
+ * this chunk predates it and restores with the ZAP stimulus off.
+ */
+typedef struct {
+    int32_t zapEnabled;     ///< Whether the ZAP stimulus was applied
+    float zapAmplitude;     ///< ZapConfig of the saved run
+    float zapStart;
+    float zapEnd;
+    float zapDuration;
+} CheckpointStimulus;
+
+/**
+ * @brief Writes the complete simulation state to a checkpoint file.
+ *
+ * The write goes to a temporary file which is renamed over 'path' on
+ * success, so an interrupted save never corrupts an existing checkpoint.
+ *
+ * @param ctx Pointer to the global AppContext.
+ * @param path Destination file path.
+ * @return true on success, false if no model is active or on I/O error.
+ */
+bool SimulationCheckpointSave(const AppContext *ctx, const char *path);
+
+/**
+ * @brief Restores a simulation state previously written by SimulationCheckpointSave.
+ *
+ * The current run is reset, the saved model is re-created and every chunk
+ * is copied from the memory-mapped file into the live buffers. The
+ * simulation is left paused so it can be resumed with CONTINUE.
+ *
+ * @param ctx Pointer to the global AppContext.
+ * @param path Checkpoint file path.
+ * @return true on success, false if the file is missing, malformed or
+ * was written by an incompatible version.
+ */
+bool SimulationCheckpointRestore(AppContext *ctx, const char *path);
+
+#endif // SIMULATION_CHECKPOINT_H
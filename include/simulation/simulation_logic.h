@@ -23,6 +23,17 @@
  */
 void SimulationUpdate(AppContext *ctx);
 
+/**
+ * @brief Starts a new run of the selected neuron model.
+ *
+ * Resets the simulation, creates the model selected in the GUI and, when
+ * warm start is enabled, moves it to the cached settled state for the
+ * current input (see steady_state_cache.h) before the first step.
+ *
+ * @param ctx Pointer to the global AppContext.
+ */
+void SimulationStart(AppContext *ctx);
+
 /**
  * @brief Resets the simulation state to its default values.
  *
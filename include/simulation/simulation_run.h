@@ -0,0 +1,144 @@
+/**
+ * @file simulation_run.h
+ * @brief Public interface for headless (GUI-less) single-neuron runs.
+ *
+ * A RunSpec fully describes one independent simulation: model, parameter
+ * set, constant stimulus, time step, integrator and duration. Running it
+ * produces spike metrics and, optionally, a decimated voltage trace. This
+ * is the building block of sweeps, threshold searches and fitting.
+ */
+#ifndef SIMULATION_RUN_H
+#define SIMULATION_RUN_H
+
+#include <stdbool.h>
+#include "model/neural/neuron_models.h"
+#include "model/neural/izhikevich/izhikevich_config.h"
+#include "model/neural/izhikevich/izhikevich_struct.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_struct.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_implicit.h"
+
+/**
+ * @enum RunIntegrator
+ * @brief Numerical scheme used to advance the model.
+ *
+ * The implicit schemes are available for the HH model only; they stay
+ * stable at steps where RK4 blows up (see hodgkin_huxley_implicit.h).
+ */
+typedef enum {
+    RUN_INTEGRATOR_RK4 = 0,          ///< Explicit 4th-order Runge-Kutta (utils/rk4.h)
+    RUN_INTEGRATOR_BACKWARD_EULER,   ///< Implicit backward Euler with Newton iterations
+    RUN_INTEGRATOR_BDF2              ///< Implicit second-order BDF with Newton iterations
+} RunIntegrator;
+
+/**
+ * @struct RunSpec
+ * @brief Complete description of one headless run.
+ */
+typedef struct {
+    NeuronModel neuronModel;        ///< Which model to simulate
+    IzhikevichConfig izParams;      ///< (a, b, c, d) when neuronModel == IZHIKEVICH_MODEL
+    HodgkinHuxleyParams hhParams;   ///< Parameters when neuronModel == HODGKIN_HUXLEY_MODEL
+    RunIntegrator integrator;       ///< Integration scheme
+    float externCurrent;            ///< Constant injected current
+    float dt;                       ///< Time step (ms)
+    float duration;                 ///< Simulated time after the (optional) warm start (ms)
+    bool warmStart;                 ///< Start from the cached settled state
+    bool stepFromRest;              ///< Settle at zero input, then step to 'externCurrent' at t = 0
+} RunSpec;
+
+/**
+ * @struct RunMetrics
+ * @brief Summary of the response of one run.
+ */
+typedef struct {
+    int spikeCount;          ///< Number of spikes in 'duration'
+    float firingRate;        ///< Mean firing rate (Hz)
+    float firstSpikeTime;    ///< Time of the first spike (ms), or -1 if none
+    float lastSpikeTime;     ///< Time of the last spike (ms), or -1 if none
+    float meanPotential;     ///< Mean membrane potential (mV)
+    float minPotential;      ///< Minimum membrane potential (mV)
+    float maxPotential;      ///< Maximum membrane potential (mV)
+} RunMetrics;
+
+/** @brief Upper bound on RunNeuron::stateSize across all supported models. */
+#define RUN_MAX_STATE_SIZE 8
+
+/**
+ * @struct RunNeuron
+ * @brief A live headless neuron built from a RunSpec and advanced step by step.
+ *
+ * Used by analyses that intervene during a run (current pulses, state
+ * snapshots) instead of only collecting RunMetrics. The full dynamic
+ * state is 'state' plus 'potential'; copying both between two neurons
+ * built from the same spec clones the run.
+ */
+typedef struct {
+    NeuronModel neuronModel;
+    IzhikevichModel *izModel;       ///< Owned model when neuronModel == IZHIKEVICH_MODEL
+    HodgkinHuxleyModel *hhModel;    ///< Owned model when neuronModel == HODGKIN_HUXLEY_MODEL (RK4)
+    HodgkinHuxleyImplicitBatch *hhImplicit; ///< Owned single-neuron batch for the implicit HH schemes
+    float *state;                   ///< The model 'stateVector'
+    int stateSize;                  ///< Number of floats in 'state'
+    float potential;                ///< Membrane potential after the last step (mV)
+    float dt;                       ///< Time step (ms)
+} RunNeuron;
+
+/**
+ * @brief Fills a RunSpec with the defaults of the given model.
+ *
+ * Izhikevich runs use the REGULAR_SPIKING preset, HH runs use HH_CONFIG.
+ * The current is zero, dt is K_DT, the duration 500 ms and warm start off
+ * (when enabled, the model is settled at the stimulus, not stepped from rest).
+ * Sweeps and rheobase searches turn it on (SweepConfigDefaults,
+ * RheobaseConfigDefaults).
+ *
+ * @param spec Output spec.
+ * @param neuronModel The model to describe.
+ */
+void RunSpecDefaults(RunSpec *spec, NeuronModel neuronModel);
+
+/**
+ * @brief Simulates one RunSpec without touching any global state.
+ *
+ * Safe to call concurrently from several threads (each call owns its model).
+ *
+ * @param spec Pointer to the run description.
+ * @param metrics Output metrics.
+ * @param trace Optional output buffer for the decimated voltage trace
+ * (may be NULL).
+ * @param traceLength Number of samples to write to 'trace', evenly spaced
+ * over 'duration'.
+ * @return true on success, false on invalid spec or allocation failure.
+ */
+bool SimulationRunHeadless(const RunSpec *spec, RunMetrics *metrics, float *trace, int traceLength);
+
+/**
+ * @brief Builds the model of a RunSpec, applies its stimulus and settles it
+ * if 'warmStart' is set.
+ * @param neuron Output neuron.
+ * @param spec Pointer to the run description.
+ * @return true on success, false on invalid spec or allocation failure.
+ */
+bool RunNeuronInit(RunNeuron *neuron, const RunSpec *spec);
+
+/**
+ * @brief Advances the neuron by one time step.
+ * @param neuron Pointer to the neuron.
+ * @return true if a spike occurred during the step.
+ */
+bool RunNeuronStep(RunNeuron *neuron);
+
+/**
+ * @brief Changes the injected current from the next step on.
+ * @param neuron Pointer to the neuron.
+ * @param current The new current.
+ */
+void RunNeuronSetCurrent(RunNeuron *neuron, float current);
+
+/**
+ * @brief Releases the model owned by a RunNeuron.
+ * @param neuron Pointer to the neuron.
+ */
+void RunNeuronFree(RunNeuron *neuron);
+
+#endif // SIMULATION_RUN_H
@@ -5,6 +5,7 @@
 #include "model/neural/neuron_models.h"
 #include "model/neural/izhikevich/izhikevich_model.h"
 #include "model/neural/hodgkin-huxley/hodgkin_huxley_model.h"
+#include "analysis/spectrum.h"
 
 // Defines the total simulation duration (Duration = (K_MAX_PLOT_POINTS - 1) * K_DT).
 #define K_MAX_PLOT_POINTS 50001
@@ -43,7 +44,7 @@ typedef struct {
 
     // Common plots
     Vector2 membranePotential[K_MAX_PLOT_POINTS];
-    Vector2 phase[K_MAX_PLOT_POINTS]; ///< (IZ: v vs u)
+    Vector2 phase[K_MAX_PLOT_POINTS]; ///< (IZ: v vs u, HH: V vs n)
 
     // HH-specific plots
     HodgkinHuxleyGatePlots hhGatePlots;
@@ -60,6 +61,9 @@ typedef struct {
     float externCurrent;
     float ampaConductancy;
     float gabaaConductancy;
+    bool warmStart; ///< Start new runs from the cached settled state (skips the transient).
+    bool zapEnabled; ///< Add the ZAP (chirp) stimulus on top of 'externCurrent'.
+    ZapConfig zap;   ///< The ZAP stimulus used when 'zapEnabled' is set.
 } SimulationInputs;
 
 /**
@@ -89,6 +93,7 @@ typedef struct {
     SimulationInputs inputs;
     SimulationRuntime runtime;
     SimulationPlotData plotData;
+    SpectrumEstimator spectrum; ///< Live V(t) power spectrum and impedance, fed every step.
 } SimulationState;
 
 #endif // SIMULATION_STATE_H
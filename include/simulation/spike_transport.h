@@ -0,0 +1,100 @@
+/**
+ * @file spike_transport.h
+ * @brief Exchange of per-interval data blocks between the processes of a
+ * distributed network run.
+ *
+ * The only collective a partitioned network needs is an all-gather: once
+ * per exchange interval every process contributes one block (its spikes
+ * and observables) and receives the blocks of all processes in rank
+ * order. A transport implements that one operation, so the partitioning
+ * and the network code do not depend on how the bytes travel. The shared
+ * memory transport below serves processes on one host; a socket transport
+ * between hosts would plug in behind the same interface.
+ */
+#ifndef SPIKE_TRANSPORT_H
+#define SPIKE_TRANSPORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/** @brief Interval at which a rank waiting for the others checks that they are alive (ms). */
+#define SPIKE_TRANSPORT_LIVENESS_MS 100
+
+/**
+ * @struct SpikeTransport
+ * @brief A transport: the caller's rank plus the all-gather operation.
+ */
+typedef struct SpikeTransport SpikeTransport;
+struct SpikeTransport {
+    int rank;                   ///< This process, in [0, size)
+    int size;                   ///< Number of processes
+
+    /**
+     * Publishes 'block' and returns every rank's block. 'blocks' and
+     * 'sizes' (size entries) stay valid until the next call. Fails, in
+     * every rank, once any rank aborted or died.
+     */
+    bool (*allGather)(SpikeTransport *transport, const void *block, size_t bytes,
+                      const unsigned char **blocks, size_t *sizes);
+
+    /**
+     * Makes every pending and later exchange fail, in every rank. Harmless
+     * once all ranks have passed their last exchange.
+     */
+    void (*abort)(SpikeTransport *transport);
+
+    /** Releases the caller's resources; the last owner also removes shared ones. */
+    void (*free)(SpikeTransport *transport);
+};
+
+/**
+ * @brief Creates a shared-memory transport for 'processes' local processes.
+ *
+ * Must be called before forking: the segment (a POSIX shared memory
+ * object under /dev/shm, unlinked as soon as it is mapped) and its
+ * process-shared barrier are inherited by the children, which then only
+ * set their 'rank'. Blocks are double-buffered, so one barrier per
+ * interval is enough: a process can only overwrite a buffer after every
+ * other one has passed the next barrier, i.e. finished reading it.
+ *
+ * A rank waiting at the barrier checks every SPIKE_TRANSPORT_LIVENESS_MS
+ * that the others still run: the children check that their parent (rank
+ * 0) is alive, rank 0 that none of the processes registered with
+ * SpikeTransportShmSetProcess has exited. A dead rank aborts the
+ * transport instead of leaving the others waiting forever.
+ *
+ * @param processes Number of processes (>= 1).
+ * @param blockCapacity Largest block any rank publishes (bytes).
+ * @return The transport (rank 0), or NULL on failure.
+ */
+SpikeTransport *SpikeTransportShmCreate(int processes, size_t blockCapacity);
+
+/**
+ * @brief Registers the process id of a rank with a shared-memory transport
+ * (rank 0 only, after forking it), so that its death is detected.
+ */
+void SpikeTransportShmSetProcess(SpikeTransport *transport, int rank, int processId);
+
+/**
+ * @brief Runs one all-gather (see SpikeTransport::allGather).
+ */
+static inline bool SpikeTransportAllGather(SpikeTransport *transport, const void *block, size_t bytes,
+                                           const unsigned char **blocks, size_t *sizes) {
+    return transport->allGather(transport, block, bytes, blocks, sizes);
+}
+
+/**
+ * @brief Aborts every exchange of a transport (see SpikeTransport::abort).
+ */
+static inline void SpikeTransportAbort(SpikeTransport *transport) {
+    transport->abort(transport);
+}
+
+/**
+ * @brief Frees a transport (NULL is ignored).
+ */
+static inline void SpikeTransportFree(SpikeTransport *transport) {
+    if (transport) transport->free(transport);
+}
+
+#endif // SPIKE_TRANSPORT_H
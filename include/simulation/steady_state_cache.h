@@ -0,0 +1,99 @@
+/**
+ * @file steady_state_cache.h
+ * @brief Public interface for the on-disk steady-state (warm-start) cache.
+ *
+ * Every run normally starts from the model's resting values and spends
+ * the first tens of milliseconds of model time settling. This cache stores
+ * the settled state vector for a given model, parameter set, input level
+ * and time step, keyed by a content hash, so new runs (and sweep points)
+ * can start directly from it.
+ *
+ * Settling always starts from the model's reset state and only counts
+ * when the trajectory converges to a fixed point. Above threshold there is
+ * none (the neuron fires periodically): the model is then left in its
+ * reset state, so the run keeps its transient and first-spike latency,
+ * and the cache remembers the miss so the next run does not settle again.
+ */
+#ifndef STEADY_STATE_CACHE_H
+#define STEADY_STATE_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "model/neural/neuron_models.h"
+#include "model/neural/izhikevich/izhikevich_model.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_model.h"
+
+/** @brief Cache sub-directory (under DISK_CACHE_ROOT) for settled states. */
+#define STEADY_STATE_CACHE_DIR "steady-state"
+
+/** @brief Longest model time (ms) simulated from the reset state looking for a fixed point. */
+#define STEADY_STATE_SETTLE_TIME 1000.0f
+
+/** @brief Window (ms) over which convergence is judged. */
+#define STEADY_STATE_WINDOW 20.0f
+
+/**
+ * @brief Largest rate of change (state units per ms) of every state
+ * variable over a whole window for the trajectory to count as settled.
+ */
+#define STEADY_STATE_TOLERANCE 1e-4f
+
+/** @brief Maximum number of parameters that identify a model configuration. */
+#define STEADY_STATE_MAX_PARAMS 8
+
+/**
+ * @struct SteadyStateKey
+ * @brief Everything the settled state depends on. Hashed byte-for-byte.
+ */
+typedef struct {
+    uint32_t version;                        ///< Cache layout version
+    int32_t neuronModel;                     ///< NeuronModel
+    float params[STEADY_STATE_MAX_PARAMS];   ///< Model parameters, unused slots are zero
+    float externCurrent;                     ///< Constant input during settling
+    float dt;                                ///< Integration time step (ms)
+    float settleTime;                        ///< Longest settling duration (ms)
+    float tolerance;                         ///< Convergence tolerance (per ms)
+} SteadyStateKey;
+
+/**
+ * @brief Builds the cache key for an Izhikevich model (a, b, c, d).
+ * @param key Output key (fully overwritten, including padding).
+ * @param model Pointer to the Izhikevich model.
+ * @param iExt The input current the state is settled at.
+ */
+void SteadyStateKeyIzhikevich(SteadyStateKey *key, const IzhikevichModel *model, float iExt);
+
+/**
+ * @brief Builds the cache key for a Hodgkin-Huxley model (conductances, reversals, C).
+ * @param key Output key (fully overwritten, including padding).
+ * @param model Pointer to the HH model.
+ * @param iExt The input current the state is settled at.
+ */
+void SteadyStateKeyHodgkinHuxley(SteadyStateKey *key, const HodgkinHuxleyModel *model, float iExt);
+
+/**
+ * @brief Moves an Izhikevich model to its settled state for the given input.
+ *
+ * Loads the state from the cache when a matching entry exists; otherwise
+ * simulates from the reset state until the trajectory converges (at most
+ * STEADY_STATE_SETTLE_TIME ms) and stores the result for the next run.
+ * Without a fixed point the model is left in its reset state.
+ *
+ * @param model Pointer to an Izhikevich model (its state is overwritten).
+ * @param iExt The input current.
+ * @return true if the model was moved to a settled state, false if there
+ * is none for this input (or model is NULL).
+ */
+bool SteadyStateWarmStartIzhikevich(IzhikevichModel *model, float iExt);
+
+/**
+ * @brief Moves a Hodgkin-Huxley model to its settled state for the given input.
+ *
+ * @param model Pointer to an HH model (its state is overwritten).
+ * @param iExt The input current.
+ * @return true if the model was moved to a settled state, false if there
+ * is none for this input (or model is NULL).
+ */
+bool SteadyStateWarmStartHodgkinHuxley(HodgkinHuxleyModel *model, float iExt);
+
+#endif // STEADY_STATE_CACHE_H
@@ -0,0 +1,113 @@
+#ifndef CALENDAR_QUEUE_H
+#define CALENDAR_QUEUE_H
+
+#include <stdbool.h>
+
+/** @brief Smallest number of buckets a calendar queue shrinks to. */
+#define CALENDAR_MIN_BUCKETS 16
+
+/**
+ * @struct CalendarEvent
+ * @brief A timed event: its time and two caller-defined integers.
+ */
+typedef struct {
+    double time;
+    int target;
+    int data;
+} CalendarEvent;
+
+/**
+ * @struct CalendarNode
+ * @brief Pool entry of a calendar queue (an event and the next entry of its bucket).
+ */
+typedef struct {
+    CalendarEvent event;
+    unsigned long order;       ///< Push sequence number (breaks ties between equal times)
+    int next;
+} CalendarNode;
+
+/**
+ * @struct CalendarQueue
+ * @brief Bucketed priority queue of timed events (Brown, 1988).
+ *
+ * Time is cut into "days" of 'width'; day k goes to bucket k mod
+ * bucketCount, and each bucket is a list sorted by time. Popping walks
+ * the buckets day by day from the current one, so with a width matched to
+ * the mean event spacing both push and pop cost O(1) amortized. The
+ * bucket count doubles or halves with the queue size, and the width is
+ * re-estimated from the earliest events whenever that happens.
+ *
+ * Events with equal times are popped in push order. Pushing an event
+ * earlier than the day being scanned rewinds the scan to it.
+ *
+ * Push returns the node of the event, which stays its handle until the
+ * event is popped or removed: a caller holding one event per object (the
+ * next threshold crossing of a neuron) moves or drops it in place instead
+ * of leaving outdated copies in the queue. Both walk one bucket, O(1)
+ * amortized like a push.
+ */
+typedef struct {
+    int *bucket;               ///< Head node of each bucket (-1 if empty)
+    int bucketCount;           ///< Always a power of two
+    double width;              ///< Length of one day
+    long day;                  ///< Absolute index of the day being scanned
+
+    CalendarNode *nodes;       ///< Node pool (indices stay valid when it grows)
+    int capacity;
+    int freeList;              ///< First unused node (-1 if none)
+    int size;                  ///< Events in the queue
+    unsigned long sequence;    ///< Next push sequence number
+} CalendarQueue;
+
+/**
+ * @brief Initializes an empty queue.
+ * @param queue Output queue.
+ * @param width Initial day length (> 0), ideally about the mean event spacing.
+ * @return false on invalid arguments or allocation failure.
+ */
+bool CalendarQueueInit(CalendarQueue *queue, double width);
+
+/**
+ * @brief Inserts an event.
+ * @return The node of the event (valid until it is popped or removed),
+ * or -1 on allocation failure.
+ */
+int CalendarQueuePush(CalendarQueue *queue, double time, int target, int data);
+
+/**
+ * @brief Moves a queued event to a new time, as if it were pushed again.
+ * @param node Handle returned by CalendarQueuePush.
+ */
+void CalendarQueueReschedule(CalendarQueue *queue, int node, double time);
+
+/**
+ * @brief Removes a queued event.
+ * @param node Handle returned by CalendarQueuePush.
+ */
+void CalendarQueueRemove(CalendarQueue *queue, int node);
+
+/**
+ * @brief Copies the earliest event without removing it.
+ * @return false if the queue is empty.
+ */
+bool CalendarQueuePeek(CalendarQueue *queue, CalendarEvent *event);
+
+/**
+ * @brief Removes the earliest event.
+ * @param queue The queue.
+ * @param event Output event (may be NULL).
+ * @return false if the queue is empty.
+ */
+bool CalendarQueuePop(CalendarQueue *queue, CalendarEvent *event);
+
+/**
+ * @brief Removes every event (keeps the allocations).
+ */
+void CalendarQueueClear(CalendarQueue *queue);
+
+/**
+ * @brief Frees the buckets and node pool of a queue.
+ */
+void CalendarQueueFree(CalendarQueue *queue);
+
+#endif // CALENDAR_QUEUE_H
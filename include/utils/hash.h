@@ -0,0 +1,24 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** @brief Default seed (FNV-1a 64-bit offset basis). */
+#define HASH_SEED 0xcbf29ce484222325ULL
+
+/**
+ * @brief Hashes a block of bytes with 64-bit FNV-1a.
+ *
+ * Hashes can be chained by passing the previous result as the seed.
+ * Structs used as keys must be zero-initialized (memset) before being
+ * filled, so that padding bytes hash deterministically.
+ *
+ * @param data Pointer to the bytes.
+ * @param size Number of bytes.
+ * @param seed HASH_SEED, or a previous hash to chain from.
+ * @return The 64-bit hash.
+ */
+uint64_t HashBytes(const void *data, size_t size, uint64_t seed);
+
+#endif // HASH_H
@@ -0,0 +1,113 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stdbool.h>
+
+/** @brief Upper bound on the number of worker threads of one ParallelFor. */
+#define PARALLEL_MAX_THREADS 64
+
+/**
+ * @brief Body of a parallel loop.
+ * @param index The iteration index, in [0, count).
+ * @param userData The pointer passed to ParallelFor.
+ */
+typedef void (*ParallelBody)(int index, void *userData);
+
+/**
+ * @brief Returns the number of worker threads ParallelFor uses (online CPUs,
+ * clamped to [1, PARALLEL_MAX_THREADS]).
+ */
+int ParallelWorkerCount(void);
+
+/**
+ * @brief Runs body(i, userData) for every i in [0, count) on a pool of threads.
+ *
+ * Iterations are handed out one at a time from a shared counter, so
+ * iterations of uneven cost balance themselves. The call returns once
+ * every iteration has finished. Iterations must be independent; the body
+ * must not touch shared state without its own synchronization.
+ *
+ * Falls back to running serially on the calling thread when count is 1
+ * or threads cannot be created.
+ *
+ * @param count Number of iterations.
+ * @param body The loop body.
+ * @param userData Opaque pointer forwarded to every call.
+ * @return true if at least one worker thread was used, false if the loop
+ * ran serially.
+ */
+bool ParallelFor(int count, ParallelBody body, void *userData);
+
+/**
+ * @brief A persistent set of worker threads for loops that run every time step.
+ *
+ * ParallelFor creates and joins its threads on every call, which is fine for
+ * analyses whose iterations are whole simulations but far too slow for a
+ * network update that takes microseconds. A pool keeps its workers parked
+ * on a condition variable between runs instead.
+ */
+typedef struct ParallelPool ParallelPool;
+
+/**
+ * @brief Starts a pool of worker threads.
+ *
+ * @param threads Total number of threads, including the calling thread
+ * (<= 0 means ParallelWorkerCount()). Clamped to PARALLEL_MAX_THREADS.
+ * @return The pool, or NULL on allocation failure. A pool whose threads
+ * could not all be created still works with fewer threads.
+ */
+ParallelPool *ParallelPoolCreate(int threads);
+
+/**
+ * @brief Returns the number of threads (including the caller) of a pool.
+ */
+int ParallelPoolSize(const ParallelPool *pool);
+
+/**
+ * @brief Runs body(i, userData) for every i in [0, count) on the pool.
+ *
+ * Same contract as ParallelFor: iterations are claimed dynamically, the
+ * calling thread takes part, and the call returns when all have finished.
+ * Runs serially when 'pool' is NULL or has a single thread.
+ */
+void ParallelPoolRun(ParallelPool *pool, int count, ParallelBody body, void *userData);
+
+/**
+ * @brief Runs body(i, userData) for every i in [first[0], first[ranges]),
+ * starting each thread on its own range.
+ *
+ * Thread t (the caller is thread 0) claims the iterations of range
+ * t % ranges in order, then helps with the other ranges. Giving a thread
+ * the same range every time keeps the data of those iterations in its
+ * caches and, with first-touch placement, on its NUMA node, while
+ * uneven ranges still balance.
+ */
+void ParallelPoolRunRanges(ParallelPool *pool, const int *first, int ranges, ParallelBody body, void *userData);
+
+/**
+ * @brief Runs body(t, userData) exactly once on every thread t of the pool
+ * (t in [0, ParallelPoolSize), the caller is thread 0).
+ */
+void ParallelPoolRunEach(ParallelPool *pool, ParallelBody body, void *userData);
+
+/**
+ * @brief Pins thread t of a pool to CPU number (firstCpu + t) of the
+ * caller's affinity mask, modulo the CPUs in that mask.
+ *
+ * Thread 0 is the calling thread. Its affinity before the first pin is
+ * saved and restored by ParallelPoolDestroy when it runs on the same
+ * thread (later pins of the same pool must run there too).
+ *
+ * @return false if pinning is unsupported (non-Linux), 'pool' is NULL,
+ * called from another thread than the first pin, or failed for a thread
+ * (that thread then keeps floating).
+ */
+bool ParallelPoolPin(ParallelPool *pool, int firstCpu);
+
+/**
+ * @brief Stops and joins the workers, restores the caller's affinity if
+ * the pool was pinned, and frees the pool.
+ */
+void ParallelPoolDestroy(ParallelPool *pool);
+
+#endif // PARALLEL_H
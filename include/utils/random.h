@@ -0,0 +1,66 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <math.h>
+#include <stdint.h>
+
+/**
+ * @struct Rng
+ * @brief Small, seedable pseudo-random generator (xorshift64* over a
+ * splitmix64-scrambled seed).
+ *
+ * Every network construction and noise source takes an explicit Rng so
+ * that runs are reproducible from their seed; independent streams (one
+ * per chunk or per thread) are made by seeding with different values.
+ */
+typedef struct {
+    uint64_t state;
+} Rng;
+
+/**
+ * @brief Seeds a generator. Any seed (including 0) gives a valid stream.
+ */
+static inline void RngSeed(Rng *rng, uint64_t seed) {
+    uint64_t z = seed + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z ^= z >> 31;
+    rng->state = z ? z : 0x9e3779b97f4a7c15ULL;
+}
+
+/**
+ * @brief Returns 64 random bits.
+ */
+static inline uint64_t RngNext(Rng *rng) {
+    uint64_t x = rng->state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    rng->state = x;
+    return x * 0x2545f4914f6cdd1dULL;
+}
+
+/**
+ * @brief Returns a uniform float in [0, 1).
+ */
+static inline float RngUniform(Rng *rng) {
+    return (float)(RngNext(rng) >> 40) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief Returns a uniform integer in [0, n) (n > 0).
+ */
+static inline int RngBelow(Rng *rng, int n) {
+    return (int)(((RngNext(rng) >> 32) * (uint64_t)n) >> 32);
+}
+
+/**
+ * @brief Returns a standard normal sample (Box-Muller, one value per call).
+ */
+static inline float RngNormal(Rng *rng) {
+    const double u1 = ((RngNext(rng) >> 11) + 1.0) * (1.0 / 9007199254740993.0);
+    const double u2 = (RngNext(rng) >> 11) * (1.0 / 9007199254740992.0);
+    return (float)(sqrt(-2.0 * log(u1)) * cos(6.28318530717958647692 * u2));
+}
+
+#endif // RANDOM_H
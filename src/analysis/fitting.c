@@ -0,0 +1,376 @@
+/**
+ * @file fitting.c
+ * @brief Implementation of the batched Nelder-Mead parameter fit.
+ */
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils/parallel.h"
+#include "analysis/fitting.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Cost reported for candidates whose run fails. */
+#define FAILED_COST FLT_MAX
+
+/** @brief Initial simplex edge in normalized coordinates. */
+#define INITIAL_STEP 0.1f
+
+/** @brief Nelder-Mead coefficients: reflection, expansion, contraction, shrink. */
+#define NM_ALPHA 1.0f
+#define NM_GAMMA 2.0f
+#define NM_RHO   0.5f
+#define NM_SIGMA 0.5f
+
+/** @brief Maximum number of simplex restarts around the best point after convergence. */
+#define MAX_RESTARTS 4
+
+/** @brief Largest batch: the initial simplex (n + 1 vertices). */
+#define MAX_BATCH (FIT_MAX_PARAMETERS + 1)
+
+/**
+ * @struct FitBatch
+ * @brief A population of normalized candidates evaluated in parallel.
+ */
+typedef struct {
+    const FitConfig *config;
+    const float (*points)[FIT_MAX_PARAMETERS];
+    float *costs;
+} FitBatch;
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Maps a normalized point (clamped to [0, 1]) to parameter values.
+ */
+static void FitDenormalize(const FitConfig *config, const float *point, float *values);
+
+/**
+ * @brief Simulates one candidate and records its spike times and decimated trace.
+ * @return The number of spikes, or -1 if the run failed.
+ */
+static int FitSimulate(const FitConfig *config, const float *values, float *spikes, float *trace);
+
+/**
+ * @brief Distance between a candidate spike train and the target one.
+ */
+static float FitSpikeTimeDistance(const float *spikes, int count, const float *target, int targetCount);
+
+/**
+ * @brief Relative-error distance between spike-train features.
+ */
+static float FitFeatureDistance(const float *spikes, int count, const float *target, int targetCount);
+
+/**
+ * @brief ParallelFor body: evaluates one candidate of a batch.
+ */
+static void FitEvaluateOne(int index, void *userData);
+
+/**
+ * @brief Evaluates 'count' normalized candidates in parallel.
+ */
+static void FitEvaluateBatch(const FitConfig *config, const float (*points)[FIT_MAX_PARAMETERS], int count, float *costs, FitResult *result);
+
+// --- Private (static) Function Implementations ---
+
+static void FitDenormalize(const FitConfig *config, const float *point, float *values) {
+    for (int p = 0; p < config->numParameters; p++) {
+        float t = point[p];
+        if (t < 0.0f) t = 0.0f;
+        if (t > 1.0f) t = 1.0f;
+        values[p] = config->lower[p] + t * (config->upper[p] - config->lower[p]);
+    }
+}
+
+static int FitSimulate(const FitConfig *config, const float *values, float *spikes, float *trace) {
+    RunSpec spec = config->base;
+    for (int p = 0; p < config->numParameters; p++) SweepApplyParameter(&spec, config->parameters[p], values[p]);
+
+    RunNeuron neuron;
+    if (!RunNeuronInit(&neuron, &spec)) return -1;
+
+    const int steps = (int)(spec.duration / spec.dt + 0.5f);
+    const int traceLength = trace ? config->targetTraceLength : 0;
+    const int decimation = (traceLength > 0) ? (steps + traceLength - 1) / traceLength : 0;
+
+    int count = 0, traceIndex = 0;
+    for (int i = 0; i < steps; i++) {
+        if (RunNeuronStep(&neuron) && count < FIT_MAX_SPIKES) spikes[count++] = (i + 1) * spec.dt;
+        if (decimation > 0 && i % decimation == 0 && traceIndex < traceLength) trace[traceIndex++] = neuron.potential;
+    }
+    while (decimation > 0 && traceIndex < traceLength) trace[traceIndex++] = neuron.potential;
+
+    RunNeuronFree(&neuron);
+    return count;
+}
+
+static float FitSpikeTimeDistance(const float *spikes, int count, const float *target, int targetCount) {
+    if (count == 0 && targetCount == 0) return 0.0f;
+    if (count == 0 || targetCount == 0) return 1.0f;
+
+    // Both trains are sorted: nearest neighbours by a merged sweep in each direction
+    double total = 0.0;
+    for (int pass = 0; pass < 2; pass++) {
+        const float *from = pass ? target : spikes;
+        const float *to   = pass ? spikes : target;
+        const int nFrom   = pass ? targetCount : count;
+        const int nTo     = pass ? count : targetCount;
+
+        int j = 0;
+        for (int i = 0; i < nFrom; i++) {
+            while (j + 1 < nTo && to[j + 1] <= from[i]) j++;
+
+            float nearest = fabsf(from[i] - to[j]);
+            if (j + 1 < nTo && fabsf(to[j + 1] - from[i]) < nearest) nearest = fabsf(to[j + 1] - from[i]);
+            total += (nearest < FIT_SPIKE_WINDOW) ? nearest : FIT_SPIKE_WINDOW;
+        }
+    }
+
+    return (float)(total / ((count + targetCount) * FIT_SPIKE_WINDOW));
+}
+
+static float FitFeatureDistance(const float *spikes, int count, const float *target, int targetCount) {
+    // Features: count, first latency, mean ISI, ISI coefficient of variation
+    float features[2][4] = { { 0 } };
+    const float *trains[2] = { spikes, target };
+    const int counts[2]    = { count, targetCount };
+
+    for (int s = 0; s < 2; s++) {
+        const int n = counts[s];
+        features[s][0] = (float)n;
+        if (n > 0) features[s][1] = trains[s][0];
+        if (n > 1) {
+            double sum = 0.0, sumSq = 0.0;
+            for (int i = 1; i < n; i++) {
+                const double isi = trains[s][i] - trains[s][i - 1];
+                sum   += isi;
+                sumSq += isi * isi;
+            }
+            const double mean = sum / (n - 1);
+            const double var  = sumSq / (n - 1) - mean * mean;
+            features[s][2] = (float)mean;
+            features[s][3] = (mean > 0.0) ? (float)(sqrt(var > 0.0 ? var : 0.0) / mean) : 0.0f;
+        }
+    }
+
+    double cost = 0.0;
+    for (int f = 0; f < 4; f++) {
+        const double scale = fabs(features[1][f]) > 1e-3 ? fabs(features[1][f]) : 1.0;
+        const double error = (features[0][f] - features[1][f]) / scale;
+        cost += error * error;
+    }
+    return (float)cost;
+}
+
+static void FitEvaluateOne(int index, void *userData) {
+    FitBatch *batch = (FitBatch*)userData;
+
+    float values[FIT_MAX_PARAMETERS];
+    FitDenormalize(batch->config, batch->points[index], values);
+    batch->costs[index] = FitCost(batch->config, values);
+}
+
+static void FitEvaluateBatch(const FitConfig *config, const float (*points)[FIT_MAX_PARAMETERS], int count, float *costs, FitResult *result) {
+    FitBatch batch = { .config = config, .points = points, .costs = costs };
+    ParallelFor(count, FitEvaluateOne, &batch);
+    result->evaluations += count;
+}
+
+// --- Public (API) Function Implementations ---
+
+void FitConfigDefaults(FitConfig *config, NeuronModel neuronModel) {
+    memset(config, 0, sizeof(*config));
+    RunSpecDefaults(&config->base, neuronModel);
+
+    if (neuronModel == IZHIKEVICH_MODEL) {
+        const IzhikevichConfig *p = &config->base.izParams;
+        const SweepParameter params[] = { SWEEP_PARAM_IZ_A, SWEEP_PARAM_IZ_B, SWEEP_PARAM_IZ_C, SWEEP_PARAM_IZ_D };
+        const float values[]          = { p->a, p->b, p->c, p->d };
+
+        config->numParameters = 4;
+        for (int i = 0; i < 4; i++) {
+            config->parameters[i] = params[i];
+            config->initial[i]    = values[i];
+            // 'c' is negative: the factor-of-two box must be ordered
+            config->lower[i] = fminf(values[i] * 0.5f, values[i] * 2.0f);
+            config->upper[i] = fmaxf(values[i] * 0.5f, values[i] * 2.0f);
+        }
+    } else {
+        const HodgkinHuxleyParams *p = &config->base.hhParams;
+        const SweepParameter params[] = { SWEEP_PARAM_HH_GNA, SWEEP_PARAM_HH_GK, SWEEP_PARAM_HH_GL };
+        const float values[]          = { p->gNa, p->gK, p->gL };
+
+        config->numParameters = 3;
+        for (int i = 0; i < 3; i++) {
+            config->parameters[i] = params[i];
+            config->initial[i]    = values[i];
+            config->lower[i]      = values[i] * 0.5f;
+            config->upper[i]      = values[i] * 2.0f;
+        }
+    }
+
+    // Candidates start from the model's initial state: a settled state per
+    // candidate would add one cache entry for every parameter vector tried
+    config->base.warmStart = false;
+
+    config->distance      = FIT_DISTANCE_SPIKE_TIMES;
+    config->maxIterations = 200;
+    config->tolerance     = 1e-4f;
+}
+
+float FitCost(const FitConfig *config, const float *values) {
+    float spikes[FIT_MAX_SPIKES];
+    float *trace = NULL;
+
+    if (config->distance == FIT_DISTANCE_TRACE) {
+        trace = (float*)malloc(config->targetTraceLength * sizeof(float));
+        if (!trace) return FAILED_COST;
+    }
+
+    const int count = FitSimulate(config, values, spikes, trace);
+    float cost = FAILED_COST;
+
+    if (count >= 0) {
+        switch (config->distance) {
+            case FIT_DISTANCE_TRACE: {
+                double sumSq = 0.0;
+                for (int i = 0; i < config->targetTraceLength; i++) {
+                    const double diff = trace[i] - config->targetTrace[i];
+                    sumSq += diff * diff;
+                }
+                cost = (float)sqrt(sumSq / config->targetTraceLength);
+            } break;
+
+            case FIT_DISTANCE_SPIKE_TIMES: cost = FitSpikeTimeDistance(spikes, count, config->targetSpikes, config->targetSpikeCount); break;
+
+            case FIT_DISTANCE_FEATURES: cost = FitFeatureDistance(spikes, count, config->targetSpikes, config->targetSpikeCount); break;
+
+            default: break;
+        }
+    }
+
+    free(trace);
+    return cost;
+}
+
+bool FitRun(const FitConfig *config, FitResult *result) {
+    if (!config || !result) return false;
+
+    const int n = config->numParameters;
+    if (n < 1 || n > FIT_MAX_PARAMETERS || config->maxIterations < 1) return false;
+    for (int p = 0; p < n; p++) {
+        if (!(config->upper[p] > config->lower[p])) return false;
+    }
+    if (config->distance == FIT_DISTANCE_TRACE && (!config->targetTrace || config->targetTraceLength < 1)) return false;
+    if (config->distance != FIT_DISTANCE_TRACE && config->targetSpikeCount > 0 && !config->targetSpikes) return false;
+
+    memset(result, 0, sizeof(*result));
+
+    float simplex[MAX_BATCH][FIT_MAX_PARAMETERS] = { { 0 } };
+    float costs[MAX_BATCH];
+
+    // 1. Initial simplex around the normalized starting point (one batch)
+    for (int p = 0; p < n; p++) {
+        simplex[0][p] = (config->initial[p] - config->lower[p]) / (config->upper[p] - config->lower[p]);
+    }
+    FitEvaluateBatch(config, (const float (*)[FIT_MAX_PARAMETERS])simplex, 1, costs, result);
+
+    int restarts = 0;
+    float restartCost = costs[0];
+    bool rebuild = true;
+
+    for (result->iterations = 0; result->iterations < config->maxIterations; result->iterations++) {
+        // Fresh simplex around vertex 0 (start, or restart after a collapse)
+        if (rebuild) {
+            for (int v = 1; v <= n; v++) {
+                memcpy(simplex[v], simplex[0], sizeof(simplex[0]));
+                const int p = v - 1;
+                simplex[v][p] += (simplex[v][p] + INITIAL_STEP <= 1.0f) ? INITIAL_STEP : -INITIAL_STEP;
+            }
+            FitEvaluateBatch(config, (const float (*)[FIT_MAX_PARAMETERS])&simplex[1], n, &costs[1], result);
+            rebuild = false;
+        }
+
+        // 2. Order the vertices by cost (insertion sort, n <= 8)
+        for (int i = 1; i <= n; i++) {
+            float point[FIT_MAX_PARAMETERS];
+            const float cost = costs[i];
+            memcpy(point, simplex[i], sizeof(point));
+
+            int j = i - 1;
+            for (; j >= 0 && costs[j] > cost; j--) {
+                costs[j + 1] = costs[j];
+                memcpy(simplex[j + 1], simplex[j], sizeof(point));
+            }
+            costs[j + 1] = cost;
+            memcpy(simplex[j + 1], point, sizeof(point));
+        }
+
+        // A collapsed simplex may sit on a plateau: restart around the best
+        // vertex until a restart no longer improves the cost
+        if (costs[n] - costs[0] <= config->tolerance) {
+            if (restarts == MAX_RESTARTS || restartCost - costs[0] <= config->tolerance) {
+                result->converged = true;
+                break;
+            }
+            restarts++;
+            restartCost = costs[0];
+            rebuild = true;
+            continue;
+        }
+
+        // 3. Centroid of all but the worst vertex
+        float centroid[FIT_MAX_PARAMETERS] = { 0 };
+        for (int v = 0; v < n; v++) {
+            for (int p = 0; p < n; p++) centroid[p] += simplex[v][p] / n;
+        }
+
+        // 4. Speculative batch: reflection, expansion, outside and inside contraction
+        enum { REFLECT = 0, EXPAND, CONTRACT_OUT, CONTRACT_IN, CANDIDATES };
+        const float coefficients[CANDIDATES] = { NM_ALPHA, NM_ALPHA * NM_GAMMA, NM_ALPHA * NM_RHO, -NM_RHO };
+        float candidates[CANDIDATES][FIT_MAX_PARAMETERS] = { { 0 } };
+        float candidateCosts[CANDIDATES];
+
+        for (int c = 0; c < CANDIDATES; c++) {
+            for (int p = 0; p < n; p++) {
+                float x = centroid[p] + coefficients[c] * (centroid[p] - simplex[n][p]);
+                candidates[c][p] = (x < 0.0f) ? 0.0f : (x > 1.0f) ? 1.0f : x;
+            }
+        }
+        FitEvaluateBatch(config, (const float (*)[FIT_MAX_PARAMETERS])candidates, CANDIDATES, candidateCosts, result);
+
+        int accepted = -1;
+        if (candidateCosts[REFLECT] < costs[0]) {
+            accepted = (candidateCosts[EXPAND] < candidateCosts[REFLECT]) ? EXPAND : REFLECT;
+        } else if (candidateCosts[REFLECT] < costs[n - 1]) {
+            accepted = REFLECT;
+        } else if (candidateCosts[REFLECT] < costs[n]) {
+            if (candidateCosts[CONTRACT_OUT] <= candidateCosts[REFLECT]) accepted = CONTRACT_OUT;
+        } else if (candidateCosts[CONTRACT_IN] < costs[n]) {
+            accepted = CONTRACT_IN;
+        }
+
+        if (accepted >= 0) {
+            memcpy(simplex[n], candidates[accepted], sizeof(simplex[n]));
+            costs[n] = candidateCosts[accepted];
+            continue;
+        }
+
+        // 5. Shrink towards the best vertex (one batch of n)
+        for (int v = 1; v <= n; v++) {
+            for (int p = 0; p < n; p++) simplex[v][p] = simplex[0][p] + NM_SIGMA * (simplex[v][p] - simplex[0][p]);
+        }
+        FitEvaluateBatch(config, (const float (*)[FIT_MAX_PARAMETERS])&simplex[1], n, &costs[1], result);
+    }
+
+    // The best vertex is first after the last ordering (or the last accepted candidate)
+    int best = 0;
+    for (int v = 1; v <= n; v++) {
+        if (costs[v] < costs[best]) best = v;
+    }
+
+    FitDenormalize(config, simplex[best], result->best);
+    result->cost = costs[best];
+    return true;
+}
@@ -0,0 +1,252 @@
+/**
+ * @file phase_plane.c
+ * @brief Implementation of the phase-plane analysis.
+ *
+ * Nullclines are traced by scanning rows of constant potential for sign
+ * changes of each derivative (both nullclines of the supported systems are
+ * graphs over the potential axis, possibly multi-valued). Fixed points are
+ * found by running Newton's method from the vector-field grid nodes and
+ * merging duplicates.
+ */
+#include <math.h>
+#include <string.h>
+#include "analysis/phase_plane.h"
+#include "model/neural/izhikevich/izhikevich_model.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_rates.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Rinzel's linear h-n relation: h = H_INTERCEPT - H_SLOPE * n. */
+#define H_INTERCEPT 0.89
+#define H_SLOPE     1.1
+
+/** @brief Maximum Newton iterations per seed. */
+#define NEWTON_MAX_ITER 50
+
+/** @brief Newton convergence tolerance on the step size. */
+#define NEWTON_TOL 1e-6
+
+/** @brief Relative step for finite-difference Jacobians. */
+#define FD_STEP 1e-4
+
+/** @brief Two fixed points closer than this fraction of the viewport are merged. */
+#define MERGE_FRACTION 1e-3
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Evaluates the reduced HH derivatives at one point (double precision).
+ */
+static void HHReducedDerivatives(const HodgkinHuxleyParams *p, float current, double n, double v, double *dn, double *dv);
+
+/**
+ * @brief Evaluates (dx/dt, dy/dt) at one point in double precision.
+ */
+static void PhasePlanePointDerivatives(const PhasePlaneModel *model, double x, double y, double *dx, double *dy);
+
+/**
+ * @brief Computes the Jacobian [[dfx/dx, dfx/dy], [dfy/dx, dfy/dy]] at one point.
+ */
+static void PhasePlaneJacobian(const PhasePlaneModel *model, double x, double y, double jac[4]);
+
+/**
+ * @brief Classifies a fixed point from the trace and determinant of its Jacobian.
+ */
+static EquilibriumType PhasePlaneClassify(double trace, double det);
+
+/**
+ * @brief Appends the zero crossings of 'f' along one scanned row.
+ */
+static void PhasePlaneAppendCrossings(const float *xs, const float *f, int cols, float y, float (*points)[2], int *count);
+
+// --- Private (static) Function Implementations ---
+
+static void HHReducedDerivatives(const HodgkinHuxleyParams *p, float current, double n, double v, double *dn, double *dv) {
+    const float vf = (float)v;
+    const double am = AlphaM(vf), bm = BetaM(vf);
+    const double an = AlphaN(vf), bn = BetaN(vf);
+
+    const double mInf = am / (am + bm);
+    double h = H_INTERCEPT - H_SLOPE * n;
+    if (h < 0.0) h = 0.0;
+    if (h > 1.0) h = 1.0;
+
+    const double iNa = p->gNa * mInf * mInf * mInf * h * (p->eNa - v);
+    const double iK  = p->gK * n * n * n * n * (p->eK - v);
+    const double iL  = p->gL * (p->eL - v);
+
+    *dv = (iNa + iK + iL + current) / p->C;
+    *dn = an * (1.0 - n) - bn * n;
+}
+
+static void PhasePlanePointDerivatives(const PhasePlaneModel *model, double x, double y, double *dx, double *dy) {
+    if (model->system == PHASE_SYSTEM_IZHIKEVICH) {
+        const double a = model->izParams.a;
+        const double b = model->izParams.b;
+        *dy = 0.04 * y * y + 5.0 * y + 140.0 - x + model->externCurrent;
+        *dx = a * (b * y - x);
+    } else {
+        HHReducedDerivatives(&model->hhParams, model->externCurrent, x, y, dx, dy);
+    }
+}
+
+static void PhasePlaneJacobian(const PhasePlaneModel *model, double x, double y, double jac[4]) {
+    if (model->system == PHASE_SYSTEM_IZHIKEVICH) {
+        const double a = model->izParams.a;
+        const double b = model->izParams.b;
+        jac[0] = -a;             // d(du)/du
+        jac[1] = a * b;          // d(du)/dv
+        jac[2] = -1.0;           // d(dv)/du
+        jac[3] = 0.08 * y + 5.0; // d(dv)/dv
+        return;
+    }
+
+    // Central differences for the reduced HH system
+    const double hx = FD_STEP * (fabs(x) + 1e-2);
+    const double hy = FD_STEP * (fabs(y) + 1.0);
+    double fxp, fyp, fxm, fym;
+
+    PhasePlanePointDerivatives(model, x + hx, y, &fxp, &fyp);
+    PhasePlanePointDerivatives(model, x - hx, y, &fxm, &fym);
+    jac[0] = (fxp - fxm) / (2.0 * hx);
+    jac[2] = (fyp - fym) / (2.0 * hx);
+
+    PhasePlanePointDerivatives(model, x, y + hy, &fxp, &fyp);
+    PhasePlanePointDerivatives(model, x, y - hy, &fxm, &fym);
+    jac[1] = (fxp - fxm) / (2.0 * hy);
+    jac[3] = (fyp - fym) / (2.0 * hy);
+}
+
+static EquilibriumType PhasePlaneClassify(double trace, double det) {
+    if (det < 0.0) return EQUILIBRIUM_SADDLE;
+    if (fabs(trace) < 1e-9) return EQUILIBRIUM_CENTER;
+
+    const bool focus = (trace * trace - 4.0 * det) < 0.0;
+    if (trace < 0.0) return focus ? EQUILIBRIUM_STABLE_FOCUS : EQUILIBRIUM_STABLE_NODE;
+    return focus ? EQUILIBRIUM_UNSTABLE_FOCUS : EQUILIBRIUM_UNSTABLE_NODE;
+}
+
+static void PhasePlaneAppendCrossings(const float *xs, const float *f, int cols, float y, float (*points)[2], int *count) {
+    for (int c = 1; c < cols && *count < PHASE_PLANE_MAX_NULLCLINE_POINTS; c++) {
+        if ((f[c - 1] < 0.0f) == (f[c] < 0.0f)) continue;
+
+        // Linear interpolation of the crossing inside the cell
+        const float t = f[c - 1] / (f[c - 1] - f[c]);
+        points[*count][0] = xs[c - 1] + t * (xs[c] - xs[c - 1]);
+        points[*count][1] = y;
+        (*count)++;
+    }
+}
+
+// --- Public (API) Function Implementations ---
+
+void PhasePlaneDerivativesBatch(const PhasePlaneModel *model, const float *x, const float *y, float *dx, float *dy, int n) {
+    if (model->system == PHASE_SYSTEM_IZHIKEVICH) {
+        // Izhikevich kernel takes (v, u) and returns (dv, du)
+        IzhikevichDerivativesBatch(y, x, dy, dx, n, model->izParams.a, model->izParams.b, model->externCurrent);
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        double dn, dv;
+        HHReducedDerivatives(&model->hhParams, model->externCurrent, x[i], y[i], &dn, &dv);
+        dx[i] = (float)dn;
+        dy[i] = (float)dv;
+    }
+}
+
+bool PhasePlaneNewton(const PhasePlaneModel *model, float *x, float *y) {
+    double px = *x, py = *y;
+
+    for (int iter = 0; iter < NEWTON_MAX_ITER; iter++) {
+        double fx, fy, jac[4];
+        PhasePlanePointDerivatives(model, px, py, &fx, &fy);
+        PhasePlaneJacobian(model, px, py, jac);
+
+        const double det = jac[0] * jac[3] - jac[1] * jac[2];
+        if (fabs(det) < 1e-15 || !isfinite(det)) return false;
+
+        // Solve J * delta = -F (2x2 Cramer's rule)
+        const double deltaX = (-fx * jac[3] + fy * jac[1]) / det;
+        const double deltaY = (-fy * jac[0] + fx * jac[2]) / det;
+        px += deltaX;
+        py += deltaY;
+
+        if (!isfinite(px) || !isfinite(py)) return false;
+        if (fabs(deltaX) < NEWTON_TOL * (fabs(px) + 1e-3) && fabs(deltaY) < NEWTON_TOL * (fabs(py) + 1.0)) {
+            *x = (float)px;
+            *y = (float)py;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void PhasePlaneAnalyze(const PhasePlaneModel *model, const PhasePlaneViewport *viewport, PhasePlaneAnalysis *analysis) {
+    memset(analysis, 0, sizeof(*analysis));
+    analysis->viewport = *viewport;
+
+    const float width  = viewport->xMax - viewport->xMin;
+    const float height = viewport->yMax - viewport->yMin;
+
+    // 1. Vector field: one batched evaluation per grid row
+    float xs[PHASE_PLANE_SCAN_COLS];
+    float ys[PHASE_PLANE_SCAN_COLS];
+    for (int r = 0; r < PHASE_PLANE_FIELD_RES; r++) {
+        const float y = viewport->yMin + height * (r + 0.5f) / PHASE_PLANE_FIELD_RES;
+        for (int c = 0; c < PHASE_PLANE_FIELD_RES; c++) {
+            xs[c] = viewport->xMin + width * (c + 0.5f) / PHASE_PLANE_FIELD_RES;
+            ys[c] = y;
+        }
+        PhasePlaneDerivativesBatch(model, xs, ys, &analysis->fieldDx[r * PHASE_PLANE_FIELD_RES],
+                                   &analysis->fieldDy[r * PHASE_PLANE_FIELD_RES], PHASE_PLANE_FIELD_RES);
+    }
+
+    // 2. Nullclines: scan rows of constant potential for sign changes
+    float fx[PHASE_PLANE_SCAN_COLS];
+    float fy[PHASE_PLANE_SCAN_COLS];
+    for (int c = 0; c < PHASE_PLANE_SCAN_COLS; c++) {
+        xs[c] = viewport->xMin + width * c / (PHASE_PLANE_SCAN_COLS - 1);
+    }
+
+    for (int r = 0; r < PHASE_PLANE_SCAN_ROWS; r++) {
+        const float y = viewport->yMin + height * r / (PHASE_PLANE_SCAN_ROWS - 1);
+        for (int c = 0; c < PHASE_PLANE_SCAN_COLS; c++) ys[c] = y;
+
+        PhasePlaneDerivativesBatch(model, xs, ys, fx, fy, PHASE_PLANE_SCAN_COLS);
+        PhasePlaneAppendCrossings(xs, fx, PHASE_PLANE_SCAN_COLS, y, analysis->xNullcline, &analysis->xNullclineCount);
+        PhasePlaneAppendCrossings(xs, fy, PHASE_PLANE_SCAN_COLS, y, analysis->yNullcline, &analysis->yNullclineCount);
+    }
+
+    // 3. Fixed points: Newton from every grid node, merged and kept inside the viewport
+    for (int r = 0; r < PHASE_PLANE_FIELD_RES && analysis->equilibriumCount < PHASE_PLANE_MAX_EQUILIBRIA; r++) {
+        for (int c = 0; c < PHASE_PLANE_FIELD_RES && analysis->equilibriumCount < PHASE_PLANE_MAX_EQUILIBRIA; c++) {
+            float x = viewport->xMin + width * (c + 0.5f) / PHASE_PLANE_FIELD_RES;
+            float y = viewport->yMin + height * (r + 0.5f) / PHASE_PLANE_FIELD_RES;
+
+            if (!PhasePlaneNewton(model, &x, &y)) continue;
+            if (x < viewport->xMin || x > viewport->xMax || y < viewport->yMin || y > viewport->yMax) continue;
+
+            bool duplicate = false;
+            for (int e = 0; e < analysis->equilibriumCount; e++) {
+                if (fabsf(analysis->equilibria[e].x - x) <= MERGE_FRACTION * fabsf(width)
+                    && fabsf(analysis->equilibria[e].y - y) <= MERGE_FRACTION * fabsf(height)) {
+                    duplicate = true;
+                    break;
+                }
+            }
+            if (duplicate) continue;
+
+            double jac[4];
+            PhasePlaneJacobian(model, x, y, jac);
+
+            PhaseEquilibrium *eq = &analysis->equilibria[analysis->equilibriumCount++];
+            eq->x           = x;
+            eq->y           = y;
+            eq->trace       = (float)(jac[0] + jac[3]);
+            eq->determinant = (float)(jac[0] * jac[3] - jac[1] * jac[2]);
+            eq->type        = PhasePlaneClassify(eq->trace, eq->determinant);
+        }
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * @file population_signals.c
+ * @brief Implementation of the binned population observables.
+ */
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "analysis/population_signals.h"
+
+// --- Public (API) Function Implementations ---
+
+void PopulationPartialClear(PopulationPartial *partial) {
+    memset(partial, 0, sizeof(*partial));
+}
+
+void PopulationPartialMerge(PopulationPartial *into, const PopulationPartial *from) {
+    into->iSyn       += from->iSyn;
+    into->spikes     += from->spikes;
+    into->phaseCos   += from->phaseCos;
+    into->phaseSin   += from->phaseSin;
+    into->phaseCount += from->phaseCount;
+}
+
+bool PopulationSignalsInit(PopulationSignals *signals, int neuronCount, float binWidth, int capacity) {
+    memset(signals, 0, sizeof(*signals));
+    if (neuronCount <= 0 || binWidth <= 0.0f || capacity <= 0) return false;
+
+    float *block = (float*)calloc((size_t)capacity * 3, sizeof(float));
+    if (!block) return false;
+
+    signals->neuronCount = neuronCount;
+    signals->binWidth    = binWidth;
+    signals->capacity    = capacity;
+    signals->lfp         = block;
+    signals->rate        = block + capacity;
+    signals->synchrony   = block + 2 * capacity;
+    return true;
+}
+
+void PopulationSignalsReset(PopulationSignals *signals) {
+    signals->total       = 0;
+    signals->binTime     = 0.0;
+    signals->lfpSum      = 0.0;
+    signals->binSteps    = 0;
+    signals->binSpikes   = 0;
+    signals->syncSum     = 0.0;
+    signals->syncSamples = 0;
+}
+
+void PopulationSignalsAccumulate(PopulationSignals *signals, const PopulationPartial *step, float dt) {
+    if (!signals->lfp) return;
+
+    signals->lfpSum    += step->iSyn;
+    signals->binSpikes += step->spikes;
+    signals->binSteps++;
+    signals->binTime   += dt;
+
+    if (step->phaseCount > 0) {
+        const double n = (double)step->phaseCount;
+        signals->syncSum += sqrt(step->phaseCos * step->phaseCos + step->phaseSin * step->phaseSin) / n;
+        signals->syncSamples++;
+    }
+
+    // Close the bin once it spans the bin width (half a step of slack for rounding)
+    if (signals->binTime + 0.5 * dt < signals->binWidth) return;
+
+    const int slot = signals->total % signals->capacity;
+    signals->lfp[slot]       = (float)(signals->lfpSum / signals->binSteps);
+    signals->rate[slot]      = (float)(signals->binSpikes * 1000.0 / (signals->neuronCount * signals->binTime));
+    signals->synchrony[slot] = signals->syncSamples ? (float)(signals->syncSum / signals->syncSamples) : 0.0f;
+    signals->total++;
+
+    signals->binTime     = 0.0;
+    signals->lfpSum      = 0.0;
+    signals->binSteps    = 0;
+    signals->binSpikes   = 0;
+    signals->syncSum     = 0.0;
+    signals->syncSamples = 0;
+}
+
+int PopulationSignalsCount(const PopulationSignals *signals) {
+    return signals->total < signals->capacity ? signals->total : signals->capacity;
+}
+
+bool PopulationSignalsGet(const PopulationSignals *signals, int index, float *lfp, float *rate, float *synchrony) {
+    const int held = PopulationSignalsCount(signals);
+    if (index < 0 || index >= held) return false;
+
+    const int slot = (signals->total - held + index) % signals->capacity;
+    if (lfp)       *lfp       = signals->lfp[slot];
+    if (rate)      *rate      = signals->rate[slot];
+    if (synchrony) *synchrony = signals->synchrony[slot];
+    return true;
+}
+
+void PopulationSignalsFree(PopulationSignals *signals) {
+    free(signals->lfp);
+    memset(signals, 0, sizeof(*signals));
+}
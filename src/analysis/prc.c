@@ -0,0 +1,186 @@
+/**
+ * @file prc.c
+ * @brief Implementation of the parallel phase response curve computation.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils/parallel.h"
+#include "analysis/prc.h"
+
+// --- Internal Module Constants ---
+
+/** @brief A run is abandoned when no spike occurs within this many periods. */
+#define TIMEOUT_CYCLES 3
+
+/** @brief Longest period accepted as repetitive firing (ms). */
+#define MAX_PERIOD 1000.0f
+
+/**
+ * @struct PrcCheckpoint
+ * @brief The cycle state captured at a spike, shared read-only by all runs.
+ */
+typedef struct {
+    const PrcConfig *config;
+    float state[RUN_MAX_STATE_SIZE];
+    int stateSize;
+    float potential;
+    int periodSteps;                     ///< Unperturbed period T0, in steps
+    int *perturbedSteps;                 ///< Output: perturbed period T1 per phase (-1 on failure)
+} PrcCheckpoint;
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Restores the checkpointed cycle state into a fresh neuron.
+ * @return true on success.
+ */
+static bool PrcCloneCheckpoint(const PrcCheckpoint *checkpoint, RunNeuron *neuron);
+
+/**
+ * @brief Steps a neuron until its next spike.
+ * @return The number of steps taken, or -1 if no spike within 'maxSteps'.
+ */
+static int PrcStepsToSpike(RunNeuron *neuron, int maxSteps);
+
+/**
+ * @brief ParallelFor body: runs the perturbed cycle of one phase.
+ */
+static void PrcPerturbedRun(int index, void *userData);
+
+// --- Private (static) Function Implementations ---
+
+static bool PrcCloneCheckpoint(const PrcCheckpoint *checkpoint, RunNeuron *neuron) {
+    RunSpec spec  = checkpoint->config->base;
+    spec.warmStart = false;
+
+    if (!RunNeuronInit(neuron, &spec)) return false;
+
+    memcpy(neuron->state, checkpoint->state, checkpoint->stateSize * sizeof(float));
+    neuron->potential = checkpoint->potential;
+    return true;
+}
+
+static int PrcStepsToSpike(RunNeuron *neuron, int maxSteps) {
+    for (int i = 1; i <= maxSteps; i++) {
+        if (RunNeuronStep(neuron)) return i;
+    }
+    return -1;
+}
+
+static void PrcPerturbedRun(int index, void *userData) {
+    PrcCheckpoint *checkpoint = (PrcCheckpoint*)userData;
+    const PrcConfig *config   = checkpoint->config;
+
+    checkpoint->perturbedSteps[index] = -1;
+
+    RunNeuron neuron;
+    if (!PrcCloneCheckpoint(checkpoint, &neuron)) return;
+
+    const int onset      = (int)((float)index / config->phases * checkpoint->periodSteps + 0.5f);
+    const int pulseSteps = (int)(config->pulseWidth / neuron.dt + 0.5f);
+    const int maxSteps   = TIMEOUT_CYCLES * checkpoint->periodSteps;
+
+    // Unperturbed approach to the pulse phase, then the pulse, then free run
+    int step = 0;
+    for (; step < onset; step++) RunNeuronStep(&neuron);
+
+    bool spiked = false;
+    RunNeuronSetCurrent(&neuron, config->base.externCurrent + config->pulseAmplitude);
+    for (int i = 0; i < pulseSteps && !spiked; i++) {
+        spiked = RunNeuronStep(&neuron);
+        step++;
+    }
+    RunNeuronSetCurrent(&neuron, config->base.externCurrent);
+
+    if (!spiked) {
+        int remaining = PrcStepsToSpike(&neuron, maxSteps - step);
+        step = (remaining < 0) ? -1 : step + remaining;
+    }
+
+    checkpoint->perturbedSteps[index] = step;
+    RunNeuronFree(&neuron);
+}
+
+// --- Public (API) Function Implementations ---
+
+void PrcConfigDefaults(PrcConfig *config, NeuronModel neuronModel, float externCurrent) {
+    memset(config, 0, sizeof(*config));
+
+    RunSpecDefaults(&config->base, neuronModel);
+    config->base.externCurrent = externCurrent;
+
+    config->phases         = 100;
+    config->pulseAmplitude = (externCurrent * 0.1f > 1.0f) ? externCurrent * 0.1f : 1.0f;
+    config->pulseWidth     = 0.5f;
+    config->transient      = 200.0f;
+}
+
+bool PrcCompute(const PrcConfig *config, PrcResult *result) {
+    if (!config || !result) return false;
+    if (config->phases < 1 || config->phases > PRC_MAX_PHASES || config->pulseWidth < 0.0f) return false;
+
+    memset(result, 0, sizeof(*result));
+
+    // 1. Drive the neuron onto its limit cycle and checkpoint it at a spike
+    RunNeuron neuron;
+    if (!RunNeuronInit(&neuron, &config->base)) return false;
+
+    const int transientSteps = (int)(config->transient / neuron.dt + 0.5f);
+    const int maxPeriodSteps = (int)(MAX_PERIOD / neuron.dt + 0.5f);
+    for (int i = 0; i < transientSteps; i++) RunNeuronStep(&neuron);
+
+    PrcCheckpoint checkpoint = { .config = config, .stateSize = neuron.stateSize };
+
+    bool cycling = PrcStepsToSpike(&neuron, maxPeriodSteps) > 0;
+    if (cycling) {
+        memcpy(checkpoint.state, neuron.state, neuron.stateSize * sizeof(float));
+        checkpoint.potential = neuron.potential;
+
+        // 2. Unperturbed period from the same checkpoint
+        checkpoint.periodSteps = PrcStepsToSpike(&neuron, maxPeriodSteps);
+        cycling = checkpoint.periodSteps > 0;
+    }
+
+    const float dt = neuron.dt;
+    RunNeuronFree(&neuron);
+    if (!cycling) return true;
+
+    result->periodic = true;
+    result->period   = checkpoint.periodSteps * dt;
+
+    // 3. One perturbed cycle per phase, all cloned from the checkpoint
+    int perturbedSteps[PRC_MAX_PHASES];
+    checkpoint.perturbedSteps = perturbedSteps;
+    ParallelFor(config->phases, PrcPerturbedRun, &checkpoint);
+
+    for (int k = 0; k < config->phases; k++) {
+        if (perturbedSteps[k] < 0) continue;
+
+        result->phase[result->count] = (float)k / config->phases;
+        result->shift[result->count] = (float)(checkpoint.periodSteps - perturbedSteps[k]) / checkpoint.periodSteps;
+        result->count++;
+    }
+
+    return true;
+}
+
+bool PrcExportCsv(const PrcResult *result, const char *path) {
+    if (!result || !path || result->count == 0) return false;
+
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "Error: Could not open '%s' for writing.\n", path);
+        return false;
+    }
+
+    fprintf(file, "# period_ms,%.6f\n", result->period);
+    fprintf(file, "phase,shift\n");
+    for (int k = 0; k < result->count; k++) {
+        fprintf(file, "%.6f,%.6f\n", result->phase[k], result->shift[k]);
+    }
+
+    bool ok = (fclose(file) == 0);
+    if (!ok) fprintf(stderr, "Error: Could not write '%s'.\n", path);
+    return ok;
+}
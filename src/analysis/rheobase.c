@@ -0,0 +1,194 @@
+/**
+ * @file rheobase.c
+ * @brief Implementation of the parallel rheobase and threshold search.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "utils/parallel.h"
+#include "analysis/rheobase.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Default probe duration (ms). */
+#define DEFAULT_PROBE_DURATION 500.0f
+
+/** @brief Maximum number of bracket expansion levels. */
+#define MAX_BRACKET_LEVELS 4
+
+/** @brief Maximum number of refinement levels (guards against a tolerance below float resolution). */
+#define MAX_REFINE_LEVELS 64
+
+/** @brief Growth factor of the upper bound between two expansion probes. */
+#define BRACKET_GROWTH 2.0f
+
+/**
+ * @struct RheobaseLevel
+ * @brief One level of parallel probes.
+ */
+typedef struct {
+    const RunSpec *base;
+    const float *currents;
+    int *fired;          ///< 1 if the probe spiked, 0 if not, -1 on failure
+} RheobaseLevel;
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief ParallelFor body: runs one probe of a level.
+ */
+static void RheobaseProbe(int index, void *userData);
+
+/**
+ * @brief Probes 'count' currents in parallel.
+ * @return The index of the smallest firing current, 'count' if none fired,
+ * or -1 if a probe failed.
+ */
+static int RheobaseRunLevel(const RunSpec *base, const float *currents, int count, RheobaseResult *result);
+
+/**
+ * @brief Measures threshold and latency of the first spike at the rheobase.
+ * @return true on success.
+ */
+static bool RheobaseMeasureThreshold(const RunSpec *base, RheobaseResult *result);
+
+// --- Private (static) Function Implementations ---
+
+static void RheobaseProbe(int index, void *userData) {
+    RheobaseLevel *level = (RheobaseLevel*)userData;
+
+    RunSpec spec = *level->base;
+    spec.externCurrent = level->currents[index];
+
+    RunMetrics metrics;
+    if (!SimulationRunHeadless(&spec, &metrics, NULL, 0)) {
+        level->fired[index] = -1;
+        return;
+    }
+    level->fired[index] = (metrics.spikeCount > 0) ? 1 : 0;
+}
+
+static int RheobaseRunLevel(const RunSpec *base, const float *currents, int count, RheobaseResult *result) {
+    int fired[RHEOBASE_MAX_PROBES];
+    RheobaseLevel level = { .base = base, .currents = currents, .fired = fired };
+
+    ParallelFor(count, RheobaseProbe, &level);
+    result->levels++;
+    result->probeCount += count;
+
+    // Probes are sorted by current, so the first firing one bounds the rheobase
+    for (int i = 0; i < count; i++) {
+        if (fired[i] < 0) return -1;
+        if (fired[i] > 0) return i;
+    }
+    return count;
+}
+
+static bool RheobaseMeasureThreshold(const RunSpec *base, RheobaseResult *result) {
+    RunSpec spec = *base;
+    spec.externCurrent = result->rheobase;
+
+    const int steps = (int)(spec.duration / spec.dt + 0.5f);
+    float *trace = (float*)malloc(steps * sizeof(float));
+    if (!trace) return false;
+
+    RunMetrics metrics;
+    bool ok = SimulationRunHeadless(&spec, &metrics, trace, steps);
+    result->probeCount++;
+
+    if (ok) {
+        result->firstSpikeLatency = metrics.firstSpikeTime;
+
+        // Onset of the first spike: first sample where dV/dt crosses the slope criterion
+        result->thresholdPotential = metrics.maxPotential;
+        for (int i = 1; i < steps; i++) {
+            if ((trace[i] - trace[i - 1]) / spec.dt >= RHEOBASE_THRESHOLD_SLOPE) {
+                result->thresholdPotential = trace[i - 1];
+                break;
+            }
+        }
+    }
+
+    free(trace);
+    return ok;
+}
+
+// --- Public (API) Function Implementations ---
+
+void RheobaseConfigDefaults(RheobaseConfig *config, NeuronModel neuronModel) {
+    memset(config, 0, sizeof(*config));
+
+    RunSpecDefaults(&config->base, neuronModel);
+    config->base.duration     = DEFAULT_PROBE_DURATION;
+    config->base.warmStart    = true;
+    config->base.stepFromRest = true;
+
+    config->currentMin     = 0.0f;
+    config->currentMax     = 10.0f;
+    config->tolerance      = 0.01f;
+    config->probesPerLevel = 0;
+}
+
+bool RheobaseFind(const RheobaseConfig *config, RheobaseResult *result) {
+    if (!config || !result) return false;
+    if (config->currentMax <= config->currentMin || config->tolerance <= 0.0f) return false;
+
+    memset(result, 0, sizeof(*result));
+    result->firstSpikeLatency = -1.0f;
+
+    int probes = config->probesPerLevel > 0 ? config->probesPerLevel : ParallelWorkerCount();
+    if (probes < 1) probes = 1;
+    if (probes > RHEOBASE_MAX_PROBES) probes = RHEOBASE_MAX_PROBES;
+
+    float currents[RHEOBASE_MAX_PROBES];
+    float lo = config->currentMin;
+    float hi = config->currentMax;
+
+    // 1. Bracketing: probe the lower bound and a geometric ladder above it
+    bool bracketed = false;
+    for (int level = 0; level < MAX_BRACKET_LEVELS && !bracketed; level++) {
+        int count = 0;
+        if (level == 0) currents[count++] = lo;
+
+        float step = hi - lo;
+        for (float c = hi; count < probes || count < 2; c += step, step *= BRACKET_GROWTH) {
+            currents[count++] = c;
+            if (count == RHEOBASE_MAX_PROBES) break;
+        }
+
+        int first = RheobaseRunLevel(&config->base, currents, count, result);
+        if (first < 0) return false;
+        if (level == 0 && first == 0) {
+            // The lower bound already fires: it is only an upper estimate
+            result->firesAtMin = true;
+            result->rheobase   = lo;
+            return RheobaseMeasureThreshold(&config->base, result);
+        }
+
+        if (first < count) {
+            if (first > 0) lo = currents[first - 1];
+            hi = currents[first];
+            bracketed = true;
+        } else {
+            lo = currents[count - 1];
+            hi = lo + step;
+        }
+    }
+    if (!bracketed) return true;
+
+    // 2. Refinement: parallel multisection of [lo, hi]
+    for (int level = 0; level < MAX_REFINE_LEVELS && hi - lo > config->tolerance; level++) {
+        for (int i = 0; i < probes; i++) {
+            currents[i] = lo + (hi - lo) * (i + 1) / (probes + 1);
+        }
+
+        int first = RheobaseRunLevel(&config->base, currents, probes, result);
+        if (first < 0) return false;
+
+        if (first > 0) lo = currents[first - 1];
+        if (first < probes) hi = currents[first];
+    }
+
+    result->found    = true;
+    result->rheobase = hi;
+    return RheobaseMeasureThreshold(&config->base, result);
+}
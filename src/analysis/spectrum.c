@@ -0,0 +1,207 @@
+/**
+ * @file spectrum.c
+ * @brief Implementation of the incremental Welch / impedance estimator.
+ */
+#include <math.h>
+#include <string.h>
+#include "utils/fft.h"
+#include "analysis/spectrum.h"
+
+// --- Internal Module Constants ---
+
+/** @brief 2*pi in double precision. */
+#define TWO_PI 6.283185307179586
+
+/** @brief Input power below this fraction of the peak marks a bin as unstimulated. */
+#define MIN_INPUT_POWER_FRACTION 1e-6
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Detrends, windows and transforms the pending segment, accumulates
+ * its spectra and keeps the overlapping tail.
+ */
+static void SpectrumProcessSegment(SpectrumEstimator *estimator);
+
+// --- Private (static) Function Implementations ---
+
+static void SpectrumProcessSegment(SpectrumEstimator *estimator) {
+    const int n = estimator->segmentLength;
+    float *re = estimator->scratchRe;
+    float *im = estimator->scratchIm;
+
+    // 1. Remove the segment means (the potential carries a large DC level)
+    double meanOutput = 0.0, meanInput = 0.0;
+    for (int i = 0; i < n; i++) {
+        meanOutput += estimator->output[i];
+        meanInput  += estimator->input[i];
+    }
+    meanOutput /= n;
+    meanInput  /= n;
+
+    // 2. Pack V in the real part and I in the imaginary part: one FFT for both
+    for (int i = 0; i < n; i++) {
+        re[i] = (float)((estimator->output[i] - meanOutput) * estimator->window[i]);
+        im[i] = (float)((estimator->input[i] - meanInput) * estimator->window[i]);
+    }
+    FftRadix2(re, im, n);
+
+    // 3. Unpack: V_k = (Z_k + conj(Z_{n-k})) / 2, I_k = (Z_k - conj(Z_{n-k})) / 2i
+    for (int k = 0; k <= n / 2; k++) {
+        const int m = (n - k) & (n - 1);
+
+        const double vRe = 0.5 * (re[k] + re[m]);
+        const double vIm = 0.5 * (im[k] - im[m]);
+        const double iRe = 0.5 * (im[k] + im[m]);
+        const double iIm = -0.5 * (re[k] - re[m]);
+
+        estimator->powerOutput[k] += vRe * vRe + vIm * vIm;
+        estimator->powerInput[k]  += iRe * iRe + iIm * iIm;
+        estimator->crossRe[k]     += iRe * vRe + iIm * vIm;
+        estimator->crossIm[k]     += iRe * vIm - iIm * vRe;
+    }
+    estimator->segments++;
+
+    // 4. Keep the overlapping tail as the start of the next segment
+    const int keep = n - estimator->hop;
+    memmove(estimator->input, estimator->input + estimator->hop, keep * sizeof(float));
+    memmove(estimator->output, estimator->output + estimator->hop, keep * sizeof(float));
+    estimator->filled = keep;
+}
+
+// --- Public (API) Function Implementations ---
+
+bool SpectrumInit(SpectrumEstimator *estimator, int segmentLength, int decimation, float dt) {
+    if (!estimator || !FftIsPowerOfTwo(segmentLength) || segmentLength < 2) return false;
+    if (segmentLength > SPECTRUM_MAX_SEGMENT || decimation < 1 || dt <= 0.0f) return false;
+
+    memset(estimator, 0, sizeof(*estimator));
+    estimator->segmentLength = segmentLength;
+    estimator->hop           = segmentLength / 2;
+    estimator->decimation    = decimation;
+    estimator->sampleRate    = 1000.0f / (dt * decimation);
+
+    // Periodic Hann window (exact 50% overlap-add)
+    for (int i = 0; i < segmentLength; i++) {
+        const double w = 0.5 - 0.5 * cos(TWO_PI * i / segmentLength);
+        estimator->window[i] = (float)w;
+        estimator->windowPower += w * w;
+    }
+
+    return true;
+}
+
+void SpectrumReset(SpectrumEstimator *estimator) {
+    estimator->filled      = 0;
+    estimator->blockInput  = 0.0;
+    estimator->blockOutput = 0.0;
+    estimator->blockCount  = 0;
+    estimator->segments    = 0;
+
+    memset(estimator->powerOutput, 0, sizeof(estimator->powerOutput));
+    memset(estimator->powerInput, 0, sizeof(estimator->powerInput));
+    memset(estimator->crossRe, 0, sizeof(estimator->crossRe));
+    memset(estimator->crossIm, 0, sizeof(estimator->crossIm));
+}
+
+void SpectrumPush(SpectrumEstimator *estimator, float input, float output) {
+    if (estimator->segmentLength == 0) return;
+
+    estimator->blockInput  += input;
+    estimator->blockOutput += output;
+    if (++estimator->blockCount < estimator->decimation) return;
+
+    estimator->input[estimator->filled]  = (float)(estimator->blockInput / estimator->blockCount);
+    estimator->output[estimator->filled] = (float)(estimator->blockOutput / estimator->blockCount);
+    estimator->filled++;
+
+    estimator->blockInput  = 0.0;
+    estimator->blockOutput = 0.0;
+    estimator->blockCount  = 0;
+
+    if (estimator->filled == estimator->segmentLength) SpectrumProcessSegment(estimator);
+}
+
+int SpectrumBinCount(const SpectrumEstimator *estimator) {
+    return estimator->segmentLength / 2 + 1;
+}
+
+float SpectrumBinFrequency(const SpectrumEstimator *estimator, int bin) {
+    return bin * estimator->sampleRate / estimator->segmentLength;
+}
+
+bool SpectrumGetPower(const SpectrumEstimator *estimator, float *psd) {
+    if (estimator->segments == 0) return false;
+
+    const int bins = SpectrumBinCount(estimator);
+    const double scale = 1.0 / (estimator->sampleRate * estimator->windowPower * estimator->segments);
+
+    for (int k = 0; k < bins; k++) {
+        // One-sided: fold negative frequencies, except DC and Nyquist
+        const double fold = (k == 0 || k == bins - 1) ? 1.0 : 2.0;
+        psd[k] = (float)(fold * estimator->powerOutput[k] * scale);
+    }
+    return true;
+}
+
+bool SpectrumGetImpedance(const SpectrumEstimator *estimator, float *magnitude, float *phase) {
+    if (estimator->segments == 0) return false;
+
+    const int bins = SpectrumBinCount(estimator);
+
+    double peakInput = 0.0;
+    for (int k = 0; k < bins; k++) {
+        if (estimator->powerInput[k] > peakInput) peakInput = estimator->powerInput[k];
+    }
+
+    for (int k = 0; k < bins; k++) {
+        const double sII = estimator->powerInput[k];
+        const bool stimulated = sII > peakInput * MIN_INPUT_POWER_FRACTION && sII > 0.0;
+
+        const double zRe = stimulated ? estimator->crossRe[k] / sII : 0.0;
+        const double zIm = stimulated ? estimator->crossIm[k] / sII : 0.0;
+
+        magnitude[k] = (float)sqrt(zRe * zRe + zIm * zIm);
+        if (phase) phase[k] = (float)atan2(zIm, zRe);
+    }
+    return true;
+}
+
+void ZapConfigDefaults(ZapConfig *zap, float amplitude, float duration) {
+    zap->amplitude = amplitude;
+    zap->fStart    = 1.0f;
+    zap->fEnd      = 100.0f;
+    zap->duration  = duration;
+}
+
+float ZapCurrent(const ZapConfig *zap, float t) {
+    if (zap->duration <= 0.0f) return 0.0f;
+
+    // Seconds into the current sweep; the phase integrates the linear frequency ramp
+    const double sweep = zap->duration * 1e-3;
+    const double ts    = fmod(t * 1e-3, sweep);
+    const double rate  = (zap->fEnd - zap->fStart) / sweep;
+    const double phase = TWO_PI * (zap->fStart * ts + 0.5 * rate * ts * ts);
+
+    return (float)(zap->amplitude * sin(phase));
+}
+
+bool SpectrumImpedanceProfile(const RunSpec *spec, const ZapConfig *zap, SpectrumEstimator *estimator) {
+    if (!spec || !zap || !estimator || zap->duration <= 0.0f) return false;
+
+    RunNeuron neuron;
+    if (!RunNeuronInit(&neuron, spec)) return false;
+
+    SpectrumReset(estimator);
+
+    const int steps = (int)(zap->duration / spec->dt + 0.5f);
+    for (int i = 0; i < steps; i++) {
+        const float current = spec->externCurrent + ZapCurrent(zap, i * spec->dt);
+        RunNeuronSetCurrent(&neuron, current);
+        RunNeuronStep(&neuron);
+        SpectrumPush(estimator, current, neuron.potential);
+    }
+
+    RunNeuronFree(&neuron);
+    return true;
+}
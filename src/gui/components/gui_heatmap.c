@@ -0,0 +1,116 @@
+/**
+ * @file gui_heatmap.c
+ * @brief Implementation of the population voltage heat map widget.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "raylib.h"
+#include "gui/themes/gui_styles.h"
+#include "gui/components/gui_heatmap.h"
+
+/** @brief Number of colormap control points. */
+#define COLORMAP_STOPS 5
+
+/** @brief Control points of the colormap (dark blue -> teal -> green -> yellow), low to high. */
+static const Color kColormap[COLORMAP_STOPS] = {
+    {  68,   1,  84, 255 },
+    {  59,  82, 139, 255 },
+    {  33, 145, 140, 255 },
+    {  94, 201,  98, 255 },
+    { 253, 231,  37, 255 }
+};
+
+/**
+ * @brief Fills the lookup table by linear interpolation of the colormap stops.
+ */
+static void GuiHeatmapBuildLut(GuiHeatmap *widget) {
+    for (int i = 0; i < GUI_HEATMAP_LUT_SIZE; i++) {
+        const float t   = (float)i / (GUI_HEATMAP_LUT_SIZE - 1) * (COLORMAP_STOPS - 1);
+        const int stop  = (t >= COLORMAP_STOPS - 1) ? COLORMAP_STOPS - 2 : (int)t;
+        const float mix = t - stop;
+
+        const Color a = kColormap[stop];
+        const Color b = kColormap[stop + 1];
+        widget->lut[i] = (Color){
+            (unsigned char)(a.r + (b.r - a.r) * mix),
+            (unsigned char)(a.g + (b.g - a.g) * mix),
+            (unsigned char)(a.b + (b.b - a.b) * mix),
+            255
+        };
+    }
+}
+
+bool GuiHeatmapInit(GuiHeatmap *widget, int neuronCount, int columns, float msPerColumn, float vMin, float vMax) {
+    if (!widget || !(vMax > vMin)) return false;
+
+    GuiHeatmapUnload(widget);
+    if (!GuiScrollTextureInit(&widget->scroll, neuronCount, columns, msPerColumn, BLANK)) return false;
+
+    widget->vMin     = vMin;
+    widget->vMax     = vMax;
+    widget->rowSum   = (float*)malloc(widget->scroll.rows * sizeof(float));
+    widget->rowCount = (int*)calloc(widget->scroll.rows, sizeof(int));
+    if (!widget->rowSum || !widget->rowCount) {
+        GuiHeatmapUnload(widget);
+        return false;
+    }
+
+    // Neurons per row are fixed: count them once
+    for (int n = 0; n < neuronCount; n++) widget->rowCount[GuiScrollTextureRow(&widget->scroll, n)]++;
+
+    GuiHeatmapBuildLut(widget);
+    return true;
+}
+
+void GuiHeatmapPushColumn(GuiHeatmap *widget, float time, const float *potentials) {
+    if (!widget->scroll.loaded) return;
+
+    GuiScrollTextureSeek(&widget->scroll, time);
+
+    const int rows = widget->scroll.rows;
+    memset(widget->rowSum, 0, rows * sizeof(float));
+    for (int n = 0; n < widget->scroll.neuronCount; n++) {
+        widget->rowSum[GuiScrollTextureRow(&widget->scroll, n)] += potentials[n];
+    }
+
+    const float scale = (GUI_HEATMAP_LUT_SIZE - 1) / (widget->vMax - widget->vMin);
+    Color *column = GuiScrollTextureHeadColumn(&widget->scroll);
+
+    for (int r = 0; r < rows; r++) {
+        int index = (int)((widget->rowSum[r] / widget->rowCount[r] - widget->vMin) * scale);
+        if (index < 0) index = 0;
+        if (index >= GUI_HEATMAP_LUT_SIZE) index = GUI_HEATMAP_LUT_SIZE - 1;
+        column[r] = widget->lut[index];
+    }
+}
+
+void GuiHeatmapDraw(GuiHeatmap *widget, Rectangle bounds, float time) {
+    const float window = widget->scroll.columns * widget->scroll.msPerColumn;
+
+    PlotCfg frame = {
+        .axisMargin = G_UI_STYLES.plot.axisMargin,
+        .xLabel     = "Time (ms)",
+        .yLabel     = "Neuron",
+        .dataColor  = G_UI_STYLES.colors.plotColor1,
+        .xMin       = time - window, // The newest column is always at the right edge
+        .xMax       = time,
+        .yMin       = 0.0f,
+        .yMax       = (float)widget->scroll.neuronCount,
+        .dataCount  = 0,
+        .fontSize   = G_UI_STYLES.plot.fontSize,
+        .bounds     = bounds,
+        .data       = NULL
+    };
+
+    GuiScrollTextureDraw(&widget->scroll, &frame);
+}
+
+void GuiHeatmapUnload(GuiHeatmap *widget) {
+    if (!widget) return;
+
+    GuiScrollTextureUnload(&widget->scroll);
+    free(widget->rowSum);
+    free(widget->rowCount);
+    widget->rowSum   = NULL;
+    widget->rowCount = NULL;
+}
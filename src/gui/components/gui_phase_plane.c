@@ -0,0 +1,158 @@
+/**
+ * @file gui_phase_plane.c
+ * @brief Implementation of the phase-plane overlay widget.
+ */
+#include <math.h>
+#include "raylib.h"
+#include "gui/themes/gui_styles.h"
+#include "gui/components/gui_phase_plane.h"
+
+/** @brief Fraction of a grid cell covered by a vector-field arrow. */
+#define ARROW_FRACTION 0.4f
+/** @brief Length (in pixels) of the arrow head strokes. */
+#define ARROW_HEAD 3.0f
+/** @brief Radius (in pixels) of the fixed-point markers. */
+#define EQUILIBRIUM_RADIUS 4.0f
+
+/** @brief Short labels for each EquilibriumType. */
+static const char *kEquilibriumLabels[] = {
+    "stable node", "stable focus", "unstable node", "unstable focus", "saddle", "center"
+};
+
+/**
+ * @brief Returns true if two models produce the same analysis.
+ */
+static bool GuiPhasePlaneSameModel(const PhasePlaneModel *a, const PhasePlaneModel *b) {
+    if (a->system != b->system || a->externCurrent != b->externCurrent) return false;
+
+    if (a->system == PHASE_SYSTEM_IZHIKEVICH) {
+        return a->izParams.a == b->izParams.a && a->izParams.b == b->izParams.b
+            && a->izParams.c == b->izParams.c && a->izParams.d == b->izParams.d;
+    }
+
+    return a->hhParams.C == b->hhParams.C && a->hhParams.gL == b->hhParams.gL
+        && a->hhParams.eL == b->hhParams.eL && a->hhParams.eK == b->hhParams.eK
+        && a->hhParams.gK == b->hhParams.gK && a->hhParams.eNa == b->hhParams.eNa
+        && a->hhParams.gNa == b->hhParams.gNa;
+}
+
+/**
+ * @brief Maps a point of the plane to texture pixel coordinates.
+ */
+static Vector2 GuiPhasePlaneToPixel(const PhasePlaneViewport *vp, float width, float height, float x, float y) {
+    return (Vector2){
+        (x - vp->xMin) / (vp->xMax - vp->xMin) * width,
+        height - (y - vp->yMin) / (vp->yMax - vp->yMin) * height
+    };
+}
+
+/**
+ * @brief Re-runs the analysis and renders it into the cached texture.
+ */
+static void GuiPhasePlaneRender(GuiPhasePlane *widget, int width, int height) {
+    const PhasePlaneViewport *vp = &widget->viewport;
+    const PhasePlaneAnalysis *an = &widget->analysis;
+
+    PhasePlaneAnalyze(&widget->model, vp, &widget->analysis);
+
+    BeginTextureMode(widget->texture);
+    ClearBackground(BLANK);
+
+    // Vector field: fixed-length arrows showing the flow direction in screen space
+    const float cellW = (float)width / PHASE_PLANE_FIELD_RES;
+    const float cellH = (float)height / PHASE_PLANE_FIELD_RES;
+    const float length = fminf(cellW, cellH) * ARROW_FRACTION;
+    const Color arrowColor = Fade(G_UI_STYLES.colors.plotAxisColor, 0.35f);
+
+    for (int r = 0; r < PHASE_PLANE_FIELD_RES; r++) {
+        for (int c = 0; c < PHASE_PLANE_FIELD_RES; c++) {
+            const int i = r * PHASE_PLANE_FIELD_RES + c;
+            float sx =  an->fieldDx[i] / (vp->xMax - vp->xMin) * width;
+            float sy = -an->fieldDy[i] / (vp->yMax - vp->yMin) * height;
+            const float norm = sqrtf(sx * sx + sy * sy);
+            if (norm <= 0.0f || !isfinite(norm)) continue;
+            sx /= norm;
+            sy /= norm;
+
+            const Vector2 center = { (c + 0.5f) * cellW, height - (r + 0.5f) * cellH };
+            const Vector2 tail = { center.x - sx * length, center.y - sy * length };
+            const Vector2 tip  = { center.x + sx * length, center.y + sy * length };
+            DrawLineV(tail, tip, arrowColor);
+            DrawLineV(tip, (Vector2){ tip.x - ARROW_HEAD * (sx - sy), tip.y - ARROW_HEAD * (sy + sx) }, arrowColor);
+            DrawLineV(tip, (Vector2){ tip.x - ARROW_HEAD * (sx + sy), tip.y - ARROW_HEAD * (sy - sx) }, arrowColor);
+        }
+    }
+
+    // Nullclines: recovery (dx/dt = 0) and potential (dy/dt = 0)
+    for (int i = 0; i < an->xNullclineCount; i++) {
+        DrawCircleV(GuiPhasePlaneToPixel(vp, width, height, an->xNullcline[i][0], an->xNullcline[i][1]), 1.0f, G_UI_STYLES.colors.plotColor3);
+    }
+    for (int i = 0; i < an->yNullclineCount; i++) {
+        DrawCircleV(GuiPhasePlaneToPixel(vp, width, height, an->yNullcline[i][0], an->yNullcline[i][1]), 1.0f, G_UI_STYLES.colors.plotColor1);
+    }
+
+    // Fixed points: filled if stable, hollow otherwise
+    for (int e = 0; e < an->equilibriumCount; e++) {
+        const PhaseEquilibrium *eq = &an->equilibria[e];
+        const Vector2 p = GuiPhasePlaneToPixel(vp, width, height, eq->x, eq->y);
+        const bool stable = (eq->type == EQUILIBRIUM_STABLE_NODE || eq->type == EQUILIBRIUM_STABLE_FOCUS);
+
+        if (stable) DrawCircleV(p, EQUILIBRIUM_RADIUS, G_UI_STYLES.colors.textColor);
+        else DrawCircleLinesV(p, EQUILIBRIUM_RADIUS, G_UI_STYLES.colors.textColor);
+
+        DrawText(kEquilibriumLabels[eq->type], (int)(p.x + EQUILIBRIUM_RADIUS * 2), (int)(p.y - EQUILIBRIUM_RADIUS),
+                 (int)G_UI_STYLES.plot.fontSize, G_UI_STYLES.colors.textColor);
+    }
+
+    EndTextureMode();
+}
+
+void GuiPhasePlaneUpdate(GuiPhasePlane *widget, const PhasePlaneModel *model, const PlotCfg *cfg) {
+    if (!widget || !model || !cfg) return;
+    if (cfg->xMax <= cfg->xMin || cfg->yMax <= cfg->yMin) return;
+
+    const Rectangle dataRect = GuiPlotGetDataRect(cfg);
+    const int width  = (int)dataRect.width;
+    const int height = (int)dataRect.height;
+    if (width <= 0 || height <= 0) return;
+
+    const PhasePlaneViewport viewport = { cfg->xMin, cfg->xMax, cfg->yMin, cfg->yMax };
+
+    bool resized = !widget->loaded || widget->texture.texture.width != width || widget->texture.texture.height != height;
+    bool changed = resized
+        || !GuiPhasePlaneSameModel(&widget->model, model)
+        || widget->viewport.xMin != viewport.xMin || widget->viewport.xMax != viewport.xMax
+        || widget->viewport.yMin != viewport.yMin || widget->viewport.yMax != viewport.yMax;
+
+    if (resized) {
+        if (widget->loaded) UnloadRenderTexture(widget->texture);
+        widget->texture = LoadRenderTexture(width, height);
+        widget->loaded  = true;
+    }
+
+    if (changed) {
+        widget->model    = *model;
+        widget->viewport = viewport;
+        GuiPhasePlaneRender(widget, width, height);
+    }
+}
+
+void GuiPhasePlaneDraw(const GuiPhasePlane *widget, const PlotCfg *cfg) {
+    if (!widget || !widget->loaded || !cfg) return;
+
+    const Rectangle dataRect = GuiPlotGetDataRect(cfg);
+    const int width  = widget->texture.texture.width;
+    const int height = widget->texture.texture.height;
+    if (width != (int)dataRect.width || height != (int)dataRect.height) return;
+
+    // Render textures are stored upside down: flip with a negative source height
+    Rectangle source = { 0, 0, (float)width, -(float)height };
+    DrawTextureRec(widget->texture.texture, source, (Vector2){ dataRect.x, dataRect.y }, WHITE);
+}
+
+void GuiPhasePlaneUnload(GuiPhasePlane *widget) {
+    if (!widget || !widget->loaded) return;
+
+    UnloadRenderTexture(widget->texture);
+    widget->loaded = false;
+}
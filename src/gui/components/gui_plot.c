@@ -26,18 +26,25 @@ void GuiPlotDraw(const PlotCfg *cfg) {
 }
 
 /**
- * @brief Implementation of the axis drawing logic.
+ * @brief Implementation of the inner plotting rectangle computation.
  */
-void GuiPlotDrawAxes(const PlotCfg *cfg) {
-    if (!cfg) return;
-
-    // Define the inner plotting rectangle
-    Rectangle plotRect = {
+Rectangle GuiPlotGetDataRect(const PlotCfg *cfg) {
+    return (Rectangle){
         cfg->bounds.x + cfg->axisMargin,
         cfg->bounds.y + cfg->axisMargin / 2.0f,
         cfg->bounds.width - cfg->axisMargin * 1.5f,
         cfg->bounds.height - cfg->axisMargin * 1.5f
     };
+}
+
+/**
+ * @brief Implementation of the axis drawing logic.
+ */
+void GuiPlotDrawAxes(const PlotCfg *cfg) {
+    if (!cfg) return;
+
+    // Define the inner plotting rectangle
+    Rectangle plotRect = GuiPlotGetDataRect(cfg);
 
     // Define the origin point (bottom-left of the plot area)
     Vector2 origin = { plotRect.x, plotRect.y + plotRect.height };
@@ -87,12 +94,7 @@ void GuiPlotDrawAxes(const PlotCfg *cfg) {
 void GuiPlotDrawData(const PlotCfg *cfg) {
     if (!cfg || cfg->dataCount <= 1) return;
 
-    Rectangle plotRect = {
-        cfg->bounds.x + cfg->axisMargin,
-        cfg->bounds.y + cfg->axisMargin / 2.0f,
-        cfg->bounds.width - cfg->axisMargin * 1.5f,
-        cfg->bounds.height - cfg->axisMargin * 1.5f
-    };
+    Rectangle plotRect = GuiPlotGetDataRect(cfg);
 
     float xRange = (cfg->xMax - cfg->xMin);
     float yRange = (cfg->yMax - cfg->yMin);
@@ -0,0 +1,54 @@
+/**
+ * @file gui_raster.c
+ * @brief Implementation of the spike raster widget.
+ */
+#include <stddef.h>
+#include "raylib.h"
+#include "gui/themes/gui_styles.h"
+#include "gui/components/gui_raster.h"
+
+bool GuiRasterInit(GuiRaster *widget, int neuronCount, int columns, float msPerColumn) {
+    if (!widget) return false;
+
+    widget->spikeColor = G_UI_STYLES.colors.plotColor1;
+    return GuiScrollTextureInit(&widget->scroll, neuronCount, columns, msPerColumn, BLANK);
+}
+
+void GuiRasterAddSpikes(GuiRaster *widget, float time, const int *neurons, int count) {
+    if (!widget->scroll.loaded) return;
+
+    GuiScrollTextureSeek(&widget->scroll, time);
+    if (count <= 0) return;
+
+    Color *column = GuiScrollTextureHeadColumn(&widget->scroll);
+    for (int i = 0; i < count; i++) {
+        if (neurons[i] < 0 || neurons[i] >= widget->scroll.neuronCount) continue;
+        column[GuiScrollTextureRow(&widget->scroll, neurons[i])] = widget->spikeColor;
+    }
+}
+
+void GuiRasterDraw(GuiRaster *widget, Rectangle bounds, float time) {
+    const float window = widget->scroll.columns * widget->scroll.msPerColumn;
+
+    PlotCfg frame = {
+        .axisMargin = G_UI_STYLES.plot.axisMargin,
+        .xLabel     = "Time (ms)",
+        .yLabel     = "Neuron",
+        .dataColor  = widget->spikeColor,
+        .xMin       = time - window, // The newest column is always at the right edge
+        .xMax       = time,
+        .yMin       = 0.0f,
+        .yMax       = (float)widget->scroll.neuronCount,
+        .dataCount  = 0,
+        .fontSize   = G_UI_STYLES.plot.fontSize,
+        .bounds     = bounds,
+        .data       = NULL
+    };
+
+    GuiScrollTextureDraw(&widget->scroll, &frame);
+}
+
+void GuiRasterUnload(GuiRaster *widget) {
+    if (!widget) return;
+    GuiScrollTextureUnload(&widget->scroll);
+}
@@ -0,0 +1,123 @@
+/**
+ * @file gui_scroll_texture.c
+ * @brief Implementation of the scrolling column texture.
+ */
+#include <stdlib.h>
+#include "raylib.h"
+#include "gui/components/gui_scroll_texture.h"
+
+/**
+ * @brief Fills one column (ring slot) with the background color.
+ */
+static void GuiScrollTextureClearColumn(GuiScrollTexture *widget, int slot) {
+    Color *column = widget->pixels + (size_t)slot * widget->rows;
+    for (int r = 0; r < widget->rows; r++) column[r] = widget->background;
+}
+
+/**
+ * @brief Sends one column (ring slot) to the GPU as a 1-pixel wide sub-upload.
+ */
+static void GuiScrollTextureUploadColumn(GuiScrollTexture *widget, int slot) {
+    Rectangle rec = { (float)slot, 0.0f, 1.0f, (float)widget->rows };
+    UpdateTextureRec(widget->texture, rec, widget->pixels + (size_t)slot * widget->rows);
+}
+
+bool GuiScrollTextureInit(GuiScrollTexture *widget, int neuronCount, int columns, float msPerColumn, Color background) {
+    if (!widget || neuronCount < 1 || columns < 1 || msPerColumn <= 0.0f) return false;
+
+    GuiScrollTextureUnload(widget);
+
+    widget->neuronCount = neuronCount;
+    widget->rows        = (neuronCount < GUI_SCROLL_TEXTURE_MAX_ROWS) ? neuronCount : GUI_SCROLL_TEXTURE_MAX_ROWS;
+    widget->columns     = columns;
+    widget->msPerColumn = msPerColumn;
+    widget->background  = background;
+
+    widget->pixels = (Color*)malloc((size_t)columns * widget->rows * sizeof(Color));
+    if (!widget->pixels) return false;
+    for (int c = 0; c < columns; c++) GuiScrollTextureClearColumn(widget, c);
+
+    // The buffer is uniform, so the initial (row-major) upload is a plain fill
+    Image image = GenImageColor(columns, widget->rows, background);
+    widget->texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    if (widget->texture.id == 0) {
+        free(widget->pixels);
+        widget->pixels = NULL;
+        return false;
+    }
+
+    widget->head      = 0;
+    widget->uploaded  = 0;
+    widget->headDirty = false;
+    widget->loaded    = true;
+    return true;
+}
+
+int GuiScrollTextureRow(const GuiScrollTexture *widget, int neuron) {
+    // Neuron 0 at the bottom, matching the y-axis of the plot frame
+    return widget->rows - 1 - (int)((long long)neuron * widget->rows / widget->neuronCount);
+}
+
+void GuiScrollTextureSeek(GuiScrollTexture *widget, float time) {
+    if (!widget->loaded) return;
+
+    const long target = (long)(time / widget->msPerColumn);
+    if (target <= widget->head) return;
+
+    // Columns older than one full ring are overwritten anyway: clear at most one ring
+    long first = widget->head + 1;
+    if (target - first >= widget->columns) first = target - widget->columns + 1;
+
+    for (long c = first; c <= target; c++) GuiScrollTextureClearColumn(widget, (int)(c % widget->columns));
+
+    widget->head      = target;
+    widget->headDirty = true;
+}
+
+Color *GuiScrollTextureHeadColumn(GuiScrollTexture *widget) {
+    widget->headDirty = true;
+    return widget->pixels + (size_t)(widget->head % widget->columns) * widget->rows;
+}
+
+void GuiScrollTextureDraw(GuiScrollTexture *widget, const PlotCfg *cfg) {
+    GuiPlotDrawAxes(cfg);
+    if (!widget->loaded) return;
+
+    // 1. Upload the columns completed since the last frame (at most one ring),
+    // then the head column if it was written to
+    long first = widget->uploaded;
+    if (widget->head - first >= widget->columns) first = widget->head - widget->columns + 1;
+    for (long c = first; c < widget->head; c++) GuiScrollTextureUploadColumn(widget, (int)(c % widget->columns));
+
+    if (widget->headDirty) {
+        GuiScrollTextureUploadColumn(widget, (int)(widget->head % widget->columns));
+        widget->headDirty = false;
+    }
+    widget->uploaded = widget->head;
+
+    // 2. Draw the ring in two pieces: [head + 1, end) then [0, head]
+    const Rectangle area = GuiPlotGetDataRect(cfg);
+    const int split   = (int)((widget->head + 1) % widget->columns);
+    const float scale = area.width / widget->columns;
+    const float older = (float)(widget->columns - split);
+
+    Rectangle srcOld = { (float)split, 0.0f, older, (float)widget->rows };
+    Rectangle dstOld = { area.x, area.y, older * scale, area.height };
+    Rectangle srcNew = { 0.0f, 0.0f, (float)split, (float)widget->rows };
+    Rectangle dstNew = { area.x + older * scale, area.y, split * scale, area.height };
+
+    if (older > 0.0f) DrawTexturePro(widget->texture, srcOld, dstOld, (Vector2){ 0, 0 }, 0.0f, WHITE);
+    if (split > 0) DrawTexturePro(widget->texture, srcNew, dstNew, (Vector2){ 0, 0 }, 0.0f, WHITE);
+}
+
+void GuiScrollTextureUnload(GuiScrollTexture *widget) {
+    if (!widget) return;
+
+    if (widget->loaded) UnloadTexture(widget->texture);
+    free(widget->pixels);
+
+    widget->pixels = NULL;
+    widget->loaded = false;
+}
@@ -12,6 +12,7 @@
 #include "gui/input/keys_logic.h"
 #include "gui/themes/gui_styles.h"
 #include "simulation/simulation_logic.h"
+#include "simulation/simulation_checkpoint.h"
 
 //================================================================================
 // Static Forward Declarations
@@ -19,7 +20,7 @@
 
 /**
  * @brief Handles key presses related to global screen switching.
- * (e.g., F2 for Documentation, Backspace to return)
+ * (e.g., F2 for Documentation, Backspace to return, F5/F9 checkpoints)
  * @param ctx Pointer to the global AppContext.
  */
 static void ScreenHandleKeys(AppContext *ctx);
@@ -77,6 +78,9 @@ static void ScreenHandleKeys(AppContext *ctx) {
     if (ctx->app.currentScreen == DOCUMENTATION && IsKeyPressed(KEY_BACKSPACE)) ctx->app.currentScreen = MAIN_MENU;
 
     if (ctx->app.currentScreen == MAIN_MENU && IsKeyPressed(KEY_F2)) ctx->app.currentScreen = DOCUMENTATION;
+
+    if (ctx->app.currentScreen == MAIN_MENU && IsKeyPressed(KEY_F5)) SimulationCheckpointSave(ctx, CHECKPOINT_DEFAULT_PATH);
+    if (ctx->app.currentScreen == MAIN_MENU && IsKeyPressed(KEY_F9)) SimulationCheckpointRestore(ctx, CHECKPOINT_DEFAULT_PATH);
 }
 
 /**
@@ -195,16 +199,7 @@ static void ControlsHandleFocusActions(AppContext *ctx) {
 
     switch (ctx->focus.activeControlFocus) {
         case CONTROL_FOCUS_START_BUTTON: {
-            if (IsKeyPressed(KEY_ENTER)) {
-                SimulationReset(ctx);
-
-                if (!ctx->simState.runtime.isRunning) {
-                    ctx->simState.runtime.isRunning = true;
-
-                    if (ctx->tabs.activeNeuronModel == IZHIKEVICH_MODEL) ctx->simState.models.izModel = IzhikevichInitModel(ctx->tabs.activeIzhikevichModel, K_DT);
-                    if (ctx->tabs.activeNeuronModel == HODGKIN_HUXLEY_MODEL) ctx->simState.models.hhModel = HodgkinHuxleyInitModel(K_DT);
-                }
-            }
+            if (IsKeyPressed(KEY_ENTER)) SimulationStart(ctx);
         } break;
 
         case CONTROL_FOCUS_PAUSE_BUTTON: {
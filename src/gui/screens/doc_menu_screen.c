@@ -23,7 +23,17 @@ static const char *DOC_FEATURES =
     "- Precise Math: RK4 Solver (4th Order Runge-Kutta) ensuring\n"
     "  numerical stability for differential equations.\n"
     "- Dynamic Analysis: Simultaneous plotting of V(t) and Phase Plane\n"
-    "  (V vs U) to study limit cycles and equilibrium points.";
+    "  (V vs U) to study limit cycles and equilibrium points, overlaid\n"
+    "  with nullclines, vector field and classified fixed points (HH\n"
+    "  uses the reduced n-V plane).\n"
+    "- Rheobase: FIND RHEOBASE brackets and bisects the step current in\n"
+    "  parallel probes and reports the rheobase and voltage threshold.\n"
+    "- PRC: the PRC tab perturbs the limit cycle at N phases in parallel\n"
+    "  from one checkpointed cycle state; EXPORT CSV writes prc.csv.\n"
+    "- Spectrum: live Welch PSD of V(t) computed block by block while\n"
+    "  recording; with the ZAP stimulus on, the input impedance |Z(f)|.\n"
+    "- Checkpoints: F5 saves the full simulation state to disk and F9\n"
+    "  restores it paused, to resume or branch from a warmed-up run.";
 
 static const char *DOC_HISTORY =
     "VERSIONS HISTORY:\n"
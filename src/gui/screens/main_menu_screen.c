@@ -6,12 +6,22 @@
  * for the main simulation interface, including controls, plots, and info tabs.
  */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
 #include <stdbool.h>
 #include "raylib.h"
 #include "raygui.h"
 #include "gui/themes/gui_styles.h"
 #include "gui/plotting/plot_state.h"
 #include "gui/components/gui_plot.h"
+#include "gui/components/gui_phase_plane.h"
+#include "gui/components/gui_raster.h"
+#include "gui/components/gui_heatmap.h"
+#include "analysis/rheobase.h"
+#include "analysis/prc.h"
+#include "simulation/circuit.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_config.h"
 #include "simulation/simulation_logic.h"
 #include "gui/screens/main_menu_screen.h"
 
@@ -22,6 +32,36 @@ static const float layoutSplitX = 0.25f;    /**< Horizontal split point (percent
 static const float layoutSplitY = 0.5f;     /**< Vertical split point (percentage) for the layout. */
 
 static const char *kNrnModelStr = "Izhikevich;Hodgkin-Huxley"; /**< String for the neuron model ComboBox. */
+static GuiPhasePlane sIzPhasePlane;         /**< Cached phase-plane overlay of the Izhikevich phase plot. */
+static GuiPhasePlane sHHPhasePlane;         /**< Cached phase-plane overlay of the reduced HH phase plot. */
+static RheobaseResult sRheobase;            /**< Result of the last rheobase search. */
+static bool sRheobaseValid = false;         /**< Whether 'sRheobase' holds a completed search. */
+static PrcResult sPrc;                      /**< Last computed phase response curve. */
+static Vector2 sPrcPoints[PRC_MAX_PHASES];  /**< 'sPrc' as plot points (phase, shift). */
+static char sPrcStatus[64] = "No PRC computed";   /**< Status line of the PRC tab. */
+static Vector2 sPsdPoints[SPECTRUM_MAX_BINS];       /**< Live PSD as plot points (Hz, log10 mV^2/Hz). */
+static Vector2 sImpedancePoints[SPECTRUM_MAX_BINS]; /**< Live impedance as plot points (Hz, |Z|). */
+static int sSpectrumBins = 0;                       /**< Valid points in the two arrays above. */
+static int sSpectrumSegments = -1;                  /**< Estimator segment count the arrays were built from. */
+
+/** @brief Highest frequency shown in the spectrum tab (Hz). */
+#define SPECTRUM_PLOT_MAX_FREQ 200.0f
+
+static Circuit sCircuit;                    /**< Circuit of the Network tab (CircuitDefaults). */
+static Network *sNetwork = NULL;            /**< Its spiking network, built on the first START. */
+static Rng sNetworkRng;                     /**< Noise of the network drive. */
+static bool sNetworkRunning = false;        /**< Whether the Network tab advances the network each frame. */
+static float *sNetworkPotentials = NULL;    /**< Potentials by neuron index (one heat-map column). */
+static GuiRaster sRaster;                   /**< Spike raster of the network. */
+static GuiHeatmap sHeatmap;                 /**< Voltage heat map of the network. */
+static char sNetworkStatus[96] = "Network not built";  /**< Status line of the Network tab. */
+
+/** @brief Simulated time (ms) the Network tab advances per frame, and per raster/heat-map column. */
+#define NETWORK_MS_PER_FRAME 2.0f
+
+/** @brief Time bins kept on screen by the raster and heat map. */
+#define NETWORK_VIEW_COLUMNS 500
+
 static const char *KIzModelStr  = "Chaterring;Fast Spiking;Intrinsically Bursting;Low-Threshold Spiking;Regular Spiking;Resonator;Thalamo Cortical"; /**< String for the Izhikevich model ComboBox. */
 
 //================================================================================
@@ -76,6 +116,23 @@ static void MainMenuDrawModelSelectors (AppContext *ctx, Rectangle layout, float
  */
 static void MainMenuDrawSliders(AppContext *ctx, Rectangle layout, float *posY);
 
+/**
+ * @brief Helper for drawing run option checkboxes (e.g., warm start).
+ * @param ctx Pointer to the global AppContext.
+ * @param layout The rectangle for the first widget.
+ * @param posY A pointer to the current Y-position, which will be updated.
+ */
+static void MainMenuDrawOptions(AppContext *ctx, Rectangle layout, float *posY);
+
+/**
+ * @brief Runs the rheobase search for the selected model and applies the result.
+ *
+ * On success the external current is set to the rheobase.
+ *
+ * @param ctx Pointer to the global AppContext.
+ */
+static void MainMenuFindRheobase(AppContext *ctx);
+
 // --- Top-Right Panel (Main Display) Helpers ---
 
 /**
@@ -85,6 +142,17 @@ static void MainMenuDrawSliders(AppContext *ctx, Rectangle layout, float *posY);
  */
 static void MainMenuDrawIzPhasePlot(AppContext *ctx, Rectangle graphRect);
 
+/**
+ * @brief Builds the phase-plane model (parameters and input) of the active neuron.
+ *
+ * Uses the parameters of the running model when there is one, otherwise
+ * the selected preset/default configuration.
+ *
+ * @param ctx Pointer to the global AppContext.
+ * @param model Output phase-plane model.
+ */
+static void MainMenuBuildPhasePlaneModel(AppContext *ctx, PhasePlaneModel *model);
+
 /**
  * @brief Draws the specific plots (Currents, Gates) for the Hodgkin-Huxley model.
  * @param ctx Pointer to the global AppContext.
@@ -108,6 +176,50 @@ static void MainMenuDrawStateTab(AppContext *ctx, Rectangle labelRect);
  */
 static void MainMenuDrawEventsTab(AppContext *ctx, Rectangle labelRect);
 
+/**
+ * @brief Draws the content of the "PRC" tab (compute/export buttons and the curve).
+ * @param ctx Pointer to the global AppContext.
+ * @param tabContentRect The rectangle defining the area for this tab's content.
+ */
+static void MainMenuDrawPrcTab(AppContext *ctx, Rectangle tabContentRect);
+
+/**
+ * @brief Computes the PRC of the selected model at the current extern current.
+ * @param ctx Pointer to the global AppContext.
+ */
+static void MainMenuComputePrc(AppContext *ctx);
+
+/**
+ * @brief Draws the content of the "Spectrum" tab (live PSD and impedance).
+ * @param ctx Pointer to the global AppContext.
+ * @param tabContentRect The rectangle defining the area for this tab's content.
+ */
+static void MainMenuDrawSpectrumTab(AppContext *ctx, Rectangle tabContentRect);
+
+/**
+ * @brief Draws the content of the "Network" tab (spike raster and voltage
+ * heat map of the CircuitDefaults network), advancing it while it runs.
+ * @param tabContentRect The rectangle defining the area for this tab's content.
+ */
+static void MainMenuDrawNetworkTab(Rectangle tabContentRect);
+
+/**
+ * @brief Builds the network of the Network tab and its two views.
+ * @return false on allocation failure (the status line says why).
+ */
+static bool MainMenuBuildNetwork(void);
+
+/**
+ * @brief Advances the network by NETWORK_MS_PER_FRAME, feeding every
+ * step's spikes to the raster and the final potentials to the heat map.
+ */
+static void MainMenuStepNetwork(void);
+
+/**
+ * @brief Releases the network of the Network tab and its views.
+ */
+static void MainMenuFreeNetwork(void);
+
 
 //================================================================================
 // Public Function Implementations
@@ -166,6 +278,15 @@ void ScreenMainMenuDraw(AppContext *ctx) {
     MainMenuDrawbottomRightPanel(ctx, bottomRightPanel);
 }
 
+/**
+ * @brief Releases the GPU resources owned by this screen.
+ */
+void ScreenMainMenuUnload(void) {
+    GuiPhasePlaneUnload(&sIzPhasePlane);
+    GuiPhasePlaneUnload(&sHHPhasePlane);
+    MainMenuFreeNetwork();
+}
+
 //================================================================================
 // Private Function Implementations
 //================================================================================
@@ -198,6 +319,8 @@ static void MainMenuDrawTopLeftPanel(AppContext *ctx, Rectangle topLeftPanel) {
     MainMenuDrawModelSelectors(ctx, (Rectangle){ posX, posY, width, height }, &posY);
 
     MainMenuDrawSliders(ctx, (Rectangle){ posX, posY, width, height }, &posY);
+
+    MainMenuDrawOptions(ctx, (Rectangle){ posX, posY, width, height }, &posY);
 }
 
 /**
@@ -212,22 +335,7 @@ static void MainMenuDrawControlButtons(AppContext *ctx, Rectangle layout) {
     Rectangle btnPause = { layout.x + buttonwidth + G_UI_STYLES.layout.padding, layout.y, buttonwidth, layout.height };
     Rectangle btnReset = { layout.x + (buttonwidth + G_UI_STYLES.layout.padding) * 2, layout.y, buttonwidth, layout.height };
 
-    if (GuiButton(btnStart, "START")) {
-        SimulationReset(ctx);
-
-        if (!ctx->simState.runtime.isRunning) {
-            ctx->simState.runtime.isRunning = true;
-
-            if (ctx->tabs.activeNeuronModel == IZHIKEVICH_MODEL) {
-                int IzhikevichType = ctx->tabs.activeIzhikevichModel;
-                ctx->simState.models.izModel = IzhikevichInitModel(IzhikevichType, K_DT);
-            }
-
-            if (ctx->tabs.activeNeuronModel == HODGKIN_HUXLEY_MODEL) {
-                ctx->simState.models.hhModel = HodgkinHuxleyInitModel(K_DT);
-            }
-        }
-    }
+    if (GuiButton(btnStart, "START")) SimulationStart(ctx);
 
     bool simulationStarted      = (ctx->simState.models.izModel != NULL || ctx->simState.models.hhModel != NULL);
     const char *pauseButtonText = ctx->simState.runtime.isRunning ? "PAUSE" : "CONTINUE";
@@ -321,6 +429,67 @@ static void MainMenuDrawSliders(AppContext *ctx, Rectangle layout, float *posY)
     }
 }
 
+/**
+ * @brief Draws the run option checkboxes. Options are locked while a run is active.
+ * @param ctx Pointer to the global AppContext.
+ * @param layout The rectangle for the first widget.
+ * @param posY A pointer to the current Y-position, which will be updated by this function.
+ */
+static void MainMenuDrawOptions(AppContext *ctx, Rectangle layout, float *posY) {
+    bool simulationStarted = (ctx->simState.models.izModel != NULL || ctx->simState.models.hhModel != NULL);
+
+    Rectangle chkWarmStart = { layout.x, *posY, G_UI_STYLES.label.height, G_UI_STYLES.label.height };
+
+    if (simulationStarted) GuiSetState(STATE_DISABLED);
+    GuiCheckBox(chkWarmStart, "Warm start (skip transient)", &ctx->simState.inputs.warmStart);
+    GuiSetState(STATE_NORMAL);
+
+    *posY += G_UI_STYLES.layout.spacingBetweenLines + G_UI_STYLES.layout.padding;
+
+    Rectangle chkZap = { layout.x, *posY, G_UI_STYLES.label.height, G_UI_STYLES.label.height };
+
+    if (simulationStarted) GuiSetState(STATE_DISABLED);
+    GuiCheckBox(chkZap, TextFormat("ZAP stimulus (%.0f-%.0f Hz)", ctx->simState.inputs.zap.fStart, ctx->simState.inputs.zap.fEnd),
+                &ctx->simState.inputs.zapEnabled);
+    GuiSetState(STATE_NORMAL);
+
+    *posY += G_UI_STYLES.layout.spacingBetweenLines + G_UI_STYLES.layout.padding;
+
+    Rectangle btnRheobase = { layout.x, *posY, layout.width, layout.height };
+
+    if (simulationStarted) GuiSetState(STATE_DISABLED);
+    if (GuiButton(btnRheobase, "FIND RHEOBASE")) MainMenuFindRheobase(ctx);
+    GuiSetState(STATE_NORMAL);
+
+    *posY += G_UI_STYLES.layout.spacingBetweenLines + G_UI_STYLES.layout.padding;
+
+    if (sRheobaseValid) {
+        const char *rheobaseText = sRheobase.found
+            ? TextFormat("Rheobase: %.2f pA  Vth: %.1f mV", sRheobase.rheobase, sRheobase.thresholdPotential)
+            : sRheobase.firesAtMin ? TextFormat("Rheobase: <= %.2f pA (fires at the lower bound)", sRheobase.rheobase)
+            : "Rheobase: no spike in search range";
+        GuiLabel((Rectangle){ layout.x, *posY, layout.width, G_UI_STYLES.label.height }, rheobaseText);
+        *posY += G_UI_STYLES.layout.spacingBetweenLines;
+    }
+}
+
+/**
+ * @brief Runs the rheobase search for the selected model and applies the result.
+ * @param ctx Pointer to the global AppContext.
+ */
+static void MainMenuFindRheobase(AppContext *ctx) {
+    RheobaseConfig config;
+    RheobaseConfigDefaults(&config, ctx->tabs.activeNeuronModel);
+
+    if (ctx->tabs.activeNeuronModel == IZHIKEVICH_MODEL) {
+        config.base.izParams = IZHIKEVICH_PARAMETERS[ctx->tabs.activeIzhikevichModel];
+    }
+    config.currentMax = G_UI_STYLES.slider.currentMaxvalue;
+
+    sRheobaseValid = RheobaseFind(&config, &sRheobase);
+    if (sRheobaseValid && sRheobase.found) ctx->simState.inputs.externCurrent = sRheobase.rheobase;
+}
+
 //--------------------------------------------------------------------------------
 // Top-Right Panel (Main Display)
 //--------------------------------------------------------------------------------
@@ -421,13 +590,16 @@ static void MainMenuDrawbottomRightPanel(AppContext *ctx, Rectangle bottomRightP
     };
 
     // --- Auxiliary Display Tabs ---
-    const char *tabsName[] = { "Actual state", "Event Log" };
-    int result             = GuiTabBar(tabRect, tabsName, 2, (int*)&ctx->tabs.activeTab);
-    if (result >= 0 && result < 2) ctx->tabs.activeTab = (AuxiliaryTabType)result;
+    const char *tabsName[] = { "Actual state", "Event Log", "PRC", "Spectrum", "Network" };
+    int result             = GuiTabBar(tabRect, tabsName, 5, (int*)&ctx->tabs.activeTab);
+    if (result >= 0 && result < 5) ctx->tabs.activeTab = (AuxiliaryTabType)result;
 
     switch (ctx->tabs.activeTab) {
         case TAB_STATE: MainMenuDrawStateTab(ctx, tabContentRect); break;
         case TAB_EVENTS: MainMenuDrawEventsTab(ctx, tabContentRect); break;
+        case TAB_PRC: MainMenuDrawPrcTab(ctx, tabContentRect); break;
+        case TAB_SPECTRUM: MainMenuDrawSpectrumTab(ctx, tabContentRect); break;
+        case TAB_NETWORK: MainMenuDrawNetworkTab(tabContentRect); break;
         default: break;
     }
 }
@@ -524,6 +696,245 @@ static void MainMenuDrawEventsTab(AppContext *ctx, Rectangle labelRect) {
     DrawText("Soon...", labelRect.x + 10, labelRect.y + 10, 40, G_UI_STYLES.colors.textSpecial);
 }
 
+/**
+ * @brief Draws the content of the "PRC" tab.
+ * @param ctx Pointer to the global AppContext.
+ * @param tabContentRect The rectangle defining the area for this tab's content.
+ */
+static void MainMenuDrawPrcTab(AppContext *ctx, Rectangle tabContentRect) {
+    Rectangle btnCompute = { tabContentRect.x, tabContentRect.y, G_UI_STYLES.button.width, G_UI_STYLES.button.height };
+    Rectangle btnExport  = { btnCompute.x + btnCompute.width + G_UI_STYLES.layout.padding, btnCompute.y, btnCompute.width, btnCompute.height };
+
+    if (GuiButton(btnCompute, "COMPUTE PRC")) MainMenuComputePrc(ctx);
+
+    if (sPrc.count == 0) GuiSetState(STATE_DISABLED);
+    if (GuiButton(btnExport, "EXPORT CSV")) {
+        bool exported = PrcExportCsv(&sPrc, PRC_DEFAULT_EXPORT_PATH);
+        snprintf(sPrcStatus, sizeof(sPrcStatus), "%s", exported ? "Exported to " PRC_DEFAULT_EXPORT_PATH : "Export failed");
+    }
+    GuiSetState(STATE_NORMAL);
+
+    DrawText(sPrcStatus, btnExport.x + btnExport.width + G_UI_STYLES.layout.padding * 2, btnCompute.y + G_UI_STYLES.layout.padding,
+             G_UI_STYLES.plot.fontSize, G_UI_STYLES.colors.textColor);
+
+    if (sPrc.count == 0) return;
+
+    // Symmetric y-range around zero, fitted to the curve
+    float yMax = 0.01f;
+    for (int k = 0; k < sPrc.count; k++) {
+        if (sPrc.shift[k] > yMax) yMax = sPrc.shift[k];
+        if (-sPrc.shift[k] > yMax) yMax = -sPrc.shift[k];
+    }
+
+    float plotTop = btnCompute.y + btnCompute.height + G_UI_STYLES.layout.padding * 2;
+    PlotCfg prcPlotCfg = {
+        .axisMargin = G_UI_STYLES.plot.axisMargin,
+        .xLabel     = "Phase",
+        .yLabel     = "Phase advance",
+        .dataColor  = G_UI_STYLES.colors.plotColor1,
+        .xMin       = 0.0f,
+        .xMax       = 1.0f,
+        .yMin       = -yMax * 1.1f,
+        .yMax       = yMax * 1.1f,
+        .dataCount  = sPrc.count,
+        .fontSize   = G_UI_STYLES.plot.fontSize,
+        .bounds     = { tabContentRect.x, plotTop, tabContentRect.width, tabContentRect.y + tabContentRect.height - plotTop },
+        .data       = sPrcPoints
+    };
+
+    GuiPlotDraw(&prcPlotCfg);
+}
+
+/**
+ * @brief Draws the content of the "Spectrum" tab.
+ *
+ * The plot points are rebuilt only when the estimator has accumulated a
+ * new segment.
+ *
+ * @param ctx Pointer to the global AppContext.
+ * @param tabContentRect The rectangle defining the area for this tab's content.
+ */
+static void MainMenuDrawSpectrumTab(AppContext *ctx, Rectangle tabContentRect) {
+    const SpectrumEstimator *spectrum = &ctx->simState.spectrum;
+
+    if (spectrum->segments == 0) {
+        DrawText("Waiting for the first spectral segment...", tabContentRect.x, tabContentRect.y, G_UI_STYLES.plot.fontSize, G_UI_STYLES.colors.textColor);
+        sSpectrumSegments = -1;
+        return;
+    }
+
+    static float psd[SPECTRUM_MAX_BINS];
+    static float magnitude[SPECTRUM_MAX_BINS];
+    static float psdMin, psdMax, zMax;
+
+    if (spectrum->segments != sSpectrumSegments) {
+        SpectrumGetPower(spectrum, psd);
+        SpectrumGetImpedance(spectrum, magnitude, NULL);
+
+        sSpectrumBins = 0;
+        psdMin = 1e30f; psdMax = -1e30f; zMax = 1e-6f;
+        for (int k = 1; k < SpectrumBinCount(spectrum); k++) {
+            float frequency = SpectrumBinFrequency(spectrum, k);
+            if (frequency > SPECTRUM_PLOT_MAX_FREQ) break;
+
+            float logPower = log10f(psd[k] + 1e-12f);
+            if (logPower < psdMin) psdMin = logPower;
+            if (logPower > psdMax) psdMax = logPower;
+            if (magnitude[k] > zMax) zMax = magnitude[k];
+
+            sPsdPoints[sSpectrumBins]       = (Vector2){ frequency, logPower };
+            sImpedancePoints[sSpectrumBins] = (Vector2){ frequency, magnitude[k] };
+            sSpectrumBins++;
+        }
+        sSpectrumSegments = spectrum->segments;
+    }
+
+    float halfWidth = (tabContentRect.width - G_UI_STYLES.layout.padding) / 2.0f;
+    bool showImpedance = ctx->simState.inputs.zapEnabled;
+
+    PlotCfg psdPlotCfg = {
+        .axisMargin = G_UI_STYLES.plot.axisMargin,
+        .xLabel     = "Frequency (Hz)",
+        .yLabel     = "log10 PSD (mV^2/Hz)",
+        .dataColor  = G_UI_STYLES.colors.plotColor1,
+        .xMin       = 0.0f,
+        .xMax       = SPECTRUM_PLOT_MAX_FREQ,
+        .yMin       = psdMin - 0.5f,
+        .yMax       = psdMax + 0.5f,
+        .dataCount  = sSpectrumBins,
+        .fontSize   = G_UI_STYLES.plot.fontSize,
+        .bounds     = { tabContentRect.x, tabContentRect.y, showImpedance ? halfWidth : tabContentRect.width, tabContentRect.height },
+        .data       = sPsdPoints
+    };
+    GuiPlotDraw(&psdPlotCfg);
+
+    if (!showImpedance) return;
+
+    PlotCfg impedancePlotCfg = psdPlotCfg;
+    impedancePlotCfg.yLabel    = "|Z| (mV/pA)";
+    impedancePlotCfg.dataColor = G_UI_STYLES.colors.plotColor2;
+    impedancePlotCfg.yMin      = 0.0f;
+    impedancePlotCfg.yMax      = zMax * 1.1f;
+    impedancePlotCfg.bounds.x  = tabContentRect.x + halfWidth + G_UI_STYLES.layout.padding;
+    impedancePlotCfg.data      = sImpedancePoints;
+    GuiPlotDraw(&impedancePlotCfg);
+}
+
+/**
+ * @brief Draws the content of the "Network" tab.
+ *
+ * The network only advances while this tab is shown and running.
+ *
+ * @param tabContentRect The rectangle defining the area for this tab's content.
+ */
+static void MainMenuDrawNetworkTab(Rectangle tabContentRect) {
+    Rectangle btnRun   = { tabContentRect.x, tabContentRect.y, G_UI_STYLES.button.width, G_UI_STYLES.button.height };
+    Rectangle btnReset = { btnRun.x + btnRun.width + G_UI_STYLES.layout.padding, btnRun.y, btnRun.width, btnRun.height };
+
+    if (GuiButton(btnRun, sNetworkRunning ? "PAUSE" : "START")) {
+        sNetworkRunning = !sNetworkRunning;
+        if (sNetworkRunning && !sNetwork && !MainMenuBuildNetwork()) sNetworkRunning = false;
+    }
+    if (!sNetwork) GuiSetState(STATE_DISABLED);
+    if (GuiButton(btnReset, "RESET")) {
+        MainMenuFreeNetwork();
+        snprintf(sNetworkStatus, sizeof(sNetworkStatus), "Network not built");
+    }
+    GuiSetState(STATE_NORMAL);
+
+    if (sNetwork && sNetworkRunning) MainMenuStepNetwork();
+
+    DrawText(sNetworkStatus, btnReset.x + btnReset.width + G_UI_STYLES.layout.padding * 2, btnRun.y + G_UI_STYLES.layout.padding,
+             G_UI_STYLES.plot.fontSize, G_UI_STYLES.colors.textColor);
+
+    if (!sNetwork) return;
+
+    float plotTop   = btnRun.y + btnRun.height + G_UI_STYLES.layout.padding * 2;
+    float halfWidth = (tabContentRect.width - G_UI_STYLES.layout.padding) / 2.0f;
+    Rectangle rasterRect  = { tabContentRect.x, plotTop, halfWidth, tabContentRect.y + tabContentRect.height - plotTop };
+    Rectangle heatmapRect = { rasterRect.x + halfWidth + G_UI_STYLES.layout.padding, plotTop, halfWidth, rasterRect.height };
+
+    GuiRasterDraw(&sRaster, rasterRect, (float)sNetwork->time);
+    GuiHeatmapDraw(&sHeatmap, heatmapRect, (float)sNetwork->time);
+}
+
+static bool MainMenuBuildNetwork(void) {
+    CircuitDefaults(&sCircuit);
+    RngSeed(&sNetworkRng, sCircuit.seed + 1);
+
+    // One update thread: the network shares the frame with the GUI
+    sNetwork = CircuitBuildNetwork(&sCircuit, 1);
+    if (sNetwork) sNetworkPotentials = (float*)malloc(sNetwork->neuronCount * sizeof(float));
+
+    const int count = sNetwork ? sNetwork->neuronCount : 0;
+    if (!sNetwork || !sNetworkPotentials
+        || !GuiRasterInit(&sRaster, count, NETWORK_VIEW_COLUMNS, NETWORK_MS_PER_FRAME)
+        || !GuiHeatmapInit(&sHeatmap, count, NETWORK_VIEW_COLUMNS, NETWORK_MS_PER_FRAME, -80.0f, 30.0f)) {
+        MainMenuFreeNetwork();
+        snprintf(sNetworkStatus, sizeof(sNetworkStatus), "Network build failed");
+        return false;
+    }
+    return true;
+}
+
+static void MainMenuStepNetwork(void) {
+    const int steps = (int)lroundf(NETWORK_MS_PER_FRAME / sNetwork->dt);
+    int spikes = 0;
+
+    for (int s = 0; s < steps; s++) {
+        CircuitApplyDrive(&sCircuit, sNetwork, &sNetworkRng);
+        NetworkStep(sNetwork);
+        GuiRasterAddSpikes(&sRaster, (float)sNetwork->time, sNetwork->spikes, sNetwork->spikeCount);
+        spikes += sNetwork->spikeCount;
+    }
+
+    // Potentials are stored by group in network order: scatter them back to neuron indices
+    for (int g = 0; g < sNetwork->groupCount; g++) {
+        const float *v    = PopulationPotential(sNetwork->groups[g]);
+        const int begin   = sNetwork->groupStart[g];
+        const int count   = sNetwork->groupStart[g + 1] - begin;
+        for (int i = 0; i < count; i++) sNetworkPotentials[sNetwork->order[begin + i]] = v[i];
+    }
+    GuiHeatmapPushColumn(&sHeatmap, (float)sNetwork->time, sNetworkPotentials);
+
+    const float rate = spikes / (sNetwork->neuronCount * NETWORK_MS_PER_FRAME * 1e-3f);
+    snprintf(sNetworkStatus, sizeof(sNetworkStatus), "%d neurons, t = %.0f ms, %.1f Hz", sNetwork->neuronCount, sNetwork->time, rate);
+}
+
+static void MainMenuFreeNetwork(void) {
+    NetworkFree(sNetwork);
+    free(sNetworkPotentials);
+    GuiRasterUnload(&sRaster);
+    GuiHeatmapUnload(&sHeatmap);
+    sNetwork           = NULL;
+    sNetworkPotentials = NULL;
+    sNetworkRunning    = false;
+}
+
+/**
+ * @brief Computes the PRC of the selected model at the current extern current.
+ * @param ctx Pointer to the global AppContext.
+ */
+static void MainMenuComputePrc(AppContext *ctx) {
+    PhasePlaneModel model;
+    MainMenuBuildPhasePlaneModel(ctx, &model);
+
+    PrcConfig config;
+    PrcConfigDefaults(&config, ctx->tabs.activeNeuronModel, ctx->simState.inputs.externCurrent);
+    config.base.izParams = model.izParams;
+    config.base.hhParams = model.hhParams;
+
+    if (!PrcCompute(&config, &sPrc)) {
+        sPrc.count = 0;
+        snprintf(sPrcStatus, sizeof(sPrcStatus), "PRC failed");
+        return;
+    }
+
+    for (int k = 0; k < sPrc.count; k++) sPrcPoints[k] = (Vector2){ sPrc.phase[k], sPrc.shift[k] };
+    if (sPrc.periodic) snprintf(sPrcStatus, sizeof(sPrcStatus), "Period: %.2f ms", sPrc.period);
+    else snprintf(sPrcStatus, sizeof(sPrcStatus), "No repetitive firing at this current");
+}
+
 
 //--------------------------------------------------------------------------------
 // Plot Drawing Functions (Panel Helpers)
@@ -550,9 +961,53 @@ static void MainMenuDrawIzPhasePlot(AppContext *ctx, Rectangle graphRect) {
         .data       = ctx->simState.plotData.phase
     };
 
+    PhasePlaneModel phaseModel;
+    MainMenuBuildPhasePlaneModel(ctx, &phaseModel);
+
+    GuiPhasePlaneUpdate(&sIzPhasePlane, &phaseModel, &izPhasePlotCfg);
+    GuiPhasePlaneDraw(&sIzPhasePlane, &izPhasePlotCfg);
     GuiPlotDraw(&izPhasePlotCfg);
 }
 
+/**
+ * @brief Builds the phase-plane model from the running model or the selected configuration.
+ * @param ctx Pointer to the global AppContext.
+ * @param model Output phase-plane model.
+ */
+static void MainMenuBuildPhasePlaneModel(AppContext *ctx, PhasePlaneModel *model) {
+    const IzhikevichModel *izModel    = ctx->simState.models.izModel;
+    const HodgkinHuxleyModel *hhModel = ctx->simState.models.hhModel;
+
+    *model = (PhasePlaneModel){ 0 };
+    model->externCurrent = ctx->simState.inputs.externCurrent;
+
+    if (ctx->tabs.activeNeuronModel == IZHIKEVICH_MODEL) {
+        model->system   = PHASE_SYSTEM_IZHIKEVICH;
+        model->izParams = IZHIKEVICH_PARAMETERS[ctx->tabs.activeIzhikevichModel];
+        if (izModel) {
+            model->izParams.a = *(izModel->neuron.params.a);
+            model->izParams.b = *(izModel->neuron.params.b);
+            model->izParams.c = *(izModel->neuron.params.c);
+            model->izParams.d = *(izModel->neuron.params.d);
+        }
+    } else {
+        model->system = PHASE_SYSTEM_HH_REDUCED;
+        if (hhModel) {
+            model->hhParams = hhModel->neuron.params;
+        } else {
+            model->hhParams = (HodgkinHuxleyParams){
+                .C   = HH_CONFIG.membraneCapacitancy,
+                .gL  = HH_CONFIG.leakConductance,
+                .eL  = HH_CONFIG.leakReversal,
+                .eK  = HH_CONFIG.potassiumReversal,
+                .gK  = HH_CONFIG.potassiumConductance,
+                .eNa = HH_CONFIG.sodiumReversal,
+                .gNa = HH_CONFIG.sodiumConductance
+            };
+        }
+    }
+}
+
 /**
  * @brief Draws the Hodgkin-Huxley scrolling plots (Currents and Gating variables).
  * @param ctx Pointer to the global AppContext.
@@ -561,18 +1016,16 @@ static void MainMenuDrawIzPhasePlot(AppContext *ctx, Rectangle graphRect) {
 static void MainMenuDrawHHPhasePlots(AppContext *ctx, Rectangle tabContentRect) {
     float singlePlotHeight = tabContentRect.height - G_UI_STYLES.layout.padding * 4.0f;
 
-    // Virtual area for the scroll (2 plots high)
+    // Virtual area for the scroll (3 plots high)
     Rectangle contentSize = {
         0, 0,
         tabContentRect.width - G_UI_STYLES.layout.padding * 2,
-        (singlePlotHeight * 2) + (G_UI_STYLES.layout.padding * 4.)
+        (singlePlotHeight * 3) + (G_UI_STYLES.layout.padding * 6.)
     };
 
     Rectangle visibleContent = { 0 };
     GuiScrollPanel(tabContentRect, NULL, contentSize, &ctx->tabs.phasePlotScroll, &visibleContent);
 
-    BeginScissorMode(visibleContent.x, visibleContent.y, visibleContent.width, visibleContent.height);
-
     float plotwidth = visibleContent.width - G_UI_STYLES.layout.padding * 4.0f;
 
     // Plot positions inside the scroll panel
@@ -590,6 +1043,13 @@ static void MainMenuDrawHHPhasePlots(AppContext *ctx, Rectangle tabContentRect)
         singlePlotHeight
     };
 
+    Rectangle graphArea3 = {
+        visibleContent.x + G_UI_STYLES.layout.padding * 2.0f,
+        graphArea2.y + singlePlotHeight + G_UI_STYLES.layout.padding * 2.0f,
+        plotwidth,
+        singlePlotHeight
+    };
+
     // --- HH Plot Configurations ---
 
     // Plot 1: Currents
@@ -684,7 +1144,29 @@ static void MainMenuDrawHHPhasePlots(AppContext *ctx, Rectangle tabContentRect)
         .data       = ctx->simState.plotData.hhGatePlots.HGate
     };
 
+    // Plot 3: Reduced phase plane (n vs V)
+    PlotCfg hhPhasePlotCfg = {
+        .axisMargin = G_UI_STYLES.plot.axisMargin,
+        .xLabel     = "N Gate",
+        .yLabel     = "Potential (mV)",
+        .dataColor  = G_UI_STYLES.colors.plotColor2,
+        .xMin       = G_PLOT_STATE.probYMin,
+        .xMax       = G_PLOT_STATE.probYMax,
+        .yMin       = G_PLOT_STATE.plotYMin,
+        .yMax       = G_PLOT_STATE.plotYMax,
+        .dataCount  = ctx->simState.plotData.dataCount,
+        .fontSize   = G_UI_STYLES.plot.fontSize,
+        .bounds     = graphArea3,
+        .data       = ctx->simState.plotData.phase
+    };
+
+    // The overlay texture is rendered before the scissor: it would clip the render target too
+    PhasePlaneModel phaseModel;
+    MainMenuBuildPhasePlaneModel(ctx, &phaseModel);
+    GuiPhasePlaneUpdate(&sHHPhasePlane, &phaseModel, &hhPhasePlotCfg);
+
     // --- Plot Drawing ---
+    BeginScissorMode(visibleContent.x, visibleContent.y, visibleContent.width, visibleContent.height);
 
     // Plot 1: Currents (draw axes + 3 data lines)
     GuiPlotDrawAxes(&hhINaPlotCfg);
@@ -698,5 +1180,9 @@ static void MainMenuDrawHHPhasePlots(AppContext *ctx, Rectangle tabContentRect)
     GuiPlotDrawData(&hhHProbPlotCfg);
     GuiPlotDrawData(&hhMProbPlotCfg); // Draw M last
 
+    // Plot 3: Phase plane overlay + trajectory
+    GuiPhasePlaneDraw(&sHHPhasePlane, &hhPhasePlotCfg);
+    GuiPlotDraw(&hhPhasePlotCfg);
+
     EndScissorMode();
 }
@@ -47,6 +47,7 @@ int main (void) {
     }
 
     SimulationReset(&gAppContext);
+    ScreenMainMenuUnload();
     CloseWindow();
     return 0;
 }
@@ -64,8 +65,13 @@ static void AppInit(void) {
         .inputs.externCurrent    = 0.00f,
         .inputs.ampaConductancy  = 0.00f,
         .inputs.gabaaConductancy = 0.00f,
+        .inputs.warmStart        = false,
+        .inputs.zapEnabled       = false,
     };
 
+    ZapConfigDefaults(&gAppContext.simState.inputs.zap, 5.0f, (K_MAX_PLOT_POINTS - 1) * K_DT);
+    SpectrumInit(&gAppContext.simState.spectrum, SPECTRUM_DEFAULT_SEGMENT, SPECTRUM_DEFAULT_DECIMATION, K_DT);
+
     gAppContext.tabs = (Tabs) {
         .activeTab             = 0,
         .activeNeuronModel     = 0,
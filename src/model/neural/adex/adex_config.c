@@ -0,0 +1,45 @@
+/**
+ * @file adex_config.c
+ * @brief Defines the constant parameter values for the AdEx model.
+ */
+#include "model/neural/adex/adex_config.h"
+
+/**
+ * @brief Global array of AdEx parameter sets.
+ *
+ * The cutoff is VT + 5 dT for every preset: the exponential term has
+ * taken over by then, and the remaining upswing would be a fraction of a
+ * step at the usual time steps.
+ */
+const AdexConfig ADEX_PARAMETERS[] = {
+    [ADEX_BRETTE_GERSTNER] = {
+        .capacitance = 281.0f, .leakConductance = 30.0f, .leakReversal = -70.6f,
+        .thresholdPotential = -50.4f, .slopeFactor = 2.0f, .cutoff = -40.4f, .resetPotential = -70.6f,
+        .subthresholdAdaptation = 4.0f, .spikeAdaptation = 80.5f, .adaptationTau = 144.0f,
+        .tauExcitatory = 5.0f, .tauInhibitory = 10.0f
+    },
+    [ADEX_TONIC] = {
+        .capacitance = 200.0f, .leakConductance = 10.0f, .leakReversal = -70.0f,
+        .thresholdPotential = -50.0f, .slopeFactor = 2.0f, .cutoff = -40.0f, .resetPotential = -58.0f,
+        .subthresholdAdaptation = 2.0f, .spikeAdaptation = 0.0f, .adaptationTau = 30.0f,
+        .tauExcitatory = 5.0f, .tauInhibitory = 10.0f
+    },
+    [ADEX_ADAPTING] = {
+        .capacitance = 200.0f, .leakConductance = 12.0f, .leakReversal = -70.0f,
+        .thresholdPotential = -50.0f, .slopeFactor = 2.0f, .cutoff = -40.0f, .resetPotential = -58.0f,
+        .subthresholdAdaptation = 2.0f, .spikeAdaptation = 60.0f, .adaptationTau = 300.0f,
+        .tauExcitatory = 5.0f, .tauInhibitory = 10.0f
+    },
+    [ADEX_INITIAL_BURST] = {
+        .capacitance = 130.0f, .leakConductance = 18.0f, .leakReversal = -58.0f,
+        .thresholdPotential = -50.0f, .slopeFactor = 2.0f, .cutoff = -40.0f, .resetPotential = -50.0f,
+        .subthresholdAdaptation = 4.0f, .spikeAdaptation = 120.0f, .adaptationTau = 150.0f,
+        .tauExcitatory = 5.0f, .tauInhibitory = 10.0f
+    },
+    [ADEX_BURSTING] = {
+        .capacitance = 200.0f, .leakConductance = 10.0f, .leakReversal = -58.0f,
+        .thresholdPotential = -50.0f, .slopeFactor = 2.0f, .cutoff = -40.0f, .resetPotential = -46.0f,
+        .subthresholdAdaptation = 2.0f, .spikeAdaptation = 100.0f, .adaptationTau = 120.0f,
+        .tauExcitatory = 5.0f, .tauInhibitory = 10.0f
+    }
+};
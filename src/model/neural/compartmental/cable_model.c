@@ -0,0 +1,277 @@
+/**
+ * @file cable_model.c
+ * @brief Implementation of the implicit multi-compartment solver.
+ */
+#include <math.h>
+#include <stdlib.h>
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_config.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_rates.h"
+#include "model/neural/compartmental/cable_model.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Membrane area HH_CONFIG refers to: a 30 um sphere (um^2). */
+#define HH_REFERENCE_AREA (900.0 * 3.14159265358979323846)
+
+/** @brief Leak reversal of passive compartments: the HH resting potential (mV). */
+#define PASSIVE_LEAK_REVERSAL 0.0f
+
+/** @brief Number of per-compartment float arrays. */
+#define CELL_FLOAT_ARRAYS 14
+
+/** @brief Pi, for areas and cross-sections. */
+#define CABLE_PI 3.14159265358979323846
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Resistance (Ohm) of half of a compartment along its axis (0 for the soma).
+ */
+static double CableHalfResistance(const CableMorphology *morph, int index, double axialResistivity);
+
+/**
+ * @brief Advances the gates exactly for frozen potentials (exponential Euler).
+ */
+static void CableUpdateGates(CableCell *cell, float dt);
+
+/**
+ * @brief Solves the tree-structured system in place (result in cell->rhs).
+ *
+ * 'offDiag' is the (symmetric) coupling between each compartment and its parent.
+ */
+static void CableHinesSolve(CableCell *cell, const float *offDiag);
+
+/**
+ * @brief ParallelPoolRun body: steps one cell of a population.
+ */
+static void CablePopulationStepCell(int index, void *userData);
+
+// --- Private (static) Function Implementations ---
+
+static double CableHalfResistance(const CableMorphology *morph, int index, double axialResistivity) {
+    if (morph->parent[index] < 0) return 0.0;
+
+    // R = Ra * (L / 2) / (pi d^2 / 4), with um converted to cm
+    const double halfLength = 0.5 * morph->length[index] * 1e-4;
+    const double radius     = 0.5 * morph->diameter[index] * 1e-4;
+    return axialResistivity * halfLength / (CABLE_PI * radius * radius);
+}
+
+static void CableUpdateGates(CableCell *cell, float dt) {
+    for (int i = 0; i < cell->count; i++) {
+        if (cell->gNa[i] == 0.0f && cell->gK[i] == 0.0f) continue;
+
+        const float v = cell->v[i];
+        const float am = AlphaM(v), bm = BetaM(v);
+        const float ah = AlphaH(v), bh = BetaH(v);
+        const float an = AlphaN(v), bn = BetaN(v);
+
+        // x(t + dt) = xInf + (x - xInf) * exp(-dt / tau), exact for constant v
+        cell->m[i] = am / (am + bm) + (cell->m[i] - am / (am + bm)) * expf(-dt * (am + bm));
+        cell->h[i] = ah / (ah + bh) + (cell->h[i] - ah / (ah + bh)) * expf(-dt * (ah + bh));
+        cell->n[i] = an / (an + bn) + (cell->n[i] - an / (an + bn)) * expf(-dt * (an + bn));
+    }
+}
+
+static void CableHinesSolve(CableCell *cell, const float *offDiag) {
+    float *d = cell->diag;
+    float *b = cell->rhs;
+
+    // Elimination from the leaves towards the soma: each row folds into its parent
+    for (int i = cell->count - 1; i > 0; i--) {
+        const int p   = cell->parent[i];
+        const float f = offDiag[i] / d[i];
+        d[p] -= f * offDiag[i];
+        b[p] -= f * b[i];
+    }
+
+    // Substitution from the soma outwards
+    b[0] /= d[0];
+    for (int i = 1; i < cell->count; i++) {
+        b[i] = (b[i] - offDiag[i] * b[cell->parent[i]]) / d[i];
+    }
+}
+
+static void CablePopulationStepCell(int index, void *userData) {
+    CablePopulation *pop = (CablePopulation*)userData;
+    pop->spiked[index] = CableCellStep(pop->cells[index], pop->dt, pop->scheme);
+}
+
+// --- Public (API) Function Implementations ---
+
+CableCell *CableCellCreate(const CableMorphology *morph, float axialResistivity) {
+    if (!morph || morph->count == 0 || axialResistivity <= 0.0f) return NULL;
+
+    const int count = morph->count;
+    CableCell *cell = (CableCell*)calloc(1, sizeof(CableCell));
+    if (!cell) return NULL;
+
+    int *order     = (int*)malloc(count * sizeof(int));
+    cell->parent   = (int*)malloc(count * sizeof(int));
+    cell->position = (int*)malloc(count * sizeof(int));
+    cell->buffer   = (float*)calloc((size_t)count * CELL_FLOAT_ARRAYS, sizeof(float));
+    if (!order || !cell->parent || !cell->position || !cell->buffer || !CableMorphologyHinesOrder(morph, order)) {
+        free(order);
+        CableCellFree(cell);
+        return NULL;
+    }
+
+    cell->count       = count;
+    cell->v           = cell->buffer;
+    cell->m           = cell->v + count;
+    cell->h           = cell->m + count;
+    cell->n           = cell->h + count;
+    cell->iExt        = cell->n + count;
+    cell->capacitance = cell->iExt + count;
+    cell->gNa         = cell->capacitance + count;
+    cell->gK          = cell->gNa + count;
+    cell->gL          = cell->gK + count;
+    cell->eL          = cell->gL + count;
+    cell->axial       = cell->eL + count;
+    cell->diag        = cell->axial + count;
+    cell->rhs         = cell->diag + count;
+    cell->coupling    = cell->rhs + count;
+
+    for (int k = 0; k < count; k++) cell->position[order[k]] = k;
+
+    // Gates at their steady state for the resting potential
+    const float am = AlphaM(0.0f), bm = BetaM(0.0f);
+    const float ah = AlphaH(0.0f), bh = BetaH(0.0f);
+    const float an = AlphaN(0.0f), bn = BetaN(0.0f);
+
+    for (int k = 0; k < count; k++) {
+        const int src = order[k];
+        const int parentSrc = morph->parent[src];
+        cell->parent[k] = parentSrc < 0 ? -1 : cell->position[parentSrc];
+
+        const double diameter = morph->diameter[src];
+        const double area  = parentSrc < 0 ? CABLE_PI * diameter * diameter : CABLE_PI * diameter * morph->length[src];
+        const double scale = area / HH_REFERENCE_AREA;
+
+        cell->capacitance[k] = (float)(HH_CONFIG.membraneCapacitancy * scale);
+        cell->gL[k]          = (float)(HH_CONFIG.leakConductance * scale);
+        if (morph->active[src]) {
+            cell->gNa[k] = (float)(HH_CONFIG.sodiumConductance * scale);
+            cell->gK[k]  = (float)(HH_CONFIG.potassiumConductance * scale);
+            cell->eL[k]  = HH_CONFIG.leakReversal;
+        } else {
+            cell->eL[k]  = PASSIVE_LEAK_REVERSAL;
+        }
+
+        if (parentSrc >= 0) {
+            const double resistance = CableHalfResistance(morph, src, axialResistivity)
+                                    + CableHalfResistance(morph, parentSrc, axialResistivity);
+            cell->axial[k] = (float)(1e9 / resistance);
+        }
+
+        cell->v[k] = 0.0f;
+        cell->m[k] = am / (am + bm);
+        cell->h[k] = ah / (ah + bh);
+        cell->n[k] = an / (an + bn);
+    }
+
+    free(order);
+    return cell;
+}
+
+bool CableCellStep(CableCell *cell, float dt, CableScheme scheme) {
+    const float theta = (scheme == CABLE_CRANK_NICOLSON) ? 0.5f : 1.0f;
+    const int count = cell->count;
+    float *offDiag = cell->coupling;
+
+    // 1. Gates for the current potentials
+    CableUpdateGates(cell, dt);
+
+    // 2. Membrane terms. With the gates frozen the ionic current is linear
+    // in v: I = GE - G v, with G the total conductance
+    for (int i = 0; i < count; i++) {
+        const float m = cell->m[i], h = cell->h[i], n = cell->n[i];
+        const float gNa = cell->gNa[i] * m * m * m * h;
+        const float gK  = cell->gK[i] * n * n * n * n;
+        const float G   = gNa + gK + cell->gL[i];
+        const float GE  = gNa * HH_CONFIG.sodiumReversal + gK * HH_CONFIG.potassiumReversal + cell->gL[i] * cell->eL[i];
+        const float cdt = cell->capacitance[i] / dt;
+
+        cell->diag[i] = cdt + theta * G;
+        cell->rhs[i]  = cdt * cell->v[i] + GE + cell->iExt[i] - (1.0f - theta) * G * cell->v[i];
+    }
+
+    // 3. Axial coupling of every compartment with its parent
+    for (int i = 1; i < count; i++) {
+        const int p   = cell->parent[i];
+        const float g = cell->axial[i];
+        const float flow = (1.0f - theta) * g * (cell->v[p] - cell->v[i]);
+
+        cell->diag[i] += theta * g;
+        cell->diag[p] += theta * g;
+        cell->rhs[i]  += flow;
+        cell->rhs[p]  -= flow;
+        offDiag[i]     = -theta * g;
+    }
+
+    // 4. O(N) tree solve
+    CableHinesSolve(cell, offDiag);
+
+    const float somaBefore = cell->v[0];
+    for (int i = 0; i < count; i++) cell->v[i] = cell->rhs[i];
+
+    const bool above = cell->v[0] >= HH_SPIKE_THRESHOLD;
+    const bool spiked = above && !cell->somaAbove && somaBefore < HH_SPIKE_THRESHOLD;
+    cell->somaAbove = above;
+    return spiked;
+}
+
+void CableCellFree(CableCell *cell) {
+    if (!cell) return;
+    free(cell->parent);
+    free(cell->position);
+    free(cell->buffer);
+    free(cell);
+}
+
+CablePopulation *CablePopulationCreate(const CableMorphology *morph, int count, float axialResistivity,
+                                       float dt, CableScheme scheme, int threads) {
+    if (count <= 0 || dt <= 0.0f) return NULL;
+
+    CablePopulation *pop = (CablePopulation*)calloc(1, sizeof(CablePopulation));
+    if (!pop) return NULL;
+
+    pop->count  = count;
+    pop->dt     = dt;
+    pop->scheme = scheme;
+    pop->cells  = (CableCell**)calloc(count, sizeof(CableCell*));
+    pop->spiked = (bool*)calloc(count, sizeof(bool));
+    pop->pool   = ParallelPoolCreate(threads);
+    if (!pop->cells || !pop->spiked || !pop->pool) {
+        CablePopulationFree(pop);
+        return NULL;
+    }
+
+    for (int c = 0; c < count; c++) {
+        pop->cells[c] = CableCellCreate(morph, axialResistivity);
+        if (!pop->cells[c]) {
+            CablePopulationFree(pop);
+            return NULL;
+        }
+    }
+    return pop;
+}
+
+int CablePopulationStep(CablePopulation *pop) {
+    ParallelPoolRun(pop->pool, pop->count, CablePopulationStepCell, pop);
+
+    int spikes = 0;
+    for (int c = 0; c < pop->count; c++) spikes += pop->spiked[c];
+    return spikes;
+}
+
+void CablePopulationFree(CablePopulation *pop) {
+    if (!pop) return;
+    if (pop->cells) {
+        for (int c = 0; c < pop->count; c++) CableCellFree(pop->cells[c]);
+    }
+    ParallelPoolDestroy(pop->pool);
+    free(pop->cells);
+    free(pop->spiked);
+    free(pop);
+}
@@ -0,0 +1,134 @@
+/**
+ * @file cable_morphology.c
+ * @brief Implementation of the compartment tree and its Hines ordering.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "model/neural/compartmental/cable_morphology.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Initial compartment capacity. */
+#define INITIAL_CAPACITY 32
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Grows the arrays to hold at least 'needed' compartments.
+ * @return false on allocation failure.
+ */
+static bool CableMorphologyReserve(CableMorphology *morph, int needed);
+
+/**
+ * @brief Appends one compartment (capacity must be reserved).
+ */
+static int CableMorphologyAppend(CableMorphology *morph, int parent, float length, float diameter, bool active);
+
+// --- Private (static) Function Implementations ---
+
+static bool CableMorphologyReserve(CableMorphology *morph, int needed) {
+    if (needed <= morph->capacity) return true;
+
+    int capacity = morph->capacity ? morph->capacity : INITIAL_CAPACITY;
+    while (capacity < needed) capacity *= 2;
+
+    int *parent     = (int*)realloc(morph->parent, capacity * sizeof(int));
+    if (parent) morph->parent = parent;
+    float *length   = (float*)realloc(morph->length, capacity * sizeof(float));
+    if (length) morph->length = length;
+    float *diameter = (float*)realloc(morph->diameter, capacity * sizeof(float));
+    if (diameter) morph->diameter = diameter;
+    bool *active    = (bool*)realloc(morph->active, capacity * sizeof(bool));
+    if (active) morph->active = active;
+
+    if (!parent || !length || !diameter || !active) return false;
+    morph->capacity = capacity;
+    return true;
+}
+
+static int CableMorphologyAppend(CableMorphology *morph, int parent, float length, float diameter, bool active) {
+    const int index = morph->count++;
+    morph->parent[index]   = parent;
+    morph->length[index]   = length;
+    morph->diameter[index] = diameter;
+    morph->active[index]   = active;
+    return index;
+}
+
+// --- Public (API) Function Implementations ---
+
+void CableMorphologyInit(CableMorphology *morph) {
+    memset(morph, 0, sizeof(*morph));
+}
+
+int CableMorphologyAddSoma(CableMorphology *morph, float diameter) {
+    if (morph->count != 0 || diameter <= 0.0f || !CableMorphologyReserve(morph, 1)) return -1;
+    return CableMorphologyAppend(morph, -1, 0.0f, diameter, true);
+}
+
+int CableMorphologyAddSection(CableMorphology *morph, int parent, float length, float diameter, int segments, bool active) {
+    if (parent < 0 || parent >= morph->count || length <= 0.0f || diameter <= 0.0f || segments < 1) return -1;
+    if (!CableMorphologyReserve(morph, morph->count + segments)) return -1;
+
+    int last = parent;
+    for (int s = 0; s < segments; s++) {
+        last = CableMorphologyAppend(morph, last, length / segments, diameter, active);
+    }
+    return last;
+}
+
+bool CableMorphologyBallAndStick(CableMorphology *morph, float somaDiameter,
+                                 float dendriteLength, float dendriteDiameter, int segments) {
+    CableMorphologyInit(morph);
+    if (CableMorphologyAddSoma(morph, somaDiameter) < 0) return false;
+    return CableMorphologyAddSection(morph, 0, dendriteLength, dendriteDiameter, segments, false) >= 0;
+}
+
+bool CableMorphologyHinesOrder(const CableMorphology *morph, int *order) {
+    const int n = morph->count;
+    if (n == 0 || morph->parent[0] != -1) return false;
+
+    // Children lists in compressed form (child order preserved)
+    int *start = (int*)calloc(n + 1, sizeof(int));
+    int *child = (int*)malloc(n * sizeof(int));
+    int *stack = (int*)malloc(n * sizeof(int));
+    if (!start || !child || !stack) {
+        free(start);
+        free(child);
+        free(stack);
+        return false;
+    }
+
+    bool valid = true;
+    for (int i = 1; i < n; i++) {
+        if (morph->parent[i] < 0 || morph->parent[i] >= n) valid = false;
+        else start[morph->parent[i] + 1]++;
+    }
+    for (int i = 0; i < n; i++) start[i + 1] += start[i];
+    for (int i = 1; i < n && valid; i++) child[start[morph->parent[i]]++] = i;
+    for (int i = n; i > 0; i--) start[i] = start[i - 1];
+    start[0] = 0;
+
+    // Depth-first traversal; children are pushed in reverse so the first
+    // child (the continuation of a section) is visited next
+    int placed = 0, top = 0;
+    if (valid) stack[top++] = 0;
+    while (top > 0) {
+        const int node = stack[--top];
+        order[placed++] = node;
+        for (int k = start[node + 1] - 1; k >= start[node]; k--) stack[top++] = child[k];
+    }
+
+    free(start);
+    free(child);
+    free(stack);
+    return valid && placed == n;
+}
+
+void CableMorphologyFree(CableMorphology *morph) {
+    free(morph->parent);
+    free(morph->length);
+    free(morph->diameter);
+    free(morph->active);
+    memset(morph, 0, sizeof(*morph));
+}
@@ -32,3 +32,8 @@ const HodgkinHuxleyConfig HH_CONFIG = {
     .sodiumConductance    = 1080.0f * PI,
     .potassiumConductance = 324.0f * PI
 };
+
+/**
+ * @brief Spike detection threshold (in mV) for the HH model.
+ */
+const float HH_SPIKE_THRESHOLD = 50.0f;
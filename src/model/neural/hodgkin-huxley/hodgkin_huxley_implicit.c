@@ -0,0 +1,356 @@
+/**
+ * @file hodgkin_huxley_implicit.c
+ * @brief Implementation of the implicit (backward Euler / BDF2) HH batch.
+ *
+ * Every step solves y - b - gamma * f(y) = 0 per neuron:
+ *   backward Euler: b = y_n,                          gamma = dt
+ *   BDF2:           b = (4 y_n - y_{n-1}) / 3,        gamma = 2 dt / 3
+ * Newton's matrix I - gamma * J is an arrow matrix (gate rows only couple
+ * to V), so each gate row is eliminated into the V row and the 4x4 system
+ * reduces to one scalar division plus back substitution.
+ */
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_config.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_rates.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_implicit.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Newton convergence tolerance on the potential update (mV). */
+#define NEWTON_TOL_V 1e-4
+
+/** @brief Newton convergence tolerance on the gate updates. */
+#define NEWTON_TOL_GATE 1e-6
+
+/** @brief Largest potential change accepted in one Newton iteration (mV). */
+#define NEWTON_MAX_DV 30.0
+
+/** @brief Below this |u| the function u / (e^u - 1) is evaluated by its Taylor series. */
+#define SERIES_LIMIT 1e-4
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Computes g(u) = u / (e^u - 1) and its derivative (regular at u = 0).
+ */
+static void ExpRatio(double u, double *g, double *dg);
+
+/**
+ * @brief Computes the six gate rates and their derivatives with respect to V.
+ *
+ * Order: alphaM, betaM, alphaH, betaH, alphaN, betaN. Matches
+ * hodgkin_huxley_rates.c in double precision.
+ */
+static void GateRates(double v, double rate[6], double drate[6]);
+
+/**
+ * @brief Evaluates f(y) and the non-zero entries of the Jacobian.
+ *
+ * 'dv' holds dfV/d(V, m, h, n); 'gateV' holds dfx/dV and 'gateX' dfx/dx
+ * for x = m, h, n (the arrow structure of the HH Jacobian).
+ */
+static void HHArrowJacobian(const HodgkinHuxleyParams *p, double current, const double y[4], double f[4],
+                            double dv[4], double gateV[3], double gateX[3]);
+
+/**
+ * @brief Clamps a gate variable to [0, 1].
+ */
+static inline double ClampGate(double x);
+
+/**
+ * @brief Runs the Newton iterations of one step for neurons [begin, end) and
+ * accepts the result.
+ * @param iterations Output: iterations used by the slowest neuron.
+ * @return true if every neuron converged.
+ */
+static bool HHImplicitSolve(HodgkinHuxleyImplicitBatch *batch, int begin, int end, int *iterations);
+
+// --- Private (static) Function Implementations ---
+
+static void ExpRatio(double u, double *g, double *dg) {
+    if (fabs(u) < SERIES_LIMIT) {
+        *g  = 1.0 - u / 2.0 + u * u / 12.0;
+        *dg = -0.5 + u / 6.0;
+        return;
+    }
+
+    const double e  = exp(u);
+    const double em = e - 1.0;
+    *g  = u / em;
+    *dg = (em - u * e) / (em * em);
+}
+
+static void GateRates(double v, double rate[6], double drate[6]) {
+    double g, dg;
+
+    // alphaM = g((25 - V) / 10)
+    ExpRatio((25.0 - v) / 10.0, &g, &dg);
+    rate[0]  = g;
+    drate[0] = -dg / 10.0;
+
+    rate[1]  = 4.0 * exp(-v / 18.0);
+    drate[1] = -rate[1] / 18.0;
+
+    rate[2]  = 0.07 * exp(-v / 20.0);
+    drate[2] = -rate[2] / 20.0;
+
+    const double w = exp((30.0 - v) / 10.0);
+    rate[3]  = 1.0 / (w + 1.0);
+    drate[3] = (w / 10.0) * rate[3] * rate[3];
+
+    // alphaN = 0.1 * g((10 - V) / 10)
+    ExpRatio((10.0 - v) / 10.0, &g, &dg);
+    rate[4]  = 0.1 * g;
+    drate[4] = -0.01 * dg;
+
+    rate[5]  = 0.125 * exp(-v / 80.0);
+    drate[5] = -rate[5] / 80.0;
+}
+
+static void HHArrowJacobian(const HodgkinHuxleyParams *p, double current, const double y[4], double f[4],
+                            double dv[4], double gateV[3], double gateX[3]) {
+    const double v = y[0], m = y[1], h = y[2], n = y[3];
+    const double m3 = m * m * m;
+    const double n3 = n * n * n;
+
+    const double gNa = p->gNa * m3 * h;
+    const double gK  = p->gK * n3 * n;
+    const double invC = 1.0 / p->C;
+
+    f[0] = (gNa * (p->eNa - v) + gK * (p->eK - v) + p->gL * (p->eL - v) + current) * invC;
+
+    dv[0] = -(gNa + gK + p->gL) * invC;
+    dv[1] = 3.0 * p->gNa * m * m * h * (p->eNa - v) * invC;
+    dv[2] = p->gNa * m3 * (p->eNa - v) * invC;
+    dv[3] = 4.0 * p->gK * n3 * (p->eK - v) * invC;
+
+    double rate[6], drate[6];
+    GateRates(v, rate, drate);
+
+    for (int g = 0; g < 3; g++) {
+        const double x     = y[g + 1];
+        const double alpha = rate[2 * g], beta = rate[2 * g + 1];
+        f[g + 1]  = alpha * (1.0 - x) - beta * x;
+        gateV[g]  = drate[2 * g] * (1.0 - x) - drate[2 * g + 1] * x;
+        gateX[g]  = -(alpha + beta);
+    }
+}
+
+static inline double ClampGate(double x) {
+    if (x < 0.0) return 0.0;
+    if (x > 1.0) return 1.0;
+    return x;
+}
+
+static bool HHImplicitSolve(HodgkinHuxleyImplicitBatch *batch, int begin, int end, int *iterations) {
+    const int count = batch->count;
+    const int range = end - begin;
+    const bool bdf2Scheme = batch->scheme == HH_IMPLICIT_BDF2;
+
+    // Newton iterates, initialized with the current state
+    float *vNew = batch->scratch;
+    float *mNew = vNew + count;
+    float *hNew = mNew + count;
+    float *nNew = hNew + count;
+    memcpy(vNew + begin, batch->v + begin, (size_t)range * sizeof(float));
+    memcpy(mNew + begin, batch->m + begin, (size_t)range * sizeof(float));
+    memcpy(hNew + begin, batch->h + begin, (size_t)range * sizeof(float));
+    memcpy(nNew + begin, batch->n + begin, (size_t)range * sizeof(float));
+
+    // All neurons iterate in lockstep until the slowest one has converged
+    bool converged = false;
+    int iter = 0;
+    while (!converged && iter < HH_NEWTON_MAX_ITER) {
+        converged = true;
+        iter++;
+
+        for (int i = begin; i < end; i++) {
+            const bool bdf2 = bdf2Scheme && batch->history[i];
+            const double gamma = bdf2 ? 2.0 * batch->dt / 3.0 : batch->dt;
+            const double y[4] = { vNew[i], mNew[i], hNew[i], nNew[i] };
+            double b[4];
+            if (bdf2) {
+                b[0] = (4.0 * batch->v[i] - batch->vPrev[i]) / 3.0;
+                b[1] = (4.0 * batch->m[i] - batch->mPrev[i]) / 3.0;
+                b[2] = (4.0 * batch->h[i] - batch->hPrev[i]) / 3.0;
+                b[3] = (4.0 * batch->n[i] - batch->nPrev[i]) / 3.0;
+            } else {
+                b[0] = batch->v[i];
+                b[1] = batch->m[i];
+                b[2] = batch->h[i];
+                b[3] = batch->n[i];
+            }
+
+            double f[4], dv[4], gateV[3], gateX[3];
+            HHArrowJacobian(&batch->params, (double)batch->iExt[i] + batch->iSyn[i], y, f, dv, gateV, gateX);
+
+            // Residual G = y - b - gamma * f and Newton matrix A = I - gamma * J
+            double residual[4];
+            for (int k = 0; k < 4; k++) residual[k] = y[k] - b[k] - gamma * f[k];
+
+            // Eliminate the gate rows into the V row (Schur complement)
+            double schur = 1.0 - gamma * dv[0];
+            double rhs   = -residual[0];
+            double gateDiag[3];
+            for (int g = 0; g < 3; g++) {
+                gateDiag[g] = 1.0 - gamma * gateX[g];
+                const double aVx = -gamma * dv[g + 1];
+                const double axV = -gamma * gateV[g];
+                schur -= aVx * axV / gateDiag[g];
+                rhs   += aVx * residual[g + 1] / gateDiag[g];
+            }
+
+            double deltaV = rhs / schur;
+            if (deltaV > NEWTON_MAX_DV) deltaV = NEWTON_MAX_DV;
+            if (deltaV < -NEWTON_MAX_DV) deltaV = -NEWTON_MAX_DV;
+
+            double delta[3];
+            for (int g = 0; g < 3; g++) {
+                delta[g] = (-residual[g + 1] + gamma * gateV[g] * deltaV) / gateDiag[g];
+            }
+
+            vNew[i] = (float)(y[0] + deltaV);
+            mNew[i] = (float)ClampGate(y[1] + delta[0]);
+            hNew[i] = (float)ClampGate(y[2] + delta[1]);
+            nNew[i] = (float)ClampGate(y[3] + delta[2]);
+
+            if (fabs(deltaV) > NEWTON_TOL_V || fabs(delta[0]) > NEWTON_TOL_GATE
+                || fabs(delta[1]) > NEWTON_TOL_GATE || fabs(delta[2]) > NEWTON_TOL_GATE) {
+                converged = false;
+                if (iter == HH_NEWTON_MAX_ITER) batch->unconverged[i]++;
+            }
+        }
+    }
+
+    // Shift the history and accept the new state
+    memcpy(batch->vPrev + begin, batch->v + begin, (size_t)range * sizeof(float));
+    memcpy(batch->mPrev + begin, batch->m + begin, (size_t)range * sizeof(float));
+    memcpy(batch->hPrev + begin, batch->h + begin, (size_t)range * sizeof(float));
+    memcpy(batch->nPrev + begin, batch->n + begin, (size_t)range * sizeof(float));
+    memcpy(batch->v + begin, vNew + begin, (size_t)range * sizeof(float));
+    memcpy(batch->m + begin, mNew + begin, (size_t)range * sizeof(float));
+    memcpy(batch->h + begin, hNew + begin, (size_t)range * sizeof(float));
+    memcpy(batch->n + begin, nNew + begin, (size_t)range * sizeof(float));
+    for (int i = begin; i < end; i++) batch->history[i] = true;
+
+    *iterations = iter;
+    return converged;
+}
+
+// --- Public (API) Function Implementations ---
+
+void HodgkinHuxleyJacobian(const HodgkinHuxleyParams *params, float current, const float *y, float *f, float *jac) {
+    const double yd[4] = { y[0], y[1], y[2], y[3] };
+    double fd[4], dv[4], gateV[3], gateX[3];
+    HHArrowJacobian(params, current, yd, fd, dv, gateV, gateX);
+
+    if (f) {
+        for (int i = 0; i < 4; i++) f[i] = (float)fd[i];
+    }
+    if (jac) {
+        memset(jac, 0, 16 * sizeof(float));
+        for (int j = 0; j < 4; j++) jac[j] = (float)dv[j];
+        for (int g = 0; g < 3; g++) {
+            jac[4 * (g + 1)]         = (float)gateV[g];
+            jac[4 * (g + 1) + g + 1] = (float)gateX[g];
+        }
+    }
+}
+
+HodgkinHuxleyImplicitBatch *HodgkinHuxleyImplicitInit(int count, const HodgkinHuxleyParams *params,
+                                                      float dt, HodgkinHuxleyImplicitScheme scheme) {
+    if (count <= 0 || !params || dt <= 0.0f) return NULL;
+
+    HodgkinHuxleyImplicitBatch *batch = (HodgkinHuxleyImplicitBatch*)calloc(1, sizeof(HodgkinHuxleyImplicitBatch));
+    if (!batch) return NULL;
+
+    batch->buffer  = (float*)calloc((size_t)count * HH_IMPLICIT_BATCH_ARRAYS, sizeof(float));
+    batch->history = (bool*)calloc(count, sizeof(bool));
+    batch->unconverged = (int*)calloc(count, sizeof(int));
+    if (!batch->buffer || !batch->history || !batch->unconverged) {
+        HodgkinHuxleyImplicitFree(batch);
+        return NULL;
+    }
+
+    batch->count  = count;
+    batch->dt     = dt;
+    batch->scheme = scheme;
+    batch->params = *params;
+
+    // With count == 1 the first four arrays form the (V, m, h, n) vector
+    float *p = batch->buffer;
+    batch->v       = p; p += count;
+    batch->m       = p; p += count;
+    batch->h       = p; p += count;
+    batch->n       = p; p += count;
+    batch->vPrev   = p; p += count;
+    batch->mPrev   = p; p += count;
+    batch->hPrev   = p; p += count;
+    batch->nPrev   = p; p += count;
+    batch->iExt    = p; p += count;
+    batch->iSyn    = p; p += count;
+    batch->scratch = p;
+
+    const float rest = HH_CONFIG.restingPotential;
+    const float y[4] = {
+        rest,
+        AlphaM(rest) / (AlphaM(rest) + BetaM(rest)),
+        AlphaH(rest) / (AlphaH(rest) + BetaH(rest)),
+        AlphaN(rest) / (AlphaN(rest) + BetaN(rest))
+    };
+    for (int i = 0; i < count; i++) HodgkinHuxleyImplicitSetState(batch, i, y);
+
+    return batch;
+}
+
+void HodgkinHuxleyImplicitSetState(HodgkinHuxleyImplicitBatch *batch, int index, const float *y) {
+    if (!batch || index < 0 || index >= batch->count) return;
+
+    batch->v[index] = y[0];
+    batch->m[index] = y[1];
+    batch->h[index] = y[2];
+    batch->n[index] = y[3];
+    batch->history[index] = false;
+}
+
+bool HodgkinHuxleyImplicitStep(HodgkinHuxleyImplicitBatch *batch) {
+    if (!batch) return false;
+
+    batch->lastConverged = HHImplicitSolve(batch, 0, batch->count, &batch->lastIterations);
+    memset(batch->iSyn, 0, (size_t)batch->count * sizeof(float));
+    return batch->lastConverged;
+}
+
+int HodgkinHuxleyImplicitStepRange(HodgkinHuxleyImplicitBatch *batch, int begin, int end, int *spikes, double *inputSum) {
+    int iterations;
+    HHImplicitSolve(batch, begin, end, &iterations);
+
+    double synaptic = 0.0;
+    int fired = 0;
+    for (int i = begin; i < end; i++) {
+        synaptic += batch->iSyn[i];
+        batch->iSyn[i] = 0.0f;
+        if (batch->vPrev[i] < HH_SPIKE_THRESHOLD && batch->v[i] >= HH_SPIKE_THRESHOLD) spikes[fired++] = i;
+    }
+
+    if (inputSum) *inputSum += synaptic;
+    return fired;
+}
+
+long HodgkinHuxleyImplicitUnconvergedSteps(const HodgkinHuxleyImplicitBatch *batch) {
+    if (!batch) return 0;
+
+    long total = 0;
+    for (int i = 0; i < batch->count; i++) total += batch->unconverged[i];
+    return total;
+}
+
+void HodgkinHuxleyImplicitFree(HodgkinHuxleyImplicitBatch *batch) {
+    if (!batch) return;
+    free(batch->buffer);
+    free(batch->history);
+    free(batch->unconverged);
+    free(batch);
+}
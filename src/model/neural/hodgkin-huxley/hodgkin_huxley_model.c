@@ -18,12 +18,12 @@
 /** @brief Dimension of the system of ODEs (Ordinary Differential Equations).
  * (V, m, h, n) -> 4 variables
  */
-#define SYS_DIM 4
+#define SYS_DIM HODGKIN_HUXLEY_SYS_DIM
 
 /** @brief Number of currents stored in the internal buffer.
  * (iNa, iK, iL, iSyn, iExt) -> 5 currents
  */
-#define NUM_CURRENTS 5
+#define NUM_CURRENTS HODGKIN_HUXLEY_NUM_CURRENTS
 
 /** @brief Shortcut for the resting potential from the configuration. */
 #define RP HH_CONFIG.restingPotential
@@ -147,10 +147,7 @@ HodgkinHuxleyModel* HodgkinHuxleyInitModel(const float dt) {
     model->neuron.params.gNa = HH_CONFIG.sodiumConductance;
 
     // 5. Set the initial state (resting potential)
-    *(model->neuron.state.v) = HH_CONFIG.restingPotential;
-    *(model->neuron.state.m) = GATE_REST_M;
-    *(model->neuron.state.h) = GATE_REST_H;
-    *(model->neuron.state.n) = GATE_REST_N;
+    HodgkinHuxleyResetState(model);
 
     // 6. Allocate and map the current buffer
     if (AllocCurrents(model) != true) {
@@ -182,6 +179,29 @@ bool HodgkinHuxleySetExternalCurent(HodgkinHuxleyModel *model, float iExt) {
     return true;
 }
 
+/**
+ * @brief Implementation of the parameter setter.
+ */
+bool HodgkinHuxleySetParameters(HodgkinHuxleyModel *model, const HodgkinHuxleyParams *params) {
+    if (!model || !params) return false;
+
+    model->neuron.params = *params;
+    return true;
+}
+
+/**
+ * @brief Implementation of the state reset.
+ */
+bool HodgkinHuxleyResetState(HodgkinHuxleyModel *model) {
+    if (!model) return false;
+
+    *(model->neuron.state.v) = HH_CONFIG.restingPotential;
+    *(model->neuron.state.m) = GATE_REST_M;
+    *(model->neuron.state.h) = GATE_REST_H;
+    *(model->neuron.state.n) = GATE_REST_N;
+    return true;
+}
+
 /**
  * @brief Implementation of the model update.
  */
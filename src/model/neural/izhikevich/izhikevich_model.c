@@ -15,9 +15,9 @@
 /** @brief Default time step (not used by init, but as a reference) */
 #define DT 0.01
 /** @brief Dimension of the system of ODEs (v, u) */
-#define SYS_DIM 2
+#define SYS_DIM IZHIKEVICH_SYS_DIM
 /** @brief Size of the internal buffer (a, b, c, d, Iext, Isyn) */
-#define NUM_CURRENTS_AND_PARAMS 6
+#define NUM_CURRENTS_AND_PARAMS IZHIKEVICH_INTERNAL_SIZE
 
 // Coefficients for the 'v' derivative: (0.04*v^2 + 5*v + 140)
 /** @brief Quadratic coefficient for the v-derivative */
@@ -93,6 +93,12 @@ static void IzhikevichDerivatives(const float *state, float *deriv, void *params
 // --- Public (API) Function Implementations ---
 
 IzhikevichModel* IzhikevichInitModel(const IzNeuronType type, const float dt) {
+    return IzhikevichInitModelFromConfig(&IZHIKEVICH_PARAMETERS[type], dt);
+}
+
+IzhikevichModel* IzhikevichInitModelFromConfig(const IzhikevichConfig *config, const float dt) {
+    if (!config) return NULL;
+
     // 1. Allocate main struct
     IzhikevichModel *model = (IzhikevichModel*)calloc(1, sizeof(IzhikevichModel));
     if (!model) return NULL;
@@ -117,20 +123,17 @@ IzhikevichModel* IzhikevichInitModel(const IzNeuronType type, const float dt) {
         return NULL;
     }
 
-    // 4. Set parameters and initial currents from the global config
-    *(model->neuron.params.a) = IZHIKEVICH_PARAMETERS[type].a;
-    *(model->neuron.params.b) = IZHIKEVICH_PARAMETERS[type].b;
-    *(model->neuron.params.c) = IZHIKEVICH_PARAMETERS[type].c;
-    *(model->neuron.params.d) = IZHIKEVICH_PARAMETERS[type].d;
+    // 4. Set parameters and initial currents from the given config
+    *(model->neuron.params.a) = config->a;
+    *(model->neuron.params.b) = config->b;
+    *(model->neuron.params.c) = config->c;
+    *(model->neuron.params.d) = config->d;
 
     *(model->neuron.currents.Iext) = 0.0f;
     *(model->neuron.currents.Isyn) = 0.0f;
 
     // 5. Set initial state (resting)
-    // Start 'v' near its reset potential 'c'
-    *(model->neuron.state.v) = (*(model->neuron.params.c) - 10.0);
-    // Initialize 'u' to be in equilibrium (u = b*v)
-    *(model->neuron.state.u) = (*(model->neuron.params.b)) * (*(model->neuron.state.v));
+    IzhikevichResetState(model);
 
     // 6. Initialize RK4 integrator
     if (!RK4Init(&model->integrator, IzhikevichDerivatives, &model->neuron, SYS_DIM, dt)) {
@@ -148,6 +151,16 @@ bool IzhikevichSetExternalCurrent(IzhikevichModel *model, float iExt) {
     return true;
 }
 
+bool IzhikevichResetState(IzhikevichModel *model) {
+    if (!model) return false;
+
+    // Start 'v' near its reset potential 'c'
+    *(model->neuron.state.v) = (*(model->neuron.params.c) - 10.0);
+    // Initialize 'u' to be in equilibrium (u = b*v)
+    *(model->neuron.state.u) = (*(model->neuron.params.b)) * (*(model->neuron.state.v));
+    return true;
+}
+
 float IzhikevichUpdateModel(IzhikevichModel *model) {
     if (!model) return 0.00f;
 
@@ -169,6 +182,20 @@ float IzhikevichUpdateModel(IzhikevichModel *model) {
     return *(model->neuron.state.v);
 }
 
+void IzhikevichDerivativesBatch(const float *restrict v, const float *restrict u,
+                                float *restrict dv, float *restrict du,
+                                int n, float a, float b, float current) {
+    // Single-precision constants keep the loop in float lanes
+    const float quad   = (float)QUAD_COEFF;
+    const float linear = (float)LINEAR_COEFF;
+    const float drive  = (float)CONST_TERM + current;
+
+    for (int i = 0; i < n; i++) {
+        dv[i] = (quad * v[i] * v[i]) + (linear * v[i]) + drive - u[i];
+        du[i] = a * (b * v[i] - u[i]);
+    }
+}
+
 float IzhikevichGetRecovery(IzhikevichModel *model) {
     if (!model) return 0.0f;
     return *(model->neuron.state.u);
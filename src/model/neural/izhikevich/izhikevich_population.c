@@ -0,0 +1,109 @@
+/**
+ * @file izhikevich_population.c
+ * @brief Implementation of the structure-of-arrays Izhikevich population.
+ */
+#include <stdlib.h>
+#include "model/neural/izhikevich/izhikevich_population.h"
+
+// --- Public (API) Function Implementations ---
+
+IzhikevichPopulation *IzhikevichPopulationInit(int count, const IzhikevichConfig *config) {
+    if (count <= 0 || !config) return NULL;
+
+    IzhikevichPopulation *pop = (IzhikevichPopulation*)calloc(1, sizeof(IzhikevichPopulation));
+    if (!pop) return NULL;
+
+    pop->buffer = (float*)calloc((size_t)count * IZHIKEVICH_POPULATION_ARRAYS, sizeof(float));
+    if (!pop->buffer) {
+        free(pop);
+        return NULL;
+    }
+
+    pop->count = count;
+    pop->v     = pop->buffer;
+    pop->u     = pop->v + count;
+    pop->iExt  = pop->u + count;
+    pop->iSyn  = pop->iExt + count;
+
+    ParameterColumnInit(&pop->a, config->a);
+    ParameterColumnInit(&pop->b, config->b);
+    ParameterColumnInit(&pop->c, config->c);
+    ParameterColumnInit(&pop->d, config->d);
+
+    for (int i = 0; i < count; i++) {
+        IzhikevichPopulationSetNeuron(pop, i, config);
+    }
+
+    return pop;
+}
+
+bool IzhikevichPopulationSetNeuron(IzhikevichPopulation *pop, int index, const IzhikevichConfig *config) {
+    if (!pop || !config || index < 0 || index >= pop->count) return false;
+
+    if (!ParameterColumnSet(&pop->a, pop->count, index, config->a)
+        || !ParameterColumnSet(&pop->b, pop->count, index, config->b)
+        || !ParameterColumnSet(&pop->c, pop->count, index, config->c)
+        || !ParameterColumnSet(&pop->d, pop->count, index, config->d)) {
+        return false;
+    }
+
+    pop->v[index] = config->c - 10.0f;
+    pop->u[index] = config->b * pop->v[index];
+    return true;
+}
+
+void IzhikevichPopulationCompact(IzhikevichPopulation *pop) {
+    if (!pop) return;
+    ParameterColumnCompact(&pop->a, pop->count);
+    ParameterColumnCompact(&pop->b, pop->count);
+    ParameterColumnCompact(&pop->c, pop->count);
+    ParameterColumnCompact(&pop->d, pop->count);
+}
+
+int IzhikevichPopulationStep(IzhikevichPopulation *pop, int begin, int end, float dt, int *spikes, double *inputSum) {
+    double synaptic = 0.0;
+    int fired = 0;
+
+    for (int block = begin; block < end; block += PARAMETER_BLOCK) {
+        const int n = end - block < PARAMETER_BLOCK ? end - block : PARAMETER_BLOCK;
+        const float *a = ParameterColumnBlock(&pop->a, block);
+        const float *b = ParameterColumnBlock(&pop->b, block);
+        const float *c = ParameterColumnBlock(&pop->c, block);
+        const float *d = ParameterColumnBlock(&pop->d, block);
+        float *v    = pop->v + block;
+        float *u    = pop->u + block;
+        float *iSyn = pop->iSyn + block;
+        const float *iExt = pop->iExt + block;
+
+        // 1. Branch-free Euler pass
+        for (int k = 0; k < n; k++) {
+            const float vk = v[k];
+            const float uk = u[k];
+            synaptic += iSyn[k];
+            v[k] = vk + dt * (0.04f * vk * vk + 5.0f * vk + 140.0f - uk + (iExt[k] + iSyn[k]));
+            u[k] = uk + dt * a[k] * (b[k] * vk - uk);
+            iSyn[k] = 0.0f;
+        }
+
+        // 2. Spikes and resets
+        for (int k = 0; k < n; k++) {
+            if (v[k] < IZHIKEVICH_SPIKE_PEAK) continue;
+            v[k] = c[k];
+            u[k] += d[k];
+            spikes[fired++] = block + k;
+        }
+    }
+
+    if (inputSum) *inputSum += synaptic;
+    return fired;
+}
+
+void IzhikevichPopulationFree(IzhikevichPopulation *pop) {
+    if (!pop) return;
+    ParameterColumnFree(&pop->a);
+    ParameterColumnFree(&pop->b);
+    ParameterColumnFree(&pop->c);
+    ParameterColumnFree(&pop->d);
+    free(pop->buffer);
+    free(pop);
+}
@@ -0,0 +1,40 @@
+/**
+ * @file lif_config.c
+ * @brief Defines the constant parameter values for the LIF model.
+ */
+#include "model/neural/lif/lif_config.h"
+
+/**
+ * @brief Global array of LIF parameter sets.
+ *
+ * Both presets share the membrane of Vogels & Abbott (2005): tau_m = 20 ms
+ * (200 pF, 10 nS), threshold -50 mV, reset -60 mV, 5 ms refractory period.
+ */
+const LifConfig LIF_PARAMETERS[] = {
+    [LIF_VOGELS_ABBOTT_COBA] = {
+        .capacitance        = 200.0f,
+        .leakConductance    = 10.0f,
+        .leakReversal       = -60.0f,
+        .threshold          = -50.0f,
+        .resetPotential     = -60.0f,
+        .refractoryPeriod   = 5.0f,
+        .tauExcitatory      = 5.0f,
+        .tauInhibitory      = 10.0f,
+        .excitatoryReversal = 0.0f,
+        .inhibitoryReversal = -80.0f,
+        .mode               = LIF_CONDUCTANCE_BASED
+    },
+    [LIF_VOGELS_ABBOTT_CUBA] = {
+        .capacitance        = 200.0f,
+        .leakConductance    = 10.0f,
+        .leakReversal       = -49.0f,
+        .threshold          = -50.0f,
+        .resetPotential     = -60.0f,
+        .refractoryPeriod   = 5.0f,
+        .tauExcitatory      = 5.0f,
+        .tauInhibitory      = 10.0f,
+        .excitatoryReversal = 0.0f,
+        .inhibitoryReversal = -80.0f,
+        .mode               = LIF_CURRENT_BASED
+    }
+};
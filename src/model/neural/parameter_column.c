@@ -0,0 +1,47 @@
+/**
+ * @file parameter_column.c
+ * @brief Implementation of the uniform-or-per-neuron parameter columns.
+ */
+#include <stdlib.h>
+#include "model/neural/parameter_column.h"
+
+// --- Public (API) Function Implementations ---
+
+void ParameterColumnInit(ParameterColumn *column, float value) {
+    column->values = NULL;
+    for (int k = 0; k < PARAMETER_BLOCK; k++) column->broadcast[k] = value;
+}
+
+bool ParameterColumnSet(ParameterColumn *column, int count, int index, float value) {
+    if (index < 0 || index >= count) return false;
+
+    if (!column->values) {
+        if (value == column->broadcast[0]) return true;
+
+        column->values = (float*)malloc(count * sizeof(float));
+        if (!column->values) return false;
+        for (int i = 0; i < count; i++) column->values[i] = column->broadcast[0];
+    }
+
+    column->values[index] = value;
+    return true;
+}
+
+bool ParameterColumnCompact(ParameterColumn *column, int count) {
+    if (!column->values) return true;
+
+    const float first = column->values[0];
+    for (int i = 1; i < count; i++) {
+        if (column->values[i] != first) return false;
+    }
+
+    free(column->values);
+    ParameterColumnInit(column, first);
+    return true;
+}
+
+void ParameterColumnFree(ParameterColumn *column) {
+    if (!column) return;
+    free(column->values);
+    column->values = NULL;
+}
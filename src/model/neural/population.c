@@ -0,0 +1,420 @@
+/**
+ * @file population.c
+ * @brief Model dispatch for the structure-of-arrays neuron populations.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "model/neural/population.h"
+#include "utils/memory.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_config.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Most per-neuron state arrays of any model (HH: 10 floats, the history flag and the Newton failures). */
+#define POPULATION_MAX_STATE_ARRAYS 12
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Lists the per-neuron dynamic state arrays of a population and
+ * the size of their elements.
+ * @return Number of arrays.
+ */
+static int PopulationStateArrays(const Population *pop, void **arrays, size_t *sizes);
+
+/**
+ * @brief Lists the separate per-neuron allocations of a population, in the
+ * order PopulationMoveEnd rebinds them.
+ */
+static void PopulationRegions(const Population *pop, PopulationMove *move);
+
+// --- Private (static) Function Implementations ---
+
+static int PopulationStateArrays(const Population *pop, void **arrays, size_t *sizes) {
+    int count = 0;
+    switch (pop->model) {
+        case POPULATION_IZHIKEVICH: {
+            const IzhikevichPopulation *p = pop->izhikevich;
+            arrays[count++] = p->v;
+            arrays[count++] = p->u;
+            arrays[count++] = p->iExt;
+            arrays[count++] = p->iSyn;
+            break;
+        }
+        case POPULATION_LIF: {
+            const LifPopulation *p = pop->lif;
+            arrays[count++] = p->v;
+            arrays[count++] = p->excitatory;
+            arrays[count++] = p->inhibitory;
+            arrays[count++] = p->iExt;
+            break;
+        }
+        case POPULATION_ADEX: {
+            const AdexPopulation *p = pop->adex;
+            arrays[count++] = p->v;
+            arrays[count++] = p->w;
+            arrays[count++] = p->excitatory;
+            arrays[count++] = p->inhibitory;
+            arrays[count++] = p->iExt;
+            break;
+        }
+        case POPULATION_HODGKIN_HUXLEY: {
+            const HodgkinHuxleyImplicitBatch *p = pop->hodgkinHuxley;
+            arrays[count++] = p->v;
+            arrays[count++] = p->m;
+            arrays[count++] = p->h;
+            arrays[count++] = p->n;
+            arrays[count++] = p->vPrev;
+            arrays[count++] = p->mPrev;
+            arrays[count++] = p->hPrev;
+            arrays[count++] = p->nPrev;
+            arrays[count++] = p->iExt;
+            arrays[count++] = p->iSyn;
+            break;
+        }
+    }
+    for (int a = 0; a < count; a++) sizes[a] = sizeof(float);
+
+    // Non-float columns
+    if (pop->model == POPULATION_LIF) {
+        arrays[count] = pop->lif->refractory;
+        sizes[count++] = sizeof(int);
+    } else if (pop->model == POPULATION_HODGKIN_HUXLEY) {
+        arrays[count] = pop->hodgkinHuxley->history;
+        sizes[count++] = sizeof(bool);
+        arrays[count] = pop->hodgkinHuxley->unconverged;
+        sizes[count++] = sizeof(int);
+    }
+    return count;
+}
+
+static void PopulationRegions(const Population *pop, PopulationMove *move) {
+    int k = 0;
+    switch (pop->model) {
+        case POPULATION_IZHIKEVICH: {
+            const IzhikevichPopulation *p = pop->izhikevich;
+            const ParameterColumn *columns[4] = { &p->a, &p->b, &p->c, &p->d };
+            move->from[k] = p->buffer; move->blocks[k] = IZHIKEVICH_POPULATION_ARRAYS; move->elementSize[k++] = sizeof(float);
+            for (int c = 0; c < 4; c++) {
+                if (!columns[c]->values) continue;
+                move->from[k] = columns[c]->values; move->blocks[k] = 1; move->elementSize[k++] = sizeof(float);
+            }
+            break;
+        }
+        case POPULATION_LIF:
+            move->from[k] = pop->lif->buffer;     move->blocks[k] = LIF_POPULATION_FLOAT_ARRAYS; move->elementSize[k++] = sizeof(float);
+            move->from[k] = pop->lif->refractory; move->blocks[k] = 1; move->elementSize[k++] = sizeof(int);
+            break;
+        case POPULATION_ADEX:
+            move->from[k] = pop->adex->buffer;    move->blocks[k] = ADEX_POPULATION_FLOAT_ARRAYS; move->elementSize[k++] = sizeof(float);
+            break;
+        case POPULATION_HODGKIN_HUXLEY:
+            move->from[k] = pop->hodgkinHuxley->buffer;  move->blocks[k] = HH_IMPLICIT_BATCH_ARRAYS; move->elementSize[k++] = sizeof(float);
+            move->from[k] = pop->hodgkinHuxley->history; move->blocks[k] = 1; move->elementSize[k++] = sizeof(bool);
+            move->from[k] = pop->hodgkinHuxley->unconverged; move->blocks[k] = 1; move->elementSize[k++] = sizeof(int);
+            break;
+    }
+    move->regionCount = k;
+    move->count = pop->count;
+}
+
+// --- Public (API) Function Implementations ---
+
+void PopulationConfigDefaults(PopulationConfig *config, PopulationModel model) {
+    memset(config, 0, sizeof(*config));
+    config->model      = model;
+    config->izhikevich = IZHIKEVICH_PARAMETERS[REGULAR_SPIKING];
+    config->lif        = LIF_PARAMETERS[LIF_VOGELS_ABBOTT_COBA];
+    config->adex       = ADEX_PARAMETERS[ADEX_BRETTE_GERSTNER];
+    config->hodgkinHuxley = (HodgkinHuxleyParams){
+        .C   = HH_CONFIG.membraneCapacitancy,
+        .gL  = HH_CONFIG.leakConductance,
+        .eL  = HH_CONFIG.leakReversal,
+        .eK  = HH_CONFIG.potassiumReversal,
+        .gK  = HH_CONFIG.potassiumConductance,
+        .eNa = HH_CONFIG.sodiumReversal,
+        .gNa = HH_CONFIG.sodiumConductance
+    };
+}
+
+Population *PopulationCreate(const PopulationConfig *config, int count, float dt) {
+    if (!config || count <= 0 || dt <= 0.0f) return NULL;
+
+    Population *pop = (Population*)calloc(1, sizeof(Population));
+    if (!pop) return NULL;
+
+    pop->model = config->model;
+    pop->count = count;
+    pop->dt    = dt;
+
+    bool ok = false;
+    switch (config->model) {
+        case POPULATION_IZHIKEVICH:
+            pop->izhikevich = IzhikevichPopulationInit(count, &config->izhikevich);
+            ok = (pop->izhikevich != NULL);
+            break;
+        case POPULATION_LIF:
+            pop->lif = LifPopulationInit(count, &config->lif, dt);
+            ok = (pop->lif != NULL);
+            break;
+        case POPULATION_ADEX:
+            pop->adex = AdexPopulationInit(count, &config->adex, dt);
+            ok = (pop->adex != NULL);
+            break;
+        case POPULATION_HODGKIN_HUXLEY:
+            pop->hodgkinHuxley = HodgkinHuxleyImplicitInit(count, &config->hodgkinHuxley, dt, HH_IMPLICIT_BDF2);
+            ok = (pop->hodgkinHuxley != NULL);
+            break;
+    }
+
+    if (!ok) {
+        PopulationFree(pop);
+        return NULL;
+    }
+    return pop;
+}
+
+int PopulationStep(Population *pop, int begin, int end, int *spikes, double *inputSum) {
+    switch (pop->model) {
+        case POPULATION_IZHIKEVICH: return IzhikevichPopulationStep(pop->izhikevich, begin, end, pop->dt, spikes, inputSum);
+        case POPULATION_LIF:        return LifPopulationStep(pop->lif, begin, end, spikes, inputSum);
+        case POPULATION_ADEX:       return AdexPopulationStep(pop->adex, begin, end, spikes, inputSum);
+        case POPULATION_HODGKIN_HUXLEY:
+            return HodgkinHuxleyImplicitStepRange(pop->hodgkinHuxley, begin, end, spikes, inputSum);
+    }
+    return 0;
+}
+
+void PopulationDeliver(Population *pop, const int *targets, const float *weights, int count) {
+    switch (pop->model) {
+        case POPULATION_IZHIKEVICH: {
+            // A pulse lasting one step, scaled to carry weight * 1 ms of charge
+            float *iSyn = pop->izhikevich->iSyn;
+            const float scale = 1.0f / pop->dt;
+            for (int k = 0; k < count; k++) iSyn[targets[k]] += weights[k] * scale;
+            break;
+        }
+        case POPULATION_LIF:
+            for (int k = 0; k < count; k++) LifPopulationAddInput(pop->lif, targets[k], weights[k]);
+            break;
+        case POPULATION_ADEX:
+            for (int k = 0; k < count; k++) AdexPopulationAddInput(pop->adex, targets[k], weights[k]);
+            break;
+        case POPULATION_HODGKIN_HUXLEY: {
+            float *iSyn = pop->hodgkinHuxley->iSyn;
+            const float scale = 1.0f / pop->dt;
+            for (int k = 0; k < count; k++) iSyn[targets[k]] += weights[k] * scale;
+            break;
+        }
+    }
+}
+
+size_t PopulationStateBytes(const Population *pop) {
+    void *arrays[POPULATION_MAX_STATE_ARRAYS];
+    size_t sizes[POPULATION_MAX_STATE_ARRAYS];
+    const int count = PopulationStateArrays(pop, arrays, sizes);
+
+    size_t bytes = 0;
+    for (int a = 0; a < count; a++) bytes += sizes[a];
+    return bytes;
+}
+
+void PopulationSaveState(const Population *pop, int begin, int end, void *out) {
+    void *arrays[POPULATION_MAX_STATE_ARRAYS];
+    size_t sizes[POPULATION_MAX_STATE_ARRAYS];
+    const int count = PopulationStateArrays(pop, arrays, sizes);
+
+    unsigned char *cursor = (unsigned char*)out;
+    for (int a = 0; a < count; a++) {
+        const size_t bytes = (size_t)(end - begin) * sizes[a];
+        memcpy(cursor, (const unsigned char*)arrays[a] + (size_t)begin * sizes[a], bytes);
+        cursor += bytes;
+    }
+}
+
+void PopulationLoadState(Population *pop, int begin, int end, const void *in) {
+    void *arrays[POPULATION_MAX_STATE_ARRAYS];
+    size_t sizes[POPULATION_MAX_STATE_ARRAYS];
+    const int count = PopulationStateArrays(pop, arrays, sizes);
+
+    const unsigned char *cursor = (const unsigned char*)in;
+    for (int a = 0; a < count; a++) {
+        const size_t bytes = (size_t)(end - begin) * sizes[a];
+        memcpy((unsigned char*)arrays[a] + (size_t)begin * sizes[a], cursor, bytes);
+        cursor += bytes;
+    }
+}
+
+bool PopulationMoveBegin(const Population *pop, PopulationMove *move, bool hugePages) {
+    memset(move, 0, sizeof(*move));
+    PopulationRegions(pop, move);
+
+    for (int r = 0; r < move->regionCount; r++) {
+        move->to[r] = MemoryAllocate((size_t)move->count * move->blocks[r] * move->elementSize[r], hugePages);
+        if (!move->to[r]) {
+            PopulationMoveCancel(move);
+            return false;
+        }
+    }
+    return true;
+}
+
+void PopulationMoveCancel(PopulationMove *move) {
+    for (int r = 0; r < move->regionCount; r++) {
+        free(move->to[r]);
+        move->to[r] = NULL;
+    }
+}
+
+void PopulationMoveRange(const PopulationMove *move, int begin, int end) {
+    for (int r = 0; r < move->regionCount; r++) {
+        const size_t size = move->elementSize[r];
+        for (int b = 0; b < move->blocks[r]; b++) {
+            const size_t offset = ((size_t)b * move->count + begin) * size;
+            memcpy((unsigned char*)move->to[r] + offset, (const unsigned char*)move->from[r] + offset,
+                   (size_t)(end - begin) * size);
+        }
+    }
+}
+
+/** @brief Points 'field' at the same element of 'to' as it pointed at in 'from'. */
+#define POPULATION_REBIND(field, from, to) \
+    ((field) = (void*)((unsigned char*)(to) + ((unsigned char*)(field) - (unsigned char*)(from))))
+
+void PopulationMoveEnd(Population *pop, const PopulationMove *move) {
+    void *const *from = move->from;
+    void *const *to   = move->to;
+
+    switch (pop->model) {
+        case POPULATION_IZHIKEVICH: {
+            IzhikevichPopulation *p = pop->izhikevich;
+            POPULATION_REBIND(p->v, from[0], to[0]);
+            POPULATION_REBIND(p->u, from[0], to[0]);
+            POPULATION_REBIND(p->iExt, from[0], to[0]);
+            POPULATION_REBIND(p->iSyn, from[0], to[0]);
+            p->buffer = (float*)to[0];
+
+            ParameterColumn *columns[4] = { &p->a, &p->b, &p->c, &p->d };
+            for (int c = 0, k = 1; c < 4; c++) {
+                if (columns[c]->values) columns[c]->values = (float*)to[k++];
+            }
+            break;
+        }
+        case POPULATION_LIF: {
+            LifPopulation *p = pop->lif;
+            POPULATION_REBIND(p->v, from[0], to[0]);
+            POPULATION_REBIND(p->excitatory, from[0], to[0]);
+            POPULATION_REBIND(p->inhibitory, from[0], to[0]);
+            POPULATION_REBIND(p->iExt, from[0], to[0]);
+            p->buffer     = (float*)to[0];
+            p->refractory = (int*)to[1];
+            break;
+        }
+        case POPULATION_ADEX: {
+            AdexPopulation *p = pop->adex;
+            POPULATION_REBIND(p->v, from[0], to[0]);
+            POPULATION_REBIND(p->w, from[0], to[0]);
+            POPULATION_REBIND(p->excitatory, from[0], to[0]);
+            POPULATION_REBIND(p->inhibitory, from[0], to[0]);
+            POPULATION_REBIND(p->iExt, from[0], to[0]);
+            p->buffer = (float*)to[0];
+            break;
+        }
+        case POPULATION_HODGKIN_HUXLEY: {
+            HodgkinHuxleyImplicitBatch *p = pop->hodgkinHuxley;
+            POPULATION_REBIND(p->v, from[0], to[0]);
+            POPULATION_REBIND(p->m, from[0], to[0]);
+            POPULATION_REBIND(p->h, from[0], to[0]);
+            POPULATION_REBIND(p->n, from[0], to[0]);
+            POPULATION_REBIND(p->vPrev, from[0], to[0]);
+            POPULATION_REBIND(p->mPrev, from[0], to[0]);
+            POPULATION_REBIND(p->hPrev, from[0], to[0]);
+            POPULATION_REBIND(p->nPrev, from[0], to[0]);
+            POPULATION_REBIND(p->iExt, from[0], to[0]);
+            POPULATION_REBIND(p->iSyn, from[0], to[0]);
+            POPULATION_REBIND(p->scratch, from[0], to[0]);
+            p->buffer  = (float*)to[0];
+            p->history = (bool*)to[1];
+            p->unconverged = (int*)to[2];
+            break;
+        }
+    }
+
+    for (int r = 0; r < move->regionCount; r++) free(move->from[r]);
+}
+
+size_t PopulationPermuteBytes(const Population *pop) {
+    PopulationMove move;
+    memset(&move, 0, sizeof(move));
+    PopulationRegions(pop, &move);
+
+    size_t largest = 0;
+    for (int r = 0; r < move.regionCount; r++) {
+        const size_t bytes = (size_t)move.count * move.blocks[r] * move.elementSize[r];
+        if (bytes > largest) largest = bytes;
+    }
+    return largest;
+}
+
+void PopulationPermute(Population *pop, const int *destination, void *scratch) {
+    PopulationMove move;
+    memset(&move, 0, sizeof(move));
+    PopulationRegions(pop, &move);
+
+    unsigned char *copy = (unsigned char*)scratch;
+    for (int r = 0; r < move.regionCount; r++) {
+        const size_t size = move.elementSize[r];
+        unsigned char *region = (unsigned char*)move.from[r];
+        memcpy(copy, region, (size_t)move.count * move.blocks[r] * size);
+
+        for (int b = 0; b < move.blocks[r]; b++) {
+            const size_t block = (size_t)b * move.count;
+            for (int i = 0; i < move.count; i++) {
+                memcpy(region + (block + destination[i]) * size, copy + (block + i) * size, size);
+            }
+        }
+    }
+}
+
+float *PopulationPotential(const Population *pop) {
+    switch (pop->model) {
+        case POPULATION_IZHIKEVICH: return pop->izhikevich->v;
+        case POPULATION_LIF:        return pop->lif->v;
+        case POPULATION_ADEX:       return pop->adex->v;
+        case POPULATION_HODGKIN_HUXLEY: return pop->hodgkinHuxley->v;
+    }
+    return NULL;
+}
+
+float *PopulationExternalCurrent(const Population *pop) {
+    switch (pop->model) {
+        case POPULATION_IZHIKEVICH: return pop->izhikevich->iExt;
+        case POPULATION_LIF:        return pop->lif->iExt;
+        case POPULATION_ADEX:       return pop->adex->iExt;
+        case POPULATION_HODGKIN_HUXLEY: return pop->hodgkinHuxley->iExt;
+    }
+    return NULL;
+}
+
+long PopulationUnconvergedSteps(const Population *pop) {
+    return pop->model == POPULATION_HODGKIN_HUXLEY ? HodgkinHuxleyImplicitUnconvergedSteps(pop->hodgkinHuxley) : 0;
+}
+
+float PopulationSpikeLevel(const Population *pop) {
+    switch (pop->model) {
+        case POPULATION_IZHIKEVICH: return IZHIKEVICH_SPIKE_PEAK;
+        case POPULATION_LIF:        return pop->lif->config.threshold;
+        case POPULATION_ADEX:       return pop->adex->config.cutoff;
+        case POPULATION_HODGKIN_HUXLEY: return HH_SPIKE_THRESHOLD;
+    }
+    return 0.0f;
+}
+
+void PopulationFree(Population *pop) {
+    if (!pop) return;
+    IzhikevichPopulationFree(pop->izhikevich);
+    LifPopulationFree(pop->lif);
+    AdexPopulationFree(pop->adex);
+    HodgkinHuxleyImplicitFree(pop->hodgkinHuxley);
+    free(pop);
+}
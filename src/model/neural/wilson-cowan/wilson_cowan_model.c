@@ -0,0 +1,94 @@
+/**
+ * @file wilson_cowan_model.c
+ * @brief Implementation of the Wilson-Cowan rate model.
+ */
+#include <math.h>
+#include <string.h>
+#include "model/neural/wilson-cowan/wilson_cowan_model.h"
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief The derivatives function (dy/dt) for the RK4 integrator.
+ *
+ * @param state The activities a_k.
+ * @param deriv Output da_k/dt.
+ * @param params A (void*) pointer to the RateModelConfig.
+ */
+static void RateModelDerivatives(const float *state, float *deriv, void *params);
+
+// --- Private (static) Function Implementations ---
+
+static void RateModelDerivatives(const float *state, float *deriv, void *params) {
+    const RateModelConfig *cfg = (const RateModelConfig*)params;
+
+    for (int k = 0; k < cfg->count; k++) {
+        float x = cfg->input[k];
+        for (int j = 0; j < cfg->count; j++) x += cfg->weight[k][j] * state[j];
+
+        const float s = cfg->shiftedSigmoid ? WilsonCowanSigmoid(x, cfg->gain[k], cfg->threshold[k])
+                                            : 1.0f / (1.0f + expf(-cfg->gain[k] * (x - cfg->threshold[k])));
+        deriv[k] = (-state[k] + (1.0f - cfg->refractory[k] * state[k]) * s) / cfg->tau[k];
+    }
+}
+
+// --- Public (API) Function Implementations ---
+
+void WilsonCowanConfigDefaults(RateModelConfig *config) {
+    memset(config, 0, sizeof(*config));
+    config->count          = 2;
+    config->shiftedSigmoid = true;
+
+    // Excitatory population
+    config->tau[0]        = 10.0f;
+    config->refractory[0] = 1.0f;
+    config->gain[0]       = 1.3f;
+    config->threshold[0]  = 4.0f;
+    config->maxRate[0]    = 100.0f;
+    config->input[0]      = 1.25f;
+
+    // Inhibitory population
+    config->tau[1]        = 10.0f;
+    config->refractory[1] = 1.0f;
+    config->gain[1]       = 2.0f;
+    config->threshold[1]  = 3.7f;
+    config->maxRate[1]    = 100.0f;
+    config->input[1]      = 0.0f;
+
+    // c1..c4 of the original paper
+    config->weight[0][0] =  16.0f;
+    config->weight[0][1] = -12.0f;
+    config->weight[1][0] =  15.0f;
+    config->weight[1][1] =  -3.0f;
+}
+
+float WilsonCowanSigmoid(float x, float gain, float threshold) {
+    return 1.0f / (1.0f + expf(-gain * (x - threshold))) - 1.0f / (1.0f + expf(gain * threshold));
+}
+
+bool RateModelInit(RateModel *model, const RateModelConfig *config, float dt) {
+    memset(model, 0, sizeof(*model));
+    if (!config || config->count < 1 || config->count > RATE_MAX_POPULATIONS || dt <= 0.0f) return false;
+
+    for (int k = 0; k < config->count; k++) {
+        if (config->tau[k] <= 0.0f) return false;
+    }
+
+    model->config = *config;
+    model->dt     = dt;
+    return RK4Init(&model->integrator, RateModelDerivatives, &model->config, config->count, dt);
+}
+
+void RateModelStep(RateModel *model) {
+    RK4Calculate(&model->integrator, model->activity);
+    model->time += model->dt;
+}
+
+float RateModelRate(const RateModel *model, int population) {
+    if (population < 0 || population >= model->config.count) return 0.0f;
+    return model->activity[population] * model->config.maxRate[population];
+}
+
+void RateModelFree(RateModel *model) {
+    RK4Free(&model->integrator);
+}
@@ -0,0 +1,89 @@
+/**
+ * @file benchmark.c
+ * @brief Implementation of the benchmark timing and report helpers.
+ */
+#ifdef __linux__
+#define _GNU_SOURCE
+#else
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "simulation/benchmark.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+// --- Internal Module Constants ---
+
+const char *const BENCHMARK_PLACEMENT_NAMES[] = { "none", "pinned", "huge" };
+
+// --- Public (API) Function Implementations ---
+
+double BenchmarkNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int BenchmarkCounterOpen(void) {
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof(attr);
+    attr.config         = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled       = 1;
+    attr.inherit        = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+void BenchmarkCounterEnable(int counter, bool enable) {
+#ifdef __linux__
+    if (counter >= 0) ioctl(counter, enable ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE, 0);
+#else
+    (void)counter;
+    (void)enable;
+#endif
+}
+
+long long BenchmarkCounterClose(int counter) {
+    if (counter < 0) return -1;
+
+    long long count = -1;
+    if (read(counter, &count, sizeof(count)) != (ssize_t)sizeof(count)) count = -1;
+    close(counter);
+    return count;
+}
+
+void BenchmarkPrintHeader(FILE *out) {
+    fprintf(out, "%-18s %5s %7s %6s %5s %9s %11s %9s %9s %12s %12s %12s %8s %8s\n", "workload", "procs", "threads", "place", "order",
+            "neurons", "synapses", "build(s)", "wall(s)", "wall/sim-s", "spikes/s", "events/s", "spread", "miss/ev");
+}
+
+void BenchmarkPrintResult(FILE *out, const BenchmarkResult *result) {
+    const double simSeconds = result->simulated / 1000.0;
+    const double wall = result->wallTime > 0.0 ? result->wallTime : 1e-9;
+
+    char spread[16] = "n/a", misses[16] = "n/a";
+    if (result->rowSpread >= 0.0) snprintf(spread, sizeof(spread), "%.1f", result->rowSpread);
+    if (result->cacheMisses >= 0 && result->events > 0) {
+        snprintf(misses, sizeof(misses), "%.3f", (double)result->cacheMisses / result->events);
+    }
+
+    fprintf(out, "%-18s %5d %7d %6s %5s %9d %11ld %9.2f %9.2f %12.3f %12.4g %12.4g %8s %8s\n", result->name,
+            result->processes > 0 ? result->processes : 1, result->threads,
+            BENCHMARK_PLACEMENT_NAMES[result->placement], NETWORK_REORDER_NAMES[result->reorder],
+            result->neurons, result->synapses, result->buildTime, result->wallTime, result->wallTime / simSeconds,
+            result->spikes / wall, result->events / wall, spread, misses);
+}
@@ -0,0 +1,192 @@
+/**
+ * @file benchmark_brette4.c
+ * @brief Implementation of the event-driven benchmark 4 workload.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "utils/random.h"
+#include "model/neural/lif/lif_config.h"
+#include "simulation/event_network.h"
+#include "simulation/benchmark_brette4.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Share of excitatory neurons. */
+#define EXCITATORY_FRACTION 0.8
+
+/** @brief Potential jumps of the synapses (mV). */
+#define EXCITATORY_JUMP  0.25f
+#define INHIBITORY_JUMP -2.25f
+
+/** @brief Share of the run, at its end, over which the activity must be sustained. */
+#define FINAL_FRACTION 0.1
+
+/** @brief Validation window of the mean firing rate (Hz). */
+#define RATE_MIN 2.0
+#define RATE_MAX 50.0
+
+/**
+ * @struct Brette4Counts
+ * @brief Spike statistics gathered by the spike callback.
+ */
+typedef struct {
+    int excitatory;             ///< Neurons below this index are excitatory
+    const int *synapseStart;    ///< Row offsets, to count synaptic events
+    double finalStart;          ///< Start of the final window (ms)
+    long spikes[2];             ///< Excitatory, inhibitory
+    long finalSpikes;
+    long events;
+} Brette4Counts;
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Draws the Bernoulli connectivity (no autapses) and connects the network.
+ * @return false on allocation failure.
+ */
+static bool Brette4Connect(EventNetwork *network, const Brette4Config *config, int excitatory, Rng *rng);
+
+/**
+ * @brief EventSpikeCallback: accumulates a Brette4Counts.
+ */
+static void Brette4OnSpike(int neuron, double time, void *userData);
+
+// --- Private (static) Function Implementations ---
+
+static bool Brette4Connect(EventNetwork *network, const Brette4Config *config, int excitatory, Rng *rng) {
+    const int n = config->neurons;
+    const double p = config->synapsesPerNeuron < n - 1 ? (double)config->synapsesPerNeuron / (n - 1) : 1.0;
+
+    long count = 0;
+    long capacity = (long)(n * p * n * 1.05) + 16;
+    int *sources   = (int*)malloc(capacity * sizeof(int));
+    int *targets   = (int*)malloc(capacity * sizeof(int));
+    float *weights = (float*)malloc(capacity * sizeof(float));
+    bool ok = sources && targets && weights;
+
+    // Geometric skips over the targets, as in VogelsAbbottBuild
+    const double logSkip = p < 1.0 ? log(1.0 - p) : 0.0;
+    for (int source = 0; ok && source < n; source++) {
+        const float weight = source < excitatory ? EXCITATORY_JUMP : INHIBITORY_JUMP;
+        for (long target = -1; ok; ) {
+            target += p < 1.0 ? 1 + (long)floor(log(1.0 - RngUniform(rng)) / logSkip) : 1;
+            if (target >= n) break;
+            if (target == source) continue;
+
+            if (count == capacity) {
+                capacity *= 2;
+                int *s   = (int*)realloc(sources, capacity * sizeof(int));
+                if (s) sources = s;
+                int *t   = (int*)realloc(targets, capacity * sizeof(int));
+                if (t) targets = t;
+                float *w = (float*)realloc(weights, capacity * sizeof(float));
+                if (w) weights = w;
+                ok = s && t && w;
+                if (!ok) break;
+            }
+            sources[count] = source;
+            targets[count] = (int)target;
+            weights[count] = weight;
+            count++;
+        }
+    }
+    if (ok && count > 0x7fffffffL) {
+        fprintf(stderr, "Error: network has too many synapses (%ld)\n", count);
+        ok = false;
+    }
+
+    ok = ok && EventNetworkConnect(network, sources, targets, weights, (int)count);
+    free(sources);
+    free(targets);
+    free(weights);
+    return ok;
+}
+
+static void Brette4OnSpike(int neuron, double time, void *userData) {
+    Brette4Counts *counts = (Brette4Counts*)userData;
+
+    counts->spikes[neuron < counts->excitatory ? 0 : 1]++;
+    counts->events += counts->synapseStart[neuron + 1] - counts->synapseStart[neuron];
+    if (time >= counts->finalStart) counts->finalSpikes++;
+}
+
+// --- Public (API) Function Implementations ---
+
+void Brette4Defaults(Brette4Config *config) {
+    config->neurons           = 4000;
+    config->synapsesPerNeuron = 80;
+    config->delay             = 0.1f;
+    config->duration          = 1000.0f;
+    config->seed              = 2007;
+}
+
+bool Brette4Run(const Brette4Config *config, Brette4Result *result) {
+    if (!config || !result || config->neurons < 2 || config->synapsesPerNeuron < 1 || config->duration <= 0.0f) return false;
+
+    const int n  = config->neurons;
+    const int ne = (int)lround(n * EXCITATORY_FRACTION);
+    const LifConfig *membrane = &LIF_PARAMETERS[LIF_VOGELS_ABBOTT_CUBA];
+
+    const double buildStart = BenchmarkNow();
+    EventNetwork *network = EventNetworkCreate(n, membrane, config->delay);
+    if (!network) return false;
+
+    Rng rng;
+    RngSeed(&rng, config->seed);
+    bool ok = Brette4Connect(network, config, ne, &rng);
+
+    // Uniform between reset and threshold, as in the clock-driven CUBA network
+    for (int i = 0; ok && i < n; i++) {
+        const float v = membrane->resetPotential + RngUniform(&rng) * (membrane->threshold - membrane->resetPotential);
+        ok = EventNetworkSetPotential(network, i, v);
+    }
+    if (!ok) {
+        EventNetworkFree(network);
+        return false;
+    }
+    const double buildTime = BenchmarkNow() - buildStart;
+
+    Brette4Counts counts = {
+        .excitatory   = ne,
+        .synapseStart = network->synapseStart,
+        .finalStart   = config->duration * (1.0 - FINAL_FRACTION)
+    };
+    EventNetworkSetSpikeCallback(network, Brette4OnSpike, &counts);
+
+    const double start = BenchmarkNow();
+    ok = EventNetworkRun(network, config->duration) >= 0;
+    const double wall = BenchmarkNow() - start;
+
+    if (ok) {
+        result->benchmark = (BenchmarkResult){
+            .name        = "brette4",
+            .processes   = 1,
+            .threads     = 1,
+            .placement   = BENCHMARK_PLACE_NONE,
+            .reorder     = NETWORK_REORDER_NONE,
+            .neurons     = n,
+            .synapses    = network->synapseCount,
+            .simulated   = config->duration,
+            .buildTime   = buildTime,
+            .wallTime    = wall,
+            .spikes      = counts.spikes[0] + counts.spikes[1],
+            .events      = counts.events,
+            .rowSpread   = -1.0,
+            .cacheMisses = -1
+        };
+
+        const double seconds = config->duration / 1000.0;
+        result->excitatoryRate = counts.spikes[0] / (ne * seconds);
+        result->inhibitoryRate = n > ne ? counts.spikes[1] / ((n - ne) * seconds) : 0.0;
+        result->finalRate      = counts.finalSpikes / (n * seconds * FINAL_FRACTION);
+        result->queueEvents    = network->eventCount;
+        result->deferredEvents = network->deferredCount;
+
+        const double rate = (counts.spikes[0] + counts.spikes[1]) / (n * seconds);
+        result->rateValid = result->finalRate > 0.0 && rate >= RATE_MIN && rate <= RATE_MAX;
+    }
+
+    EventNetworkFree(network);
+    return ok;
+}
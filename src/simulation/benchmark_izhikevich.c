@@ -0,0 +1,347 @@
+/**
+ * @file benchmark_izhikevich.c
+ * @brief Implementation of the Izhikevich (2003) network workload.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "utils/random.h"
+#include "analysis/spectrum.h"
+#include "simulation/network_distributed.h"
+#include "simulation/benchmark_izhikevich.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Share of excitatory neurons (and of excitatory synapses per neuron). */
+#define EXCITATORY_FRACTION 0.8
+
+/** @brief Segment length of the population-activity spectrum (1 ms samples). */
+#define SPECTRUM_SEGMENT 512
+
+/** @brief Frequency bands of the rhythm validation (Hz). */
+#define BAND_LOW      2.0f
+#define BAND_HIGH     100.0f
+#define ALPHA_LOW     8.0f
+#define ALPHA_HIGH    13.0f
+#define GAMMA_LOW     30.0f
+#define GAMMA_HIGH    50.0f
+
+/**
+ * @brief Minimum share of the 2-100 Hz power in the band of the spectral
+ * peak, relative to the share of a flat spectrum (about 0.05 for alpha and
+ * 0.2 for gamma).
+ */
+#define RHYTHM_MIN_SHARE_RATIO 1.5f
+
+/**
+ * @struct NoiseJob
+ * @brief Shared state of the parallel thalamic-input pass.
+ */
+typedef struct {
+    Network *network;
+    float *sigma;          ///< Per-step noise std of each group
+    uint64_t seed;
+    long step;
+} NoiseJob;
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Splits an in-degree into its excitatory and inhibitory parts.
+ */
+static void Izhikevich2003InDegree(const Izhikevich2003Config *config, int *excitatory, int *inhibitory);
+
+/**
+ * @brief NetworkRunChunks body: draws the thalamic input of one network chunk.
+ */
+static void Izhikevich2003Noise(int index, void *userData);
+
+// --- Private (static) Function Implementations ---
+
+static void Izhikevich2003InDegree(const Izhikevich2003Config *config, int *excitatory, int *inhibitory) {
+    const int ne = (int)lround(config->neurons * EXCITATORY_FRACTION);
+    const int ni = config->neurons - ne;
+    const int k  = config->synapsesPerNeuron < config->neurons ? config->synapsesPerNeuron : config->neurons;
+
+    *excitatory = (int)lround(k * EXCITATORY_FRACTION);
+    *inhibitory = k - *excitatory;
+    if (*excitatory > ne) *excitatory = ne;
+    if (*inhibitory > ni) *inhibitory = ni;
+}
+
+static void Izhikevich2003Noise(int index, void *userData) {
+    NoiseJob *job = (NoiseJob*)userData;
+    const NetworkChunk *chunk = &job->network->chunks[index];
+    const int base = job->network->groupStart[chunk->group];
+    float *iExt = PopulationExternalCurrent(job->network->groups[chunk->group]);
+    const float sigma = job->sigma[chunk->group];
+
+    // One stream per (step, chunk): the draws do not depend on which thread runs the chunk
+    Rng rng;
+    RngSeed(&rng, job->seed + (uint64_t)job->step * job->network->chunkCount + index + 1);
+    for (int i = chunk->begin - base; i < chunk->end - base; i++) iExt[i] = sigma * RngNormal(&rng);
+}
+
+// --- Public (API) Function Implementations ---
+
+void Izhikevich2003Defaults(Izhikevich2003Config *config) {
+    config->neurons           = 1000;
+    config->synapsesPerNeuron = IZHIKEVICH_2003_SYNAPSES;
+    config->dt                = 0.5f;
+    config->duration          = IZHIKEVICH_2003_MIN_DURATION;
+    config->excitatoryNoise   = 5.0f;
+    config->inhibitoryNoise   = 2.0f;
+    config->seed              = 2003;
+    config->processes         = 1;
+    config->placement         = BENCHMARK_PLACE_NONE;
+    config->reorder           = NETWORK_REORDER_NONE;
+}
+
+Network *Izhikevich2003Build(const Izhikevich2003Config *config, int threads) {
+    if (!config || config->neurons < 2 || config->synapsesPerNeuron < 1 || config->dt <= 0.0f) return NULL;
+
+    const int n  = config->neurons;
+    const int ne = (int)lround(n * EXCITATORY_FRACTION);
+    int ke, ki;
+    Izhikevich2003InDegree(config, &ke, &ki);
+
+    const long synapses = (long)n * (ke + ki);
+    if (synapses > 0x7fffffffL) {
+        fprintf(stderr, "Error: network has too many synapses (%ld)\n", synapses);
+        return NULL;
+    }
+
+    // Two groups: excitatory (index 0) and inhibitory (index 1)
+    PopulationConfig configs[2];
+    PopulationConfigDefaults(&configs[0], POPULATION_IZHIKEVICH);
+    PopulationConfigDefaults(&configs[1], POPULATION_IZHIKEVICH);
+    configs[1].izhikevich = IZHIKEVICH_PARAMETERS[FAST_SPIKING];
+
+    int *configIndex = (int*)malloc(n * sizeof(int));
+    if (!configIndex) return NULL;
+    for (int i = 0; i < n; i++) configIndex[i] = i < ne ? 0 : 1;
+
+    Network *network = NetworkCreateMixed(n, configs, 2, configIndex, config->dt, threads);
+    free(configIndex);
+
+    int *sources   = (int*)malloc((synapses > 0 ? synapses : 1) * sizeof(int));
+    int *targets   = (int*)malloc((synapses > 0 ? synapses : 1) * sizeof(int));
+    float *weights = (float*)malloc((synapses > 0 ? synapses : 1) * sizeof(float));
+    int *pool      = (int*)malloc(n * sizeof(int));
+    if (!network || !sources || !targets || !weights || !pool) {
+        NetworkFree(network);
+        free(sources);
+        free(targets);
+        free(weights);
+        free(pool);
+        return NULL;
+    }
+
+    Rng rng;
+    RngSeed(&rng, config->seed);
+
+    // 1. Randomly mixed parameters; everyone starts at v = -65, u = b * v
+    for (int i = 0; i < n; i++) {
+        const float r = RngUniform(&rng);
+        const IzhikevichConfig params = i < ne
+            ? (IzhikevichConfig){ 0.02f, 0.2f, -65.0f + 15.0f * r * r, 8.0f - 6.0f * r * r, REGULAR_SPIKING }
+            : (IzhikevichConfig){ 0.02f + 0.08f * r, 0.25f - 0.05f * r, -65.0f, 2.0f, FAST_SPIKING };
+
+        int local;
+        IzhikevichPopulation *pop = NetworkNeuronPopulation(network, i, &local)->izhikevich;
+        IzhikevichPopulationSetNeuron(pop, local, &params);
+        pop->v[local] = -65.0f;
+        pop->u[local] = params.b * -65.0f;
+    }
+    for (int g = 0; g < network->groupCount; g++) IzhikevichPopulationCompact(network->groups[g]->izhikevich);
+
+    // 2. Fixed in-degree, weights scaled to keep the original mean input
+    const float scale = (float)IZHIKEVICH_2003_SYNAPSES / (ke + ki);
+    long next = 0;
+    for (int i = 0; i < n; i++) pool[i] = i;
+    for (int target = 0; target < n; target++) {
+        for (int k = 0; k < ke; k++) {
+            const int j = k + RngBelow(&rng, ne - k);
+            const int tmp = pool[k]; pool[k] = pool[j]; pool[j] = tmp;
+            sources[next] = pool[k];
+            targets[next] = target;
+            weights[next] = 0.5f * RngUniform(&rng) * scale;
+            next++;
+        }
+        for (int k = 0; k < ki; k++) {
+            const int j = ne + k + RngBelow(&rng, n - ne - k);
+            const int tmp = pool[ne + k]; pool[ne + k] = pool[j]; pool[j] = tmp;
+            sources[next] = pool[ne + k];
+            targets[next] = target;
+            weights[next] = -RngUniform(&rng) * scale;
+            next++;
+        }
+    }
+
+    const bool connected = NetworkConnect(network, sources, targets, weights, (int)next);
+    free(sources);
+    free(targets);
+    free(weights);
+    free(pool);
+
+    if (!connected) {
+        NetworkFree(network);
+        return NULL;
+    }
+    return network;
+}
+
+bool Izhikevich2003Run(const Izhikevich2003Config *config, int threads, Izhikevich2003Result *result) {
+    if (!config || !result || config->duration <= 0.0f) return false;
+    result->benchmark.rank = 0;
+
+    // Opened first so that the pool threads (and processes) inherit it
+    const int counter = BenchmarkCounterOpen();
+
+    const double buildStart = BenchmarkNow();
+    Network *network = Izhikevich2003Build(config, threads);
+    if (!network || !NetworkReorder(network, config->reorder)) {
+        NetworkFree(network);
+        BenchmarkCounterClose(counter);
+        return false;
+    }
+    const double buildTime = BenchmarkNow() - buildStart;
+    const double rowSpread = NetworkRowSpread(network);
+
+    const int n  = network->neuronCount;
+    const int ne = (int)lround(n * EXCITATORY_FRACTION);
+    const long steps = lround(config->duration / config->dt);
+    const int decimation = (int)lroundf(1.0f / config->dt);
+
+    // Out-degree per neuron (caller index), to count synaptic events
+    int *outDegree = (int*)calloc(n, sizeof(int));
+    SpectrumEstimator *spectrum = (SpectrumEstimator*)malloc(sizeof(SpectrumEstimator));
+    float sigma[2];
+    if (!outDegree || !spectrum || !SpectrumInit(spectrum, SPECTRUM_SEGMENT, decimation > 0 ? decimation : 1, config->dt)) {
+        NetworkFree(network);
+        BenchmarkCounterClose(counter);
+        free(outDegree);
+        free(spectrum);
+        return false;
+    }
+    for (int position = 0; position < n; position++) {
+        const int *row = network->synapseStart + position * network->groupCount;
+        outDegree[network->order[position]] = row[network->groupCount] - row[0];
+    }
+    for (int g = 0; g < network->groupCount; g++) {
+        const bool excitatory = network->order[network->groupStart[g]] < ne;
+        sigma[g] = (excitatory ? config->excitatoryNoise : config->inhibitoryNoise) / sqrtf(config->dt);
+    }
+
+    NoiseJob job = { network, sigma, config->seed, 0 };
+    long spikes[2] = { 0, 0 };
+    long events = 0;
+
+    // Split across processes once the network is complete; only rank 0 reports the run
+    const int synapseCount = network->synapseCount;
+    const int rank = NetworkDistribute(network, config->processes, threads);
+    if (rank < 0) {
+        NetworkFree(network);
+        BenchmarkCounterClose(counter);
+        free(outDegree);
+        free(spectrum);
+        return false;
+    }
+    result->benchmark.rank = rank;
+    if (config->placement != BENCHMARK_PLACE_NONE) NetworkPlace(network, config->placement == BENCHMARK_PLACE_HUGE);
+
+    BenchmarkCounterEnable(counter, true);
+    const double start = BenchmarkNow();
+    bool ok = true;
+    for (job.step = 0; job.step < steps; job.step++) {
+        NetworkRunChunks(network, Izhikevich2003Noise, &job);
+        ok = NetworkStep(network);
+        if (!ok) break;
+
+        for (int s = 0; s < network->spikeCount; s++) {
+            const int neuron = network->spikes[s];
+            spikes[neuron < ne ? 0 : 1]++;
+            events += outDegree[neuron];
+        }
+        SpectrumPush(spectrum, 0.0f, (float)network->spikeCount);
+    }
+    const double wall = BenchmarkNow() - start;
+    BenchmarkCounterEnable(counter, false);
+
+    // Child ranks hold only their own part of the neuron state: the caller ends them
+    ok = NetworkJoin(network) && ok;
+    if (!ok || rank > 0) {
+        NetworkFree(network);
+        BenchmarkCounterClose(counter);
+        free(outDegree);
+        free(spectrum);
+        return ok;
+    }
+
+    result->benchmark = (BenchmarkResult){
+        .name      = "izhikevich2003",
+        .processes = config->processes,
+        .placement = config->placement,
+        .reorder   = config->reorder,
+        .threads   = ParallelPoolSize(network->pool),
+        .neurons   = n,
+        .synapses  = synapseCount,
+        .simulated = steps * (double)config->dt,
+        .buildTime = buildTime,
+        .wallTime  = wall,
+        .spikes    = spikes[0] + spikes[1],
+        .events    = events,
+        .rowSpread = rowSpread
+    };
+
+    const double seconds = result->benchmark.simulated / 1000.0;
+    result->excitatoryRate = spikes[0] / (ne * seconds);
+    result->inhibitoryRate = n > ne ? spikes[1] / ((n - ne) * seconds) : 0.0;
+
+    // Rhythm: dominant frequency and band shares of the population activity spectrum
+    result->peakFrequency = 0.0f;
+    result->alphaFraction = 0.0f;
+    result->gammaFraction = 0.0f;
+    result->rhythmChecked = false;
+    result->rhythmValid   = false;
+
+    float *psd = (float*)malloc(SPECTRUM_MAX_BINS * sizeof(float));
+    if (psd && SpectrumGetPower(spectrum, psd)) {
+        double total = 0.0, alpha = 0.0, gamma = 0.0, peak = -1.0;
+        int bins = 0, alphaBins = 0, gammaBins = 0;
+        for (int bin = 0; bin < SpectrumBinCount(spectrum); bin++) {
+            const float f = SpectrumBinFrequency(spectrum, bin);
+            if (f < BAND_LOW || f > BAND_HIGH) continue;
+
+            total += psd[bin];
+            bins++;
+            if (f >= ALPHA_LOW && f <= ALPHA_HIGH) { alpha += psd[bin]; alphaBins++; }
+            if (f >= GAMMA_LOW && f <= GAMMA_HIGH) { gamma += psd[bin]; gammaBins++; }
+            if (psd[bin] > peak) {
+                peak = psd[bin];
+                result->peakFrequency = f;
+            }
+        }
+        if (total > 0.0) {
+            result->alphaFraction = (float)(alpha / total);
+            result->gammaFraction = (float)(gamma / total);
+        }
+
+        // Valid: the peak lies in alpha or gamma, and that band holds well above its flat-spectrum share
+        const float f = result->peakFrequency;
+        const bool inAlpha = f >= ALPHA_LOW && f <= ALPHA_HIGH;
+        const bool inGamma = f >= GAMMA_LOW && f <= GAMMA_HIGH;
+        const float share  = inAlpha ? result->alphaFraction : result->gammaFraction;
+        const float flat   = bins > 0 ? (float)(inAlpha ? alphaBins : gammaBins) / bins : 1.0f;
+
+        result->rhythmChecked = result->benchmark.simulated >= IZHIKEVICH_2003_MIN_DURATION;
+        result->rhythmValid   = result->rhythmChecked && (inAlpha || inGamma) && share >= RHYTHM_MIN_SHARE_RATIO * flat;
+    }
+    free(psd);
+
+    NetworkFree(network);
+    result->benchmark.cacheMisses = BenchmarkCounterClose(counter);
+    free(outDegree);
+    free(spectrum);
+    return true;
+}
@@ -0,0 +1,377 @@
+/**
+ * @file benchmark_polychronization.c
+ * @brief Implementation of the polychronization network workload.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils/random.h"
+#include "simulation/benchmark_polychronization.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Share of excitatory neurons. */
+#define EXCITATORY_FRACTION 0.8
+
+/** @brief Initial synaptic weights. */
+#define EXCITATORY_WEIGHT  6.0f
+#define INHIBITORY_WEIGHT -5.0f
+
+/** @brief Thalamic pulse given to one random neuron every millisecond. */
+#define THALAMIC_CURRENT 20.0f
+
+/** @brief Per-millisecond decay of both traces (tau = 20 ms). */
+#define TRACE_DECAY 0.95f
+
+/**
+ * @brief Traces below this are flushed to zero. Left alone they decay into
+ * denormal floats, which made the trace pass ten times slower.
+ */
+#define TRACE_FLOOR 1e-6f
+
+/** @brief Trace values set by a spike (the LTP and LTD amplitudes). */
+#define PRE_TRACE_JUMP  0.10f
+#define POST_TRACE_JUMP 0.12f
+
+/** @brief Weight update once per second: w += WEIGHT_DRIFT + derivative, derivative *= DERIVATIVE_DECAY. */
+#define WEIGHT_PERIOD    1000
+#define WEIGHT_DRIFT     0.01f
+#define DERIVATIVE_DECAY 0.9f
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Neuron phase: the thalamic pulse and two 0.5 ms Euler half-steps
+ * with the input of this millisecond. Fills the spike row of 'time'.
+ */
+static void PolychronizationUpdateNeurons(PolychronizationNetwork *network, Rng *rng);
+
+/**
+ * @brief Plasticity phase: advances the traces, potentiates the incoming
+ * synapses of the neurons that just fired and applies the weight changes
+ * at the end of every second.
+ */
+static void PolychronizationPlasticity(PolychronizationNetwork *network);
+
+/**
+ * @brief Delivery phase: every spike of the last maxDelay milliseconds
+ * delivers its synapses whose delay expires at the next step, depressing
+ * the plastic ones by their target's trace.
+ * @return Number of synaptic events delivered.
+ */
+static long PolychronizationDeliver(PolychronizationNetwork *network);
+
+/**
+ * @brief Adds the derivative to every excitatory weight and clamps it.
+ */
+static void PolychronizationApplyWeights(PolychronizationNetwork *network);
+
+// --- Private (static) Function Implementations ---
+
+static void PolychronizationUpdateNeurons(PolychronizationNetwork *network, Rng *rng) {
+    IzhikevichPopulation *pop = network->neurons;
+    const int row = (int)(network->time % (network->maxDelay + 1));
+    int *fired = network->fired + (size_t)row * network->neuronCount;
+    int count = 0;
+
+    pop->iExt[RngBelow(rng, network->neuronCount)] += THALAMIC_CURRENT;
+
+    // At most one spike per millisecond, as in the reference implementation
+    for (int i = 0; i < network->neuronCount; i++) {
+        const float current = pop->iExt[i];
+        const bool first  = IzhikevichPopulationStepNeuron(pop, i, current, 0.5f);
+        const bool second = IzhikevichPopulationStepNeuron(pop, i, current, 0.5f);
+        pop->iExt[i] = 0.0f;
+        if (first || second) fired[count++] = i;
+    }
+    network->firedCount[row] = count;
+}
+
+static void PolychronizationPlasticity(PolychronizationNetwork *network) {
+    const int n = network->neuronCount;
+    const int rows = network->maxDelay + 1;
+    const int row = (int)(network->time % rows);
+    const float *previous = network->preTrace + (size_t)((row + rows - 1) % rows) * n;
+    float *current = network->preTrace + (size_t)row * n;
+
+    float *post = network->postTrace;
+    for (int i = 0; i < n; i++) {
+        const float pre = previous[i] * TRACE_DECAY;
+        const float postDecayed = post[i] * TRACE_DECAY;
+        current[i] = pre > TRACE_FLOOR ? pre : 0.0f;
+        post[i] = postDecayed > TRACE_FLOOR ? postDecayed : 0.0f;
+    }
+
+    const int *fired = network->fired + (size_t)row * n;
+    for (int k = 0; k < network->firedCount[row]; k++) {
+        const int i = fired[k];
+        current[i] = PRE_TRACE_JUMP;
+
+        // Potentiation by the trace each source had when its spike, arriving now, left
+        for (int s = network->incomingStart[i]; s < network->incomingStart[i + 1]; s++) {
+            int sourceRow = row - network->incomingDelay[s];
+            if (sourceRow < 0) sourceRow += rows;
+            network->derivative[network->incomingSynapse[s]] +=
+                network->preTrace[(size_t)sourceRow * n + network->incomingSource[s]];
+        }
+        post[i] = POST_TRACE_JUMP;
+    }
+
+    if ((network->time + 1) % WEIGHT_PERIOD == 0) PolychronizationApplyWeights(network);
+}
+
+static long PolychronizationDeliver(PolychronizationNetwork *network) {
+    const int n = network->neuronCount;
+    const int rows = network->maxDelay + 1;
+    const int delays = network->maxDelay;
+    float *input = network->neurons->iExt;
+    long events = 0;
+
+    for (int d = 1; d <= delays; d++) {
+        const long sent = network->time + 1 - d;
+        if (sent < 0) break;
+
+        const int row = (int)(sent % rows);
+        const int *fired = network->fired + (size_t)row * n;
+        for (int k = 0; k < network->firedCount[row]; k++) {
+            const int p = fired[k];
+            const int begin = network->delayStart[p * delays + d - 1];
+            const int end   = network->delayStart[p * delays + d];
+
+            if (p < network->excitatoryCount) {
+                for (int s = begin; s < end; s++) {
+                    input[network->target[s]] += network->weight[s];
+                    network->derivative[s] -= network->postTrace[network->target[s]];
+                }
+            } else {
+                for (int s = begin; s < end; s++) input[network->target[s]] += network->weight[s];
+            }
+            events += end - begin;
+        }
+    }
+    return events;
+}
+
+static void PolychronizationApplyWeights(PolychronizationNetwork *network) {
+    const int plastic = network->delayStart[network->excitatoryCount * network->maxDelay];
+    for (int s = 0; s < plastic; s++) {
+        float w = network->weight[s] + WEIGHT_DRIFT + network->derivative[s];
+        if (w < 0.0f) w = 0.0f;
+        if (w > POLYCHRONIZATION_MAX_WEIGHT) w = POLYCHRONIZATION_MAX_WEIGHT;
+        network->weight[s] = w;
+        network->derivative[s] *= DERIVATIVE_DECAY;
+    }
+}
+
+// --- Public (API) Function Implementations ---
+
+void PolychronizationDefaults(PolychronizationConfig *config) {
+    config->neurons           = 1000;
+    config->synapsesPerNeuron = 100;
+    config->maxDelay          = POLYCHRONIZATION_MAX_DELAY;
+    config->duration          = 10000.0f;
+    config->seed              = 2006;
+}
+
+PolychronizationNetwork *PolychronizationBuild(const PolychronizationConfig *config) {
+    if (!config || config->neurons < 5 || config->synapsesPerNeuron < 1 || config->maxDelay < 1) return NULL;
+
+    const int n  = config->neurons;
+    const int ne = (int)lround(n * EXCITATORY_FRACTION);
+    const int delays = config->maxDelay;
+    const int ke = config->synapsesPerNeuron < n - 1 ? config->synapsesPerNeuron : n - 1;
+    const int ki = config->synapsesPerNeuron < ne ? config->synapsesPerNeuron : ne;
+
+    const long synapses = (long)ne * ke + (long)(n - ne) * ki;
+    if ((long)n * delays + 1 > 0x7fffffffL || synapses > 0x7fffffffL) {
+        fprintf(stderr, "Error: network has too many synapses (%ld)\n", synapses);
+        return NULL;
+    }
+
+    PolychronizationNetwork *network = (PolychronizationNetwork*)calloc(1, sizeof(PolychronizationNetwork));
+    if (!network) return NULL;
+    network->neuronCount     = n;
+    network->excitatoryCount = ne;
+    network->maxDelay        = delays;
+    network->synapseCount    = (int)synapses;
+
+    network->neurons         = IzhikevichPopulationInit(n, &IZHIKEVICH_PARAMETERS[REGULAR_SPIKING]);
+    network->delayStart      = (int*)calloc((size_t)n * delays + 1, sizeof(int));
+    network->target          = (int*)malloc(synapses * sizeof(int));
+    network->weight          = (float*)malloc(synapses * sizeof(float));
+    network->derivative      = (float*)calloc(synapses, sizeof(float));
+    network->incomingStart   = (int*)calloc(n + 1, sizeof(int));
+    network->incomingSynapse = (int*)malloc(((long)ne * ke + 1) * sizeof(int));
+    network->incomingSource  = (int*)malloc(((long)ne * ke + 1) * sizeof(int));
+    network->incomingDelay   = (int*)malloc(((long)ne * ke + 1) * sizeof(int));
+    network->preTrace        = (float*)calloc((size_t)(delays + 1) * n, sizeof(float));
+    network->postTrace       = (float*)calloc(n, sizeof(float));
+    network->fired           = (int*)malloc((size_t)(delays + 1) * n * sizeof(int));
+    network->firedCount      = (int*)calloc(delays + 1, sizeof(int));
+    int *pool                = (int*)malloc(n * sizeof(int));
+    int *fill                = (int*)malloc(n * sizeof(int));
+
+    if (!network->neurons || !network->delayStart || !network->target || !network->weight
+        || !network->derivative || !network->incomingStart || !network->incomingSynapse
+        || !network->incomingSource || !network->incomingDelay || !network->preTrace
+        || !network->postTrace || !network->fired || !network->firedCount || !pool || !fill) {
+        free(pool);
+        free(fill);
+        PolychronizationFree(network);
+        return NULL;
+    }
+
+    // 1. Regular spiking excitatory and fast spiking inhibitory neurons, at rest
+    IzhikevichPopulation *pop = network->neurons;
+    for (int i = ne; i < n; i++) IzhikevichPopulationSetNeuron(pop, i, &IZHIKEVICH_PARAMETERS[FAST_SPIKING]);
+    for (int i = 0; i < n; i++) {
+        pop->v[i] = -65.0f;
+        pop->u[i] = ParameterColumnGet(&pop->b, i) * -65.0f;
+    }
+    IzhikevichPopulationCompact(pop);
+
+    // 2. Distinct random targets by partial Fisher-Yates, sorted by delay:
+    // excitatory delays spread evenly over 1..maxDelay, inhibitory ones 1 ms
+    Rng rng;
+    RngSeed(&rng, config->seed);
+    for (int i = 0; i < n; i++) pool[i] = i;
+
+    int next = 0;
+    for (int p = 0; p < n; p++) {
+        const bool excitatory = p < ne;
+        const int k = excitatory ? ke : ki;
+        const int candidates = excitatory ? n - 1 : ne;   // all but p, or the excitatory neurons
+
+        // The excitatory draws mixed the whole pool: start the inhibitory ones from
+        // 0..ne-1 in place, which their swaps within [0, ne) then keep
+        if (p == ne) for (int i = 0; i < ne; i++) pool[i] = i;
+
+        for (int j = 0; j < k; j++) {
+            const int pick = j + RngBelow(&rng, candidates - j);
+            const int tmp = pool[j]; pool[j] = pool[pick]; pool[pick] = tmp;
+
+            const int delay = excitatory ? 1 + (int)((long)j * delays / k) : 1;
+            network->target[next] = excitatory && pool[j] >= p ? pool[j] + 1 : pool[j];
+            network->weight[next] = excitatory ? EXCITATORY_WEIGHT : INHIBITORY_WEIGHT;
+            network->delayStart[p * delays + delay]++;
+            next++;
+        }
+    }
+    for (int r = 0; r < n * delays; r++) network->delayStart[r + 1] += network->delayStart[r];
+
+    // 3. Incoming excitatory synapses of each neuron, for potentiation
+    for (int s = 0; s < network->delayStart[ne * delays]; s++) network->incomingStart[network->target[s] + 1]++;
+    for (int i = 0; i < n; i++) network->incomingStart[i + 1] += network->incomingStart[i];
+    memcpy(fill, network->incomingStart, n * sizeof(int));
+    for (int p = 0; p < ne; p++) {
+        for (int d = 1; d <= delays; d++) {
+            for (int s = network->delayStart[p * delays + d - 1]; s < network->delayStart[p * delays + d]; s++) {
+                const int slot = fill[network->target[s]]++;
+                network->incomingSynapse[slot] = s;
+                network->incomingSource[slot]  = p;
+                network->incomingDelay[slot]   = d;
+            }
+        }
+    }
+
+    free(pool);
+    free(fill);
+    return network;
+}
+
+bool PolychronizationRun(const PolychronizationConfig *config, PolychronizationResult *result) {
+    if (!config || !result || config->duration < 1.0f) return false;
+
+    const double buildStart = BenchmarkNow();
+    PolychronizationNetwork *network = PolychronizationBuild(config);
+    if (!network) return false;
+    const double buildTime = BenchmarkNow() - buildStart;
+
+    const int n  = network->neuronCount;
+    const int ne = network->excitatoryCount;
+    const long steps = lround(config->duration);
+
+    Rng rng;
+    RngSeed(&rng, config->seed + 1);
+    long spikes[2] = { 0, 0 };
+    long events = 0;
+    double phase[3] = { 0.0, 0.0, 0.0 };
+
+    const double start = BenchmarkNow();
+    for (long step = 0; step < steps; step++) {
+        const double t0 = BenchmarkNow();
+        PolychronizationUpdateNeurons(network, &rng);
+        const double t1 = BenchmarkNow();
+        PolychronizationPlasticity(network);
+        const double t2 = BenchmarkNow();
+        events += PolychronizationDeliver(network);
+        const double t3 = BenchmarkNow();
+
+        phase[0] += t1 - t0;
+        phase[1] += t3 - t2;
+        phase[2] += t2 - t1;
+
+        const int row = (int)(network->time % (network->maxDelay + 1));
+        const int *fired = network->fired + (size_t)row * n;
+        for (int k = 0; k < network->firedCount[row]; k++) spikes[fired[k] < ne ? 0 : 1]++;
+        network->time++;
+    }
+    const double wall = BenchmarkNow() - start;
+
+    result->benchmark = (BenchmarkResult){
+        .name      = "polychronization",
+        .threads   = 1,
+        .neurons   = n,
+        .synapses  = network->synapseCount,
+        .simulated = (double)steps,
+        .buildTime = buildTime,
+        .wallTime  = wall,
+        .spikes    = spikes[0] + spikes[1],
+        .events    = events,
+        .rowSpread = -1.0,
+        .cacheMisses = -1
+    };
+    result->neuronTime     = phase[0];
+    result->deliveryTime   = phase[1];
+    result->plasticityTime = phase[2];
+
+    const double seconds = steps / 1000.0;
+    result->excitatoryRate = spikes[0] / (ne * seconds);
+    result->inhibitoryRate = n > ne ? spikes[1] / ((n - ne) * seconds) : 0.0;
+
+    // Final distribution of the plastic weights
+    const int plastic = network->delayStart[ne * network->maxDelay];
+    double sum = 0.0;
+    int saturated = 0, depressed = 0;
+    for (int s = 0; s < plastic; s++) {
+        const float w = network->weight[s];
+        sum += w;
+        if (w > 0.9f * POLYCHRONIZATION_MAX_WEIGHT) saturated++;
+        if (w < 0.1f * POLYCHRONIZATION_MAX_WEIGHT) depressed++;
+    }
+    result->meanWeight        = plastic > 0 ? (float)(sum / plastic) : 0.0f;
+    result->saturatedFraction = plastic > 0 ? (float)saturated / plastic : 0.0f;
+    result->depressedFraction = plastic > 0 ? (float)depressed / plastic : 0.0f;
+
+    PolychronizationFree(network);
+    return true;
+}
+
+void PolychronizationFree(PolychronizationNetwork *network) {
+    if (!network) return;
+    IzhikevichPopulationFree(network->neurons);
+    free(network->delayStart);
+    free(network->target);
+    free(network->weight);
+    free(network->derivative);
+    free(network->incomingStart);
+    free(network->incomingSynapse);
+    free(network->incomingSource);
+    free(network->incomingDelay);
+    free(network->preTrace);
+    free(network->postTrace);
+    free(network->fired);
+    free(network->firedCount);
+    free(network);
+}
@@ -0,0 +1,305 @@
+/**
+ * @file benchmark_vogels_abbott.c
+ * @brief Implementation of the COBA / CUBA network workloads.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "utils/random.h"
+#include "model/synaptic/ampa-gaba-a/ampa_gaba_a_config.h"
+#include "simulation/network_distributed.h"
+#include "simulation/benchmark_vogels_abbott.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Share of excitatory neurons. */
+#define EXCITATORY_FRACTION 0.8
+
+/** @brief Synaptic increments: nS in COBA, pA in CUBA (negative = inhibitory). */
+#define COBA_EXCITATORY_WEIGHT  6.0f
+#define COBA_INHIBITORY_WEIGHT -67.0f
+#define CUBA_EXCITATORY_WEIGHT  16.2f
+#define CUBA_INHIBITORY_WEIGHT -90.0f
+
+/** @brief Share of the run, at its end, over which the activity must be sustained. */
+#define FINAL_FRACTION 0.1
+
+/** @brief Validation window of the mean firing rate (Hz). */
+#define RATE_MIN 2.0
+#define RATE_MAX 50.0
+
+/** @brief Minimum mean ISI coefficient of variation of irregular firing. */
+#define CV_MIN 0.5
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Appends one synapse, growing the arrays as needed.
+ * @return false on allocation failure.
+ */
+static bool VogelsAbbottAppend(int **sources, int **targets, float **weights, long *count, long *capacity,
+                               int source, int target, float weight);
+
+/**
+ * @brief Draws the random initial potentials and synaptic variables.
+ */
+static void VogelsAbbottInitState(Network *network, const VogelsAbbottConfig *config, Rng *rng);
+
+// --- Private (static) Function Implementations ---
+
+static bool VogelsAbbottAppend(int **sources, int **targets, float **weights, long *count, long *capacity,
+                               int source, int target, float weight) {
+    if (*count == *capacity) {
+        const long grown = *capacity * 2;
+        int *s   = (int*)realloc(*sources, grown * sizeof(int));
+        if (s) *sources = s;
+        int *t   = (int*)realloc(*targets, grown * sizeof(int));
+        if (t) *targets = t;
+        float *w = (float*)realloc(*weights, grown * sizeof(float));
+        if (w) *weights = w;
+        if (!s || !t || !w) return false;
+        *capacity = grown;
+    }
+
+    (*sources)[*count] = source;
+    (*targets)[*count] = target;
+    (*weights)[*count] = weight;
+    (*count)++;
+    return true;
+}
+
+static void VogelsAbbottInitState(Network *network, const VogelsAbbottConfig *config, Rng *rng) {
+    for (int i = 0; i < network->neuronCount; i++) {
+        int local;
+        LifPopulation *pop = NetworkNeuronPopulation(network, i, &local)->lif;
+        const LifConfig *cfg = &pop->config;
+
+        if (config->type == LIF_VOGELS_ABBOTT_COBA) {
+            // Brette et al. (2007): v ~ N(El - 5, 5) mV, ge ~ N(40, 15) nS, gi ~ N(200, 120) nS
+            const float ge = 40.0f + 15.0f * RngNormal(rng);
+            const float gi = 200.0f + 120.0f * RngNormal(rng);
+            pop->v[local] = cfg->leakReversal - 5.0f + 5.0f * RngNormal(rng);
+            pop->excitatory[local] = ge > 0.0f ? ge : 0.0f;
+            pop->inhibitory[local] = gi > 0.0f ? gi : 0.0f;
+        } else {
+            // Uniform between reset and threshold, no synaptic current
+            pop->v[local] = cfg->resetPotential + RngUniform(rng) * (cfg->threshold - cfg->resetPotential);
+        }
+    }
+}
+
+// --- Public (API) Function Implementations ---
+
+void VogelsAbbottDefaults(VogelsAbbottConfig *config, LifNeuronType type) {
+    config->type              = type;
+    config->neurons           = 4000;
+    config->synapsesPerNeuron = VOGELS_ABBOTT_SYNAPSES;
+    config->dt                = 0.1f;
+    config->duration          = 1000.0f;
+    config->seed              = 2007;
+    config->processes         = 1;
+    config->placement         = BENCHMARK_PLACE_NONE;
+    config->reorder           = NETWORK_REORDER_NONE;
+}
+
+Network *VogelsAbbottBuild(const VogelsAbbottConfig *config, int threads) {
+    if (!config || config->neurons < 2 || config->synapsesPerNeuron < 1 || config->dt <= 0.0f) return NULL;
+
+    const int n  = config->neurons;
+    const int ne = (int)lround(n * EXCITATORY_FRACTION);
+    const double p = config->synapsesPerNeuron < n - 1 ? (double)config->synapsesPerNeuron / (n - 1) : 1.0;
+    const bool coba = config->type == LIF_VOGELS_ABBOTT_COBA;
+
+    // Two groups (excitatory, inhibitory) sharing the membrane; COBA takes
+    // its reversal potentials from the AMPA / GABA-A receptor parameters
+    PopulationConfig configs[2];
+    PopulationConfigDefaults(&configs[0], POPULATION_LIF);
+    configs[0].lif = LIF_PARAMETERS[config->type];
+    if (coba) {
+        configs[0].lif.excitatoryReversal = IZ_SYN_CFG.ampaReversalPotential;
+        configs[0].lif.inhibitoryReversal = IZ_SYN_CFG.gaba_aReversalPotential;
+    }
+    configs[1] = configs[0];
+
+    int *configIndex = (int*)malloc(n * sizeof(int));
+    if (!configIndex) return NULL;
+    for (int i = 0; i < n; i++) configIndex[i] = i < ne ? 0 : 1;
+
+    Network *network = NetworkCreateMixed(n, configs, 2, configIndex, config->dt, threads);
+    free(configIndex);
+
+    long count = 0;
+    long capacity = (long)(n * p * n * 1.05) + 16;
+    int *sources   = (int*)malloc(capacity * sizeof(int));
+    int *targets   = (int*)malloc(capacity * sizeof(int));
+    float *weights = (float*)malloc(capacity * sizeof(float));
+    bool ok = network && sources && targets && weights;
+
+    Rng rng;
+    RngSeed(&rng, config->seed);
+
+    // 1. Bernoulli connectivity without autapses, by geometric skips over the targets
+    const double logSkip = p < 1.0 ? log(1.0 - p) : 0.0;
+    for (int source = 0; ok && source < n; source++) {
+        const float weight = source < ne ? (coba ? COBA_EXCITATORY_WEIGHT : CUBA_EXCITATORY_WEIGHT)
+                                         : (coba ? COBA_INHIBITORY_WEIGHT : CUBA_INHIBITORY_WEIGHT);
+        for (long target = -1; ok; ) {
+            target += p < 1.0 ? 1 + (long)floor(log(1.0 - RngUniform(&rng)) / logSkip) : 1;
+            if (target >= n) break;
+            if (target == source) continue;
+            ok = VogelsAbbottAppend(&sources, &targets, &weights, &count, &capacity, source, (int)target, weight);
+        }
+    }
+    if (ok && count > 0x7fffffffL) {
+        fprintf(stderr, "Error: network has too many synapses (%ld)\n", count);
+        ok = false;
+    }
+
+    // 2. Random initial state
+    if (ok) {
+        ok = NetworkConnect(network, sources, targets, weights, (int)count);
+        VogelsAbbottInitState(network, config, &rng);
+    }
+
+    free(sources);
+    free(targets);
+    free(weights);
+    if (!ok) {
+        NetworkFree(network);
+        return NULL;
+    }
+    return network;
+}
+
+bool VogelsAbbottRun(const VogelsAbbottConfig *config, int threads, VogelsAbbottResult *result) {
+    if (!config || !result || config->duration <= 0.0f) return false;
+    result->benchmark.rank = 0;
+
+    // Opened first so that the pool threads (and processes) inherit it
+    const int counter = BenchmarkCounterOpen();
+
+    const double buildStart = BenchmarkNow();
+    Network *network = VogelsAbbottBuild(config, threads);
+    if (!network || !NetworkReorder(network, config->reorder)) {
+        NetworkFree(network);
+        BenchmarkCounterClose(counter);
+        return false;
+    }
+    const double buildTime = BenchmarkNow() - buildStart;
+    const double rowSpread = NetworkRowSpread(network);
+
+    const int n  = network->neuronCount;
+    const int ne = (int)lround(n * EXCITATORY_FRACTION);
+    const long steps = lround(config->duration / config->dt);
+    const long finalStep = steps - (long)ceil(steps * FINAL_FRACTION);
+
+    // Out-degree (to count synaptic events) and running ISI moments, per caller index
+    int *outDegree = (int*)calloc(n, sizeof(int));
+    double *isi    = (double*)calloc(3 * (size_t)n, sizeof(double));
+    if (!outDegree || !isi) {
+        NetworkFree(network);
+        BenchmarkCounterClose(counter);
+        free(outDegree);
+        free(isi);
+        return false;
+    }
+    for (int position = 0; position < n; position++) {
+        const int *row = network->synapseStart + position * network->groupCount;
+        outDegree[network->order[position]] = row[network->groupCount] - row[0];
+    }
+
+    long spikes[2] = { 0, 0 };
+    long events = 0, finalSpikes = 0;
+
+    // Split across processes once the network is complete; only rank 0 reports the run
+    const int synapseCount = network->synapseCount;
+    const int rank = NetworkDistribute(network, config->processes, threads);
+    if (rank < 0) {
+        NetworkFree(network);
+        BenchmarkCounterClose(counter);
+        free(outDegree);
+        free(isi);
+        return false;
+    }
+    result->benchmark.rank = rank;
+    if (config->placement != BENCHMARK_PLACE_NONE) NetworkPlace(network, config->placement == BENCHMARK_PLACE_HUGE);
+
+    BenchmarkCounterEnable(counter, true);
+    const double start = BenchmarkNow();
+    bool ok = true;
+    for (long step = 0; step < steps; step++) {
+        ok = NetworkStep(network);
+        if (!ok) break;
+
+        for (int s = 0; s < network->spikeCount; s++) {
+            const int neuron = network->spikes[s];
+            spikes[neuron < ne ? 0 : 1]++;
+            events += outDegree[neuron];
+
+            // network->period holds the interval that just ended (network order)
+            const float interval = network->period[network->index[neuron]];
+            if (interval > 0.0f) {
+                isi[3 * neuron]     += 1.0;
+                isi[3 * neuron + 1] += interval;
+                isi[3 * neuron + 2] += (double)interval * interval;
+            }
+        }
+        if (step >= finalStep) finalSpikes += network->spikeCount;
+    }
+    const double wall = BenchmarkNow() - start;
+    BenchmarkCounterEnable(counter, false);
+
+    // Child ranks hold only their own part of the neuron state: the caller ends them
+    ok = NetworkJoin(network) && ok;
+    if (!ok || rank > 0) {
+        NetworkFree(network);
+        BenchmarkCounterClose(counter);
+        free(outDegree);
+        free(isi);
+        return ok;
+    }
+
+    result->benchmark = (BenchmarkResult){
+        .name      = config->type == LIF_VOGELS_ABBOTT_COBA ? "coba" : "cuba",
+        .processes = config->processes,
+        .placement = config->placement,
+        .reorder   = config->reorder,
+        .threads   = ParallelPoolSize(network->pool),
+        .neurons   = n,
+        .synapses  = synapseCount,
+        .simulated = steps * (double)config->dt,
+        .buildTime = buildTime,
+        .wallTime  = wall,
+        .spikes    = spikes[0] + spikes[1],
+        .events    = events,
+        .rowSpread = rowSpread
+    };
+
+    const double seconds = result->benchmark.simulated / 1000.0;
+    result->excitatoryRate = spikes[0] / (ne * seconds);
+    result->inhibitoryRate = n > ne ? spikes[1] / ((n - ne) * seconds) : 0.0;
+    result->finalRate      = finalSpikes / (n * (steps - finalStep) * (double)config->dt / 1000.0);
+
+    // Mean CV over the neurons with at least two intervals
+    double cvSum = 0.0;
+    int cvCount = 0;
+    for (int i = 0; i < n; i++) {
+        const double k = isi[3 * i];
+        if (k < 2.0) continue;
+
+        const double mean = isi[3 * i + 1] / k;
+        const double var  = isi[3 * i + 2] / k - mean * mean;
+        cvSum += sqrt(var > 0.0 ? var : 0.0) / mean;
+        cvCount++;
+    }
+    result->meanCv = cvCount > 0 ? cvSum / cvCount : 0.0;
+
+    const double rate = (spikes[0] + spikes[1]) / (n * seconds);
+    result->rateValid = result->finalRate > 0.0 && rate >= RATE_MIN && rate <= RATE_MAX && result->meanCv >= CV_MIN;
+
+    NetworkFree(network);
+    result->benchmark.cacheMisses = BenchmarkCounterClose(counter);
+    free(outDegree);
+    free(isi);
+    return true;
+}
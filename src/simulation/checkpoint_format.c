@@ -0,0 +1,139 @@
+/**
+ * @file checkpoint_format.c
+ * @brief Implementation of the chunked checkpoint file format.
+ *
+ * Saving streams each chunk with fwrite into a temporary file; reading
+ * maps the whole file read-only with mmap, so restoring copies the chunk
+ * payloads into the live buffers without any intermediate buffering.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "simulation/checkpoint_format.h"
+
+// --- Public (API) Function Implementations ---
+
+FILE *CheckpointCreate(const char *path, uint32_t chunkCount, char *tmpPath, size_t tmpSize) {
+    if (snprintf(tmpPath, tmpSize, "%s.tmp", path) >= (int)tmpSize) return NULL;
+
+    FILE *file = fopen(tmpPath, "wb");
+    if (!file) {
+        fprintf(stderr, "Error: could not open checkpoint '%s' for writing.\n", tmpPath);
+        return NULL;
+    }
+
+    const CheckpointHeader header = {
+        .magic      = { 'N', 'L', 'C', 'K' },
+        .version    = CHECKPOINT_VERSION,
+        .chunkCount = chunkCount,
+        .reserved   = 0
+    };
+    if (fwrite(&header, sizeof(header), 1, file) != 1) {
+        fclose(file);
+        remove(tmpPath);
+        fprintf(stderr, "Error: failed to write checkpoint '%s'.\n", path);
+        return NULL;
+    }
+
+    return file;
+}
+
+bool CheckpointCommit(FILE *file, const char *tmpPath, const char *path, bool ok) {
+    if (fclose(file) != 0) ok = false;
+
+    if (!ok || rename(tmpPath, path) != 0) {
+        fprintf(stderr, "Error: failed to write checkpoint '%s'.\n", path);
+        remove(tmpPath);
+        return false;
+    }
+
+    return true;
+}
+
+bool CheckpointWriteChunk(FILE *file, CheckpointChunkTag tag, const void *data, uint64_t size) {
+    if (!CheckpointWriteChunkHeader(file, tag, size)) return false;
+    if (size > 0 && fwrite(data, (size_t)size, 1, file) != 1) return false;
+    return CheckpointWritePadding(file, size);
+}
+
+bool CheckpointWriteChunkHeader(FILE *file, CheckpointChunkTag tag, uint64_t size) {
+    const CheckpointChunkHeader header = { .tag = (uint32_t)tag, .reserved = 0, .size = size };
+    return fwrite(&header, sizeof(header), 1, file) == 1;
+}
+
+bool CheckpointWritePadding(FILE *file, uint64_t size) {
+    static const uint8_t padding[CHECKPOINT_CHUNK_ALIGN] = { 0 };
+
+    size_t pad = (CHECKPOINT_CHUNK_ALIGN - (size % CHECKPOINT_CHUNK_ALIGN)) % CHECKPOINT_CHUNK_ALIGN;
+    return pad == 0 || fwrite(padding, pad, 1, file) == 1;
+}
+
+bool CheckpointMap(const char *path, CheckpointMapping *mapping) {
+    memset(mapping, 0, sizeof(*mapping));
+
+    // 1. Map the file
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Error: could not open checkpoint '%s'.\n", path);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(CheckpointHeader)) {
+        close(fd);
+        fprintf(stderr, "Error: checkpoint '%s' is truncated.\n", path);
+        return false;
+    }
+
+    const size_t fileSize = (size_t)st.st_size;
+    const uint8_t *base = mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "Error: could not map checkpoint '%s'.\n", path);
+        return false;
+    }
+
+    // 2. Validate the header and locate the chunks
+    const CheckpointHeader *header = (const CheckpointHeader*)base;
+    bool ok = (memcmp(header->magic, CHECKPOINT_MAGIC, 4) == 0);
+    if (ok && header->version != CHECKPOINT_VERSION) {
+        fprintf(stderr, "Error: checkpoint version %u is not supported (expected %u).\n", header->version, CHECKPOINT_VERSION);
+        munmap((void*)base, fileSize);
+        return false;
+    }
+
+    size_t offset = sizeof(CheckpointHeader);
+    for (uint32_t i = 0; ok && i < header->chunkCount; i++) {
+        if (offset + sizeof(CheckpointChunkHeader) > fileSize) { ok = false; break; }
+
+        const CheckpointChunkHeader *chunk = (const CheckpointChunkHeader*)(base + offset);
+        offset += sizeof(CheckpointChunkHeader);
+        if (chunk->size > fileSize - offset) { ok = false; break; }
+
+        if (chunk->tag < CHECKPOINT_TAG_COUNT) {
+            mapping->chunks[chunk->tag] = base + offset;
+            mapping->sizes[chunk->tag]  = chunk->size;
+        }
+        offset += (size_t)((chunk->size + CHECKPOINT_CHUNK_ALIGN - 1) / CHECKPOINT_CHUNK_ALIGN * CHECKPOINT_CHUNK_ALIGN);
+    }
+
+    if (!ok) {
+        munmap((void*)base, fileSize);
+        memset(mapping, 0, sizeof(*mapping));
+        fprintf(stderr, "Error: checkpoint '%s' is malformed.\n", path);
+        return false;
+    }
+
+    mapping->base = base;
+    mapping->size = fileSize;
+    return true;
+}
+
+void CheckpointUnmap(CheckpointMapping *mapping) {
+    if (mapping->base) munmap((void*)mapping->base, mapping->size);
+    memset(mapping, 0, sizeof(*mapping));
+}
@@ -0,0 +1,253 @@
+/**
+ * @file circuit.c
+ * @brief Implementation of the dual (spiking / rate) circuit representation.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "simulation/circuit.h"
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Returns the total number of neurons of a circuit.
+ */
+static int CircuitNeuronCount(const Circuit *circuit);
+
+/**
+ * @brief Time integral of the input produced by one spike of unit weight
+ * (ms, times the driving force for conductance synapses).
+ */
+static float CircuitSpikeCharge(const Circuit *circuit, bool inhibitory);
+
+/**
+ * @brief Draws 'k' distinct indices from [0, n) (partial Fisher-Yates over 'pool').
+ */
+static void CircuitSample(Rng *rng, int *pool, int n, int k);
+
+// --- Private (static) Function Implementations ---
+
+static int CircuitNeuronCount(const Circuit *circuit) {
+    int total = 0;
+    for (int k = 0; k < circuit->count; k++) total += circuit->populations[k].size;
+    return total;
+}
+
+static float CircuitSpikeCharge(const Circuit *circuit, bool inhibitory) {
+    const PopulationConfig *neuron = &circuit->neuron;
+
+    switch (neuron->model) {
+        case POPULATION_IZHIKEVICH:
+        case POPULATION_HODGKIN_HUXLEY:
+            return 1.0f;
+        case POPULATION_LIF: {
+            const LifConfig *lif = &neuron->lif;
+            const float tau = inhibitory ? lif->tauInhibitory : lif->tauExcitatory;
+            if (lif->mode == LIF_CURRENT_BASED) return tau;
+
+            // Conductance: driving force taken at the firing threshold
+            const float reversal = inhibitory ? lif->inhibitoryReversal : lif->excitatoryReversal;
+            return tau * fabsf(reversal - lif->threshold);
+        }
+        case POPULATION_ADEX:
+            return inhibitory ? neuron->adex.tauInhibitory : neuron->adex.tauExcitatory;
+    }
+    return 0.0f;
+}
+
+static void CircuitSample(Rng *rng, int *pool, int n, int k) {
+    for (int i = 0; i < k; i++) {
+        const int j = i + RngBelow(rng, n - i);
+        const int tmp = pool[i];
+        pool[i] = pool[j];
+        pool[j] = tmp;
+    }
+}
+
+// --- Public (API) Function Implementations ---
+
+void CircuitDefaults(Circuit *circuit) {
+    memset(circuit, 0, sizeof(*circuit));
+    circuit->count = 2;
+    circuit->dt    = 0.5f;
+    circuit->seed  = 2003;
+    PopulationConfigDefaults(&circuit->neuron, POPULATION_IZHIKEVICH);
+
+    CircuitPopulation *e = &circuit->populations[0];
+    e->size       = 800;
+    e->inhibitory = false;
+    e->izhikevich = IZHIKEVICH_PARAMETERS[REGULAR_SPIKING];
+    e->noise      = 5.0f;
+    e->tau        = 10.0f;
+    e->gain       = 0.1f;
+    e->threshold  = 22.0f;
+    e->maxRate    = 100.0f;
+
+    CircuitPopulation *i = &circuit->populations[1];
+    i->size       = 200;
+    i->inhibitory = true;
+    i->izhikevich = IZHIKEVICH_PARAMETERS[FAST_SPIKING];
+    i->noise      = 2.0f;
+    i->tau        = 5.0f;
+    i->gain       = 0.16f;
+    i->threshold  = 17.0f;
+    i->maxRate    = 410.0f;
+
+    // Same mean coupling as the all-to-all original with uniform weights
+    for (int t = 0; t < 2; t++) {
+        circuit->probability[t][0] = 0.1f;
+        circuit->probability[t][1] = 0.1f;
+        circuit->weight[t][0]      = 2.5f;
+        circuit->weight[t][1]      = 5.0f;
+    }
+}
+
+int CircuitPopulationOffset(const Circuit *circuit, int population) {
+    int offset = 0;
+    for (int k = 0; k < population && k < circuit->count; k++) offset += circuit->populations[k].size;
+    return offset;
+}
+
+Network *CircuitBuildNetwork(const Circuit *circuit, int threads) {
+    if (!circuit || circuit->count < 1 || circuit->count > CIRCUIT_MAX_POPULATIONS) return NULL;
+
+    const int total = CircuitNeuronCount(circuit);
+    if (total <= 0) return NULL;
+
+    // Synapse count: fixed in-degree per (target, source) block
+    int inDegree[CIRCUIT_MAX_POPULATIONS][CIRCUIT_MAX_POPULATIONS];
+    long synapses = 0;
+    int largest = 0;
+    for (int t = 0; t < circuit->count; t++) {
+        for (int s = 0; s < circuit->count; s++) {
+            const int size = circuit->populations[s].size;
+            int k = (int)lroundf(circuit->probability[t][s] * size);
+            inDegree[t][s] = k < 0 ? 0 : (k > size ? size : k);
+            synapses += (long)inDegree[t][s] * circuit->populations[t].size;
+        }
+        if (circuit->populations[t].size > largest) largest = circuit->populations[t].size;
+    }
+    if (synapses > 0x7fffffffL) {
+        fprintf(stderr, "Error: circuit has too many synapses (%ld)\n", synapses);
+        return NULL;
+    }
+
+    // One network group per circuit population (its own Izhikevich preset if the model is Izhikevich)
+    PopulationConfig configs[CIRCUIT_MAX_POPULATIONS];
+    int *configIndex = (int*)malloc(total * sizeof(int));
+    if (!configIndex) return NULL;
+    for (int k = 0, index = 0; k < circuit->count; k++) {
+        configs[k] = circuit->neuron;
+        configs[k].izhikevich = circuit->populations[k].izhikevich;
+        for (int n = 0; n < circuit->populations[k].size; n++) configIndex[index++] = k;
+    }
+
+    Network *network = NetworkCreateMixed(total, configs, circuit->count, configIndex, circuit->dt, threads);
+    free(configIndex);
+    int *sources  = (int*)malloc((synapses > 0 ? synapses : 1) * sizeof(int));
+    int *targets  = (int*)malloc((synapses > 0 ? synapses : 1) * sizeof(int));
+    float *weights = (float*)malloc((synapses > 0 ? synapses : 1) * sizeof(float));
+    int *pool     = (int*)malloc(largest * sizeof(int));
+    if (!network || !sources || !targets || !weights || !pool) {
+        NetworkFree(network);
+        free(sources);
+        free(targets);
+        free(weights);
+        free(pool);
+        return NULL;
+    }
+
+    Rng rng;
+    RngSeed(&rng, circuit->seed);
+    long next = 0;
+    for (int t = 0; t < circuit->count; t++) {
+        const int targetOffset = CircuitPopulationOffset(circuit, t);
+        for (int s = 0; s < circuit->count; s++) {
+            const CircuitPopulation *src = &circuit->populations[s];
+            const int sourceOffset = CircuitPopulationOffset(circuit, s);
+            const float weight = src->inhibitory ? -circuit->weight[t][s] : circuit->weight[t][s];
+
+            for (int n = 0; n < src->size; n++) pool[n] = n;
+            for (int target = 0; target < circuit->populations[t].size; target++) {
+                CircuitSample(&rng, pool, src->size, inDegree[t][s]);
+                for (int k = 0; k < inDegree[t][s]; k++) {
+                    sources[next] = sourceOffset + pool[k];
+                    targets[next] = targetOffset + target;
+                    weights[next] = weight;
+                    next++;
+                }
+            }
+        }
+    }
+
+    const bool connected = NetworkConnect(network, sources, targets, weights, (int)next);
+    free(sources);
+    free(targets);
+    free(weights);
+    free(pool);
+
+    if (!connected) {
+        NetworkFree(network);
+        return NULL;
+    }
+    return network;
+}
+
+void CircuitApplyDrive(const Circuit *circuit, Network *network, Rng *rng) {
+    // White noise: the per-step std grows as 1 / sqrt(dt) to keep its effect dt-independent
+    const float noiseScale = 1.0f / sqrtf(network->dt);
+    int index = 0;
+    for (int k = 0; k < circuit->count; k++) {
+        const CircuitPopulation *pop = &circuit->populations[k];
+        const float sigma = pop->noise * noiseScale;
+        if (pop->size == 0) continue;
+
+        // Each circuit population is one network group
+        int local;
+        float *iExt = PopulationExternalCurrent(NetworkNeuronPopulation(network, index, &local)) + local;
+        for (int n = 0; n < pop->size; n++, index++) {
+            iExt[n] = pop->drive + (sigma > 0.0f ? sigma * RngNormal(rng) : 0.0f);
+        }
+    }
+}
+
+void CircuitCountSpikes(const Circuit *circuit, const Network *network, long *counts) {
+    int bounds[CIRCUIT_MAX_POPULATIONS];
+    for (int k = 0; k < circuit->count; k++) bounds[k] = CircuitPopulationOffset(circuit, k + 1);
+
+    for (int s = 0; s < network->spikeCount; s++) {
+        int k = 0;
+        while (k < circuit->count - 1 && network->spikes[s] >= bounds[k]) k++;
+        counts[k]++;
+    }
+}
+
+bool CircuitBuildRateModel(const Circuit *circuit, RateModel *model) {
+    if (!circuit || circuit->count < 1 || circuit->count > CIRCUIT_MAX_POPULATIONS) return false;
+
+    RateModelConfig config;
+    memset(&config, 0, sizeof(config));
+    config.count = circuit->count;
+
+    for (int t = 0; t < circuit->count; t++) {
+        const CircuitPopulation *pop = &circuit->populations[t];
+        config.tau[t]        = pop->tau;
+        config.gain[t]       = pop->gain;
+        config.threshold[t]  = pop->threshold;
+        config.maxRate[t]    = pop->maxRate;
+        config.refractory[t] = 0.0f;
+        config.input[t]      = pop->drive;
+
+        // Mean input to t per unit activity of s: in-degree * weight * charge * rate (per ms)
+        for (int s = 0; s < circuit->count; s++) {
+            const CircuitPopulation *src = &circuit->populations[s];
+            const float inDegree = circuit->probability[t][s] * src->size;
+            const float sign = src->inhibitory ? -1.0f : 1.0f;
+            config.weight[t][s] = sign * inDegree * circuit->weight[t][s]
+                                * CircuitSpikeCharge(circuit, src->inhibitory) * src->maxRate * 1e-3f;
+        }
+    }
+
+    return RateModelInit(model, &config, circuit->dt);
+}
@@ -0,0 +1,329 @@
+/**
+ * @file event_network.c
+ * @brief Implementation of the event-driven LIF network.
+ *
+ * Two kinds of events share the queue: a threshold event (target = neuron,
+ * data = EVENT_THRESHOLD) and a spike arrival (target = source neuron,
+ * data = EVENT_ARRIVAL) that delivers all the outgoing synapses of one
+ * spike at once, since every synapse has the same delay.
+ *
+ * Each neuron has at most one threshold event queued, held by its node
+ * handle. An input that brings the crossing forward moves that node; one
+ * that delays it (inhibition, or excitation during a long approach) leaves
+ * the node where it is, a lower bound of the crossing, and the event is
+ * queued again at the exact time when it surfaces. Several delaying
+ * inputs in a row thus cost one re-queue, and no outdated events ever
+ * fill the queue.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "simulation/event_network.h"
+
+// --- Internal Module Constants ---
+
+/** @brief 'data' of a threshold event. */
+#define EVENT_THRESHOLD 0
+
+/** @brief 'data' of a spike arrival event. */
+#define EVENT_ARRIVAL (-1)
+
+/** @brief Initial day length of the calendar queue (ms). */
+#define QUEUE_WIDTH 0.1
+
+/** @brief Number of double arrays per neuron in the network. */
+#define NEURON_ARRAYS 5
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Queues an event, marking the network as failed if the queue cannot grow.
+ * @return The node of the event, or -1 on failure.
+ */
+static int EventPush(EventNetwork *network, double time, int target, int data);
+
+/**
+ * @brief Brings the potential of a neuron forward to time t (t >= lastUpdate).
+ */
+static void EventNeuronAdvance(EventNetwork *network, int neuron, double t);
+
+/**
+ * @brief Computes the next crossing of an (up to date) neuron and keeps its
+ * threshold event at or before it: moved forward, left in place if the
+ * crossing got later, or removed if there is none.
+ */
+static void EventNeuronSchedule(EventNetwork *network, int neuron);
+
+/**
+ * @brief Emits a spike at time t: reset, refractory period, spike arrival and next crossing.
+ */
+static void EventNeuronFire(EventNetwork *network, int neuron, double t);
+
+/**
+ * @brief Delivers the synapses of one spike of 'source' at time t.
+ */
+static void EventDeliver(EventNetwork *network, int source, double t);
+
+// --- Private (static) Function Implementations ---
+
+static int EventPush(EventNetwork *network, double time, int target, int data) {
+    const int node = CalendarQueuePush(&network->queue, time, target, data);
+    if (node >= 0) return node;
+
+    if (!network->failed) fprintf(stderr, "Error: event queue allocation failed at t = %g ms\n", network->time);
+    network->failed = true;
+    return -1;
+}
+
+static void EventNeuronAdvance(EventNetwork *network, int neuron, double t) {
+    const double refractoryEnd = network->refractoryUntil[neuron];
+
+    if (t <= refractoryEnd) {
+        network->v[neuron] = network->config.resetPotential;
+    } else {
+        // Relaxation towards V_inf, from the end of the refractory period if it ended in between
+        const double start = network->lastUpdate[neuron] > refractoryEnd ? network->lastUpdate[neuron] : refractoryEnd;
+        const double vInf  = network->vInf[neuron];
+        network->v[neuron] = vInf + (network->v[neuron] - vInf) * exp(-(t - start) / network->tauMembrane);
+    }
+    network->lastUpdate[neuron] = t;
+}
+
+static void EventNeuronSchedule(EventNetwork *network, int neuron) {
+    const double vInf      = network->vInf[neuron];
+    const double threshold = network->config.threshold;
+    int *pending = &network->pending[neuron];
+
+    if (vInf <= threshold) {
+        network->crossing[neuron] = INFINITY;
+        if (*pending >= 0) {
+            CalendarQueueRemove(&network->queue, *pending);
+            *pending = -1;
+        }
+        return;
+    }
+
+    const double refractoryEnd = network->refractoryUntil[neuron];
+    const double start = network->lastUpdate[neuron] > refractoryEnd ? network->lastUpdate[neuron] : refractoryEnd;
+    const double v0 = network->v[neuron];
+
+    double crossing = start;
+    if (v0 < threshold) crossing += network->tauMembrane * log((v0 - vInf) / (threshold - vInf));
+
+    network->crossing[neuron] = crossing;
+
+    if (*pending < 0) {
+        *pending = EventPush(network, crossing, neuron, EVENT_THRESHOLD);
+    } else if (crossing < network->queue.nodes[*pending].event.time) {
+        CalendarQueueReschedule(&network->queue, *pending, crossing);
+    }
+}
+
+static void EventNeuronFire(EventNetwork *network, int neuron, double t) {
+    network->spikeCount++;
+    if (network->onSpike) network->onSpike(neuron, t, network->userData);
+
+    network->v[neuron]               = network->config.resetPotential;
+    network->lastUpdate[neuron]      = t;
+    network->refractoryUntil[neuron] = t + network->config.refractoryPeriod;
+
+    if (network->synapseStart[neuron + 1] > network->synapseStart[neuron]) {
+        EventPush(network, t + network->delay, neuron, EVENT_ARRIVAL);
+    }
+    EventNeuronSchedule(network, neuron);
+}
+
+static void EventDeliver(EventNetwork *network, int source, double t) {
+    const double threshold = network->config.threshold;
+
+    for (int s = network->synapseStart[source]; s < network->synapseStart[source + 1]; s++) {
+        const int target = network->synapseTarget[s];
+        network->eventCount++;
+
+        // Inputs during the refractory period are lost
+        if (t <= network->refractoryUntil[target]) continue;
+
+        EventNeuronAdvance(network, target, t);
+        network->v[target] += network->synapseWeight[s];
+
+        if (network->v[target] >= threshold) {
+            EventNeuronFire(network, target, t);
+        } else {
+            EventNeuronSchedule(network, target);
+        }
+    }
+}
+
+// --- Public (API) Function Implementations ---
+
+EventNetwork *EventNetworkCreate(int neuronCount, const LifConfig *config, float delay) {
+    if (neuronCount <= 0 || !config || delay <= 0.0f || config->leakConductance <= 0.0f) return NULL;
+
+    EventNetwork *network = (EventNetwork*)calloc(1, sizeof(EventNetwork));
+    if (!network) return NULL;
+
+    double *buffer        = (double*)calloc((size_t)neuronCount * NEURON_ARRAYS, sizeof(double));
+    network->pending      = (int*)malloc(neuronCount * sizeof(int));
+    network->synapseStart = (int*)calloc(neuronCount + 1, sizeof(int));
+    if (!buffer || !network->pending || !network->synapseStart || !CalendarQueueInit(&network->queue, QUEUE_WIDTH)) {
+        free(buffer);
+        free(network->pending);
+        free(network->synapseStart);
+        free(network);
+        return NULL;
+    }
+
+    network->neuronCount = neuronCount;
+    network->config      = *config;
+    network->tauMembrane = (double)config->capacitance / config->leakConductance;
+    network->delay       = delay;
+
+    network->v               = buffer;
+    network->lastUpdate      = buffer + neuronCount;
+    network->refractoryUntil = buffer + 2 * neuronCount;
+    network->vInf            = buffer + 3 * neuronCount;
+    network->crossing        = buffer + 4 * neuronCount;
+
+    for (int i = 0; i < neuronCount; i++) {
+        network->v[i]               = config->leakReversal;
+        network->vInf[i]            = config->leakReversal;
+        network->refractoryUntil[i] = -INFINITY;
+        network->crossing[i]        = INFINITY;
+        network->pending[i]         = -1;
+    }
+
+    // A leak reversal above threshold makes every neuron fire on its own
+    for (int i = 0; i < neuronCount; i++) EventNeuronSchedule(network, i);
+    if (network->failed) {
+        EventNetworkFree(network);
+        return NULL;
+    }
+
+    return network;
+}
+
+bool EventNetworkConnect(EventNetwork *network, const int *sources, const int *targets, const float *weights, int count) {
+    if (!network || count < 0) return false;
+
+    const int n = network->neuronCount;
+    for (int k = 0; k < count; k++) {
+        if (sources[k] < 0 || sources[k] >= n || targets[k] < 0 || targets[k] >= n) {
+            fprintf(stderr, "Error: synapse %d (%d -> %d) is out of range\n", k, sources[k], targets[k]);
+            return false;
+        }
+    }
+
+    int *start   = (int*)calloc(n + 1, sizeof(int));
+    int *target  = (int*)malloc((count > 0 ? count : 1) * sizeof(int));
+    float *weight = (float*)malloc((count > 0 ? count : 1) * sizeof(float));
+    if (!start || !target || !weight) {
+        free(start);
+        free(target);
+        free(weight);
+        return false;
+    }
+
+    // Counting sort by source, as in NetworkConnect
+    for (int k = 0; k < count; k++) start[sources[k] + 1]++;
+    for (int i = 0; i < n; i++) start[i + 1] += start[i];
+    for (int k = 0; k < count; k++) {
+        const int slot = start[sources[k]]++;
+        target[slot] = targets[k];
+        weight[slot] = weights[k];
+    }
+    for (int i = n; i > 0; i--) start[i] = start[i - 1];
+    start[0] = 0;
+
+    free(network->synapseStart);
+    free(network->synapseTarget);
+    free(network->synapseWeight);
+    network->synapseStart  = start;
+    network->synapseTarget = target;
+    network->synapseWeight = weight;
+    network->synapseCount  = count;
+    return true;
+}
+
+bool EventNetworkSetPotential(EventNetwork *network, int neuron, float potential) {
+    if (!network) return false;
+    if (neuron < 0 || neuron >= network->neuronCount) return !network->failed;
+
+    network->v[neuron]          = potential;
+    network->lastUpdate[neuron] = network->time;
+    if (network->refractoryUntil[neuron] > network->time) network->refractoryUntil[neuron] = network->time;
+
+    if (potential >= network->config.threshold) {
+        EventNeuronFire(network, neuron, network->time);
+    } else {
+        EventNeuronSchedule(network, neuron);
+    }
+    return !network->failed;
+}
+
+bool EventNetworkSetDrive(EventNetwork *network, int neuron, float current) {
+    if (!network) return false;
+    if (neuron < 0 || neuron >= network->neuronCount) return !network->failed;
+
+    EventNeuronAdvance(network, neuron, network->time);
+    network->vInf[neuron] = network->config.leakReversal + (double)current / network->config.leakConductance;
+    EventNeuronSchedule(network, neuron);
+    return !network->failed;
+}
+
+void EventNetworkSetSpikeCallback(EventNetwork *network, EventSpikeCallback onSpike, void *userData) {
+    if (!network) return;
+    network->onSpike  = onSpike;
+    network->userData = userData;
+}
+
+long EventNetworkRun(EventNetwork *network, double until) {
+    if (!network || network->failed) return -1;
+
+    const long before = network->eventCount;
+    CalendarEvent event;
+
+    while (!network->failed && CalendarQueuePeek(&network->queue, &event) && event.time <= until) {
+        CalendarQueuePop(&network->queue, NULL);
+        network->time = event.time;
+
+        if (event.data == EVENT_ARRIVAL) {
+            EventDeliver(network, event.target, event.time);
+            continue;
+        }
+
+        const int neuron = event.target;
+        network->pending[neuron] = -1;
+        if (event.time < network->crossing[neuron]) {
+            // Inputs delayed the crossing since the event was queued
+            network->deferredCount++;
+            network->pending[neuron] = EventPush(network, network->crossing[neuron], neuron, EVENT_THRESHOLD);
+        } else {
+            network->eventCount++;
+            EventNeuronAdvance(network, neuron, event.time);
+            EventNeuronFire(network, neuron, event.time);
+        }
+    }
+
+    if (network->failed) return -1;
+
+    if (until > network->time) network->time = until;
+    return network->eventCount - before;
+}
+
+double EventNetworkPotential(EventNetwork *network, int neuron) {
+    if (!network || neuron < 0 || neuron >= network->neuronCount) return 0.0;
+
+    EventNeuronAdvance(network, neuron, network->time);
+    return network->v[neuron];
+}
+
+void EventNetworkFree(EventNetwork *network) {
+    if (!network) return;
+    CalendarQueueFree(&network->queue);
+    free(network->v);
+    free(network->pending);
+    free(network->synapseStart);
+    free(network->synapseTarget);
+    free(network->synapseWeight);
+    free(network);
+}
@@ -0,0 +1,477 @@
+/**
+ * @file network.c
+ * @brief Implementation of the multi-threaded network engine.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "simulation/network.h"
+#include "simulation/network_distributed.h"
+#include "simulation/network_partition.h"
+#include "utils/memory.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Two pi, for the phase of a neuron within its firing cycle. */
+#define TWO_PI 6.28318530717958647692
+
+/**
+ * @brief A neuron silent for more than this many of its last periods is
+ * considered to have stopped firing and has no phase.
+ */
+#define PHASE_MAX_CYCLES 2.0f
+
+/**
+ * @struct NetworkPlacement
+ * @brief Shared state of the parallel state move of NetworkPlace.
+ */
+typedef struct {
+    Network *network;
+    PopulationMove *moves;        ///< One per group
+} NetworkPlacement;
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief ParallelPoolRunRanges body: updates one chunk and accumulates its observables.
+ */
+static void NetworkUpdateChunk(int index, void *userData);
+
+/**
+ * @brief Gathers the chunk spike lists and adds the synaptic weights of
+ * every spike to its targets.
+ */
+static void NetworkDeliverSpikes(Network *network);
+
+/**
+ * @brief Returns the group of a neuron given in network order.
+ */
+static int NetworkGroupOf(const Network *network, int position);
+
+/**
+ * @brief ParallelPoolRunEach body: copies the home chunks of one thread to
+ * their new memory.
+ */
+static void NetworkPlaceHome(int thread, void *userData);
+
+/**
+ * @brief Moves the state of every group so that each home range is first
+ * touched by its thread.
+ * @return false on allocation failure (the state stays where it was).
+ */
+static bool NetworkPlaceState(Network *network);
+
+/**
+ * @brief Moves the synapses to memory first touched by the calling thread.
+ * @return false on allocation failure (the synapses stay where they were).
+ */
+static bool NetworkPlaceSynapses(Network *network);
+
+// --- Private (static) Function Implementations ---
+
+static void NetworkUpdateChunk(int index, void *userData) {
+    Network *network = (Network*)userData;
+    NetworkChunk *chunk = &network->chunks[network->chunkOrder[index]];
+    const double start = network->sampleCost ? NetworkCostClock() : 0.0;
+
+    const float now = (float)(network->time + network->dt);
+    int *spikes = network->spikeBuffer + chunk->begin;
+    PopulationPartial partial;
+    PopulationPartialClear(&partial);
+
+    // The group's model step consumes the synaptic input and sums it (the LFP proxy)
+    const int base = network->groupStart[chunk->group];
+    partial.spikes = PopulationStep(network->groups[chunk->group], chunk->begin - base, chunk->end - base,
+                                    spikes, &partial.iSyn);
+
+    for (int s = 0; s < partial.spikes; s++) {
+        const int i = (spikes[s] += base);
+        if (network->lastSpike[i] >= 0.0f) network->period[i] = now - network->lastSpike[i];
+        network->lastSpike[i] = now;
+    }
+
+    // Kuramoto term: phase = 2*pi * (time since last spike) / (last period)
+    if (network->samplePhase) {
+        for (int i = chunk->begin; i < chunk->end; i++) {
+            if (network->period[i] <= 0.0f) continue;
+
+            float cycle = (now - network->lastSpike[i]) / network->period[i];
+            if (cycle > PHASE_MAX_CYCLES) continue;
+            if (cycle > 1.0f) cycle = 1.0f;
+
+            const double theta = TWO_PI * cycle;
+            partial.phaseCos += cos(theta);
+            partial.phaseSin += sin(theta);
+            partial.phaseCount++;
+        }
+    }
+
+    chunk->spikeCount = partial.spikes;
+    chunk->partial    = partial;
+    if (network->sampleCost) chunk->sampled = NetworkCostClock() - start;
+}
+
+static void NetworkDeliverSpikes(Network *network) {
+    network->spikeCount = 0;
+    for (int c = 0; c < network->chunkCount; c++) {
+        const NetworkChunk *chunk = &network->chunks[c];
+        memcpy(network->spikes + network->spikeCount, network->spikeBuffer + chunk->begin,
+               chunk->spikeCount * sizeof(int));
+        network->spikeCount += chunk->spikeCount;
+    }
+
+    // One row segment per target group, so each group receives its synapses in one call
+    const int groups = network->groupCount;
+    for (int s = 0; s < network->spikeCount; s++) {
+        const int *row = network->synapseStart + network->spikes[s] * groups;
+        for (int g = 0; g < groups; g++) {
+            if (row[g + 1] == row[g]) continue;
+            PopulationDeliver(network->groups[g], network->synapseTarget + row[g], network->synapseWeight + row[g],
+                              row[g + 1] - row[g]);
+        }
+        network->spikes[s] = network->order[network->spikes[s]];
+    }
+}
+
+static int NetworkGroupOf(const Network *network, int position) {
+    int g = 0;
+    while (position >= network->groupStart[g + 1]) g++;
+    return g;
+}
+
+static void NetworkPlaceHome(int thread, void *userData) {
+    const NetworkPlacement *placement = (const NetworkPlacement*)userData;
+    const Network *network = placement->network;
+    if (thread >= network->homeCount) return;
+
+    for (int c = network->homeChunk[thread]; c < network->homeChunk[thread + 1]; c++) {
+        const NetworkChunk *chunk = &network->chunks[c];
+        const int base = network->groupStart[chunk->group];
+        PopulationMoveRange(&placement->moves[chunk->group], chunk->begin - base, chunk->end - base);
+    }
+}
+
+static bool NetworkPlaceState(Network *network) {
+    PopulationMove *moves = (PopulationMove*)calloc(network->groupCount, sizeof(PopulationMove));
+    if (!moves) return false;
+
+    for (int g = 0; g < network->groupCount; g++) {
+        if (PopulationMoveBegin(network->groups[g], &moves[g], network->hugePages)) continue;
+        for (int k = 0; k < g; k++) PopulationMoveCancel(&moves[k]);
+        free(moves);
+        return false;
+    }
+
+    NetworkPlacement placement = { network, moves };
+    ParallelPoolRunEach(network->pool, NetworkPlaceHome, &placement);
+
+    // Chunks of other processes are never updated here: the calling thread copies them
+    for (int c = 0; c < network->chunkCount; c++) {
+        if (c >= network->chunkBegin && c < network->chunkEnd) continue;
+        const NetworkChunk *chunk = &network->chunks[c];
+        const int base = network->groupStart[chunk->group];
+        PopulationMoveRange(&moves[chunk->group], chunk->begin - base, chunk->end - base);
+    }
+
+    for (int g = 0; g < network->groupCount; g++) PopulationMoveEnd(network->groups[g], &moves[g]);
+    free(moves);
+    return true;
+}
+
+static bool NetworkPlaceSynapses(Network *network) {
+    // A rank delivering along the complete matrix shares it with the others: it stays put
+    if (network->distribution && network->synapseStart == network->distribution->synapseStart) return true;
+
+    const size_t rows  = (size_t)network->neuronCount * network->groupCount + 1;
+    const size_t count = (size_t)(network->synapseCount > 0 ? network->synapseCount : 1);
+    int *start    = (int*)MemoryAllocate(rows * sizeof(int), network->hugePages);
+    int *target   = (int*)MemoryAllocate(count * sizeof(int), network->hugePages);
+    float *weight = (float*)MemoryAllocate(count * sizeof(float), network->hugePages);
+    if (!start || !target || !weight) {
+        free(start);
+        free(target);
+        free(weight);
+        return false;
+    }
+
+    memcpy(start, network->synapseStart, rows * sizeof(int));
+    memcpy(target, network->synapseTarget, network->synapseCount * sizeof(int));
+    memcpy(weight, network->synapseWeight, network->synapseCount * sizeof(float));
+    free(network->synapseStart);
+    free(network->synapseTarget);
+    free(network->synapseWeight);
+    network->synapseStart  = start;
+    network->synapseTarget = target;
+    network->synapseWeight = weight;
+    return true;
+}
+
+// --- Public (API) Function Implementations ---
+
+Network *NetworkCreate(int neuronCount, const PopulationConfig *config, float dt, int threads) {
+    return NetworkCreateMixed(neuronCount, config, 1, NULL, dt, threads);
+}
+
+Network *NetworkCreateMixed(int neuronCount, const PopulationConfig *configs, int configCount,
+                            const int *configIndex, float dt, int threads) {
+    if (neuronCount <= 0 || !configs || configCount <= 0 || dt <= 0.0f) return NULL;
+    if ((long)neuronCount * configCount >= 0x7fffffffL) return NULL;
+
+    int *configSize  = (int*)calloc(configCount, sizeof(int));
+    int *configGroup = (int*)malloc(configCount * sizeof(int));
+    if (!configSize || !configGroup) {
+        free(configSize);
+        free(configGroup);
+        return NULL;
+    }
+    for (int i = 0; i < neuronCount; i++) {
+        const int c = configIndex ? configIndex[i] : 0;
+        if (c < 0 || c >= configCount) {
+            fprintf(stderr, "Error: neuron %d uses config %d of %d\n", i, c, configCount);
+            free(configSize);
+            free(configGroup);
+            return NULL;
+        }
+        configSize[c]++;
+    }
+
+    Network *network = (Network*)calloc(1, sizeof(Network));
+    if (!network) {
+        free(configSize);
+        free(configGroup);
+        return NULL;
+    }
+
+    network->neuronCount = neuronCount;
+    network->dt          = dt;
+    network->groups      = (Population**)calloc(configCount, sizeof(Population*));
+    network->groupStart  = (int*)calloc(configCount + 1, sizeof(int));
+    network->index       = (int*)malloc(neuronCount * sizeof(int));
+    network->order       = (int*)malloc(neuronCount * sizeof(int));
+    bool ok = network->groups && network->groupStart && network->index && network->order;
+
+    // 1. One group per used config, ordered by model so equal kernels run back to back
+    for (int model = 0; ok && model <= POPULATION_HODGKIN_HUXLEY; model++) {
+        for (int c = 0; c < configCount; c++) {
+            if ((int)configs[c].model != model || configSize[c] == 0) continue;
+
+            const int g = network->groupCount++;
+            configGroup[c]             = g;
+            network->groups[g]         = PopulationCreate(&configs[c], configSize[c], dt);
+            network->groupStart[g + 1] = network->groupStart[g] + configSize[c];
+            if (!network->groups[g]) ok = false;
+        }
+    }
+
+    // 2. Caller index <-> network order (stable within each group)
+    if (ok) {
+        int *cursor = configSize;
+        for (int g = 0; g < network->groupCount; g++) cursor[g] = network->groupStart[g];
+        for (int i = 0; i < neuronCount; i++) {
+            const int position = cursor[configGroup[configIndex ? configIndex[i] : 0]]++;
+            network->index[i]        = position;
+            network->order[position] = i;
+        }
+    }
+    free(configSize);
+    free(configGroup);
+
+    // 3. Chunks never span two groups
+    if (ok) {
+        for (int g = 0; g < network->groupCount; g++) {
+            const int size = network->groupStart[g + 1] - network->groupStart[g];
+            network->chunkCount += (size + NETWORK_CHUNK_SIZE - 1) / NETWORK_CHUNK_SIZE;
+        }
+        network->chunks     = (NetworkChunk*)calloc(network->chunkCount, sizeof(NetworkChunk));
+        network->chunkOrder = (int*)malloc(network->chunkCount * sizeof(int));
+        network->chunkEnd   = network->chunkCount;
+        ok = network->chunks && network->chunkOrder;
+    }
+
+    network->synapseStart = (int*)calloc((size_t)neuronCount * network->groupCount + 1, sizeof(int));
+    network->spikeBuffer  = (int*)malloc(neuronCount * sizeof(int));
+    network->spikes       = (int*)malloc(neuronCount * sizeof(int));
+    network->lastSpike    = (float*)malloc(neuronCount * sizeof(float));
+    network->period       = (float*)calloc(neuronCount, sizeof(float));
+    network->pool         = ParallelPoolCreate(threads);
+
+    if (!ok || !network->synapseStart || !network->spikeBuffer || !network->spikes || !network->lastSpike
+        || !network->period || !network->pool
+        || !PopulationSignalsInit(&network->signals, neuronCount, POPULATION_SIGNALS_DEFAULT_BIN,
+                                  POPULATION_SIGNALS_DEFAULT_CAPACITY)) {
+        NetworkFree(network);
+        return NULL;
+    }
+
+    int c = 0;
+    for (int g = 0; g < network->groupCount; g++) {
+        for (int begin = network->groupStart[g]; begin < network->groupStart[g + 1]; begin += NETWORK_CHUNK_SIZE, c++) {
+            network->chunks[c].group = g;
+            network->chunks[c].begin = begin;
+            network->chunks[c].end   = begin + NETWORK_CHUNK_SIZE < network->groupStart[g + 1]
+                                     ? begin + NETWORK_CHUNK_SIZE : network->groupStart[g + 1];
+        }
+    }
+    for (int i = 0; i < neuronCount; i++) network->lastSpike[i] = -1.0f;
+    NetworkEstimateCosts(network);
+    NetworkAssignChunks(network);
+
+    const int stride = (int)lroundf(POPULATION_SIGNALS_DEFAULT_BIN / (dt * POPULATION_SIGNALS_PHASE_SAMPLES));
+    network->phaseStride = stride > 0 ? stride : 1;
+
+    return network;
+}
+
+Population *NetworkNeuronPopulation(const Network *network, int neuron, int *local) {
+    if (!network || neuron < 0 || neuron >= network->neuronCount) return NULL;
+
+    const int position = network->index[neuron];
+    const int g = NetworkGroupOf(network, position);
+    if (local) *local = position - network->groupStart[g];
+    return network->groups[g];
+}
+
+bool NetworkConnect(Network *network, const int *sources, const int *targets, const float *weights, int count) {
+    if (!network || count < 0) return false;
+
+    const int n = network->neuronCount;
+    for (int k = 0; k < count; k++) {
+        if (sources[k] < 0 || sources[k] >= n || targets[k] < 0 || targets[k] >= n) {
+            fprintf(stderr, "Error: synapse %d (%d -> %d) is out of range\n", k, sources[k], targets[k]);
+            return false;
+        }
+    }
+
+    const int groups = network->groupCount;
+    const int rows   = n * groups;
+    const size_t size = (size_t)(count > 0 ? count : 1);
+    int *start    = (int*)calloc(rows + 1, sizeof(int));
+    int *target   = (int*)malloc(size * sizeof(int));
+    float *weight = (float*)malloc(size * sizeof(float));
+    int *row      = (int*)malloc(size * sizeof(int));
+    int *local    = (int*)malloc(size * sizeof(int));
+    if (!start || !target || !weight || !row || !local) {
+        free(start);
+        free(target);
+        free(weight);
+        free(row);
+        free(local);
+        return false;
+    }
+
+    // Row of each synapse: (source in network order, group of the target)
+    for (int k = 0; k < count; k++) {
+        const int position = network->index[targets[k]];
+        const int g = NetworkGroupOf(network, position);
+        row[k]   = network->index[sources[k]] * groups + g;
+        local[k] = position - network->groupStart[g];
+    }
+
+    // Counting sort by row: row sizes, prefix sum, then a stable scatter
+    for (int k = 0; k < count; k++) start[row[k] + 1]++;
+    for (int r = 0; r < rows; r++) start[r + 1] += start[r];
+    for (int k = 0; k < count; k++) {
+        const int slot = start[row[k]]++;
+        target[slot] = local[k];
+        weight[slot] = weights[k];
+    }
+    for (int r = rows; r > 0; r--) start[r] = start[r - 1];
+    start[0] = 0;
+    free(row);
+    free(local);
+
+    free(network->synapseStart);
+    free(network->synapseTarget);
+    free(network->synapseWeight);
+    network->synapseStart  = start;
+    network->synapseTarget = target;
+    network->synapseWeight = weight;
+    network->synapseCount  = count;
+
+    NetworkEstimateCosts(network);
+    NetworkAssignChunks(network);
+    return true;
+}
+
+bool NetworkStep(Network *network) {
+    network->samplePhase = (network->step % network->phaseStride) == 0;
+    network->sampleCost  = (network->step % NETWORK_COST_STRIDE) == 0;
+
+    int first[PARALLEL_MAX_THREADS + 1];
+    for (int t = 0; t <= network->homeCount; t++) first[t] = network->homeChunk[t] - network->chunkBegin;
+    ParallelPoolRunRanges(network->pool, first, network->homeCount, NetworkUpdateChunk, network);
+    if (network->sampleCost) NetworkUpdateCosts(network);
+    if (network->distribution && !NetworkExchangeSpikes(network)) return false;
+
+    // Reduce the chunk partials in a fixed order so results do not depend on the thread count
+    PopulationPartial total;
+    PopulationPartialClear(&total);
+    for (int c = 0; c < network->chunkCount; c++) {
+        PopulationPartialMerge(&total, &network->chunks[c].partial);
+    }
+
+    const double start = network->sampleCost ? NetworkCostClock() : 0.0;
+    NetworkDeliverSpikes(network);
+    if (network->sampleCost) {
+        network->deliveryCost += NETWORK_COST_SMOOTHING * (NetworkCostClock() - start - network->deliveryCost);
+    }
+
+    network->step++;
+    network->time += network->dt;
+    PopulationSignalsAccumulate(&network->signals, &total, network->dt);
+
+    // Costs only change the schedule, so rebalancing never changes results
+    if (network->step % NETWORK_REBALANCE_STEPS == 0) {
+        if (network->distribution && !NetworkRedistribute(network)) return false;
+        if (NetworkAssignChunks(network) && network->placed) NetworkPlaceState(network);
+    }
+    return true;
+}
+
+void NetworkRunChunks(Network *network, ParallelBody body, void *userData) {
+    ParallelPoolRunRanges(network->pool, network->homeChunk, network->homeCount, body, userData);
+}
+
+bool NetworkPlace(Network *network, bool hugePages) {
+    if (!network) return false;
+
+    const int rank = network->distribution ? network->distribution->rank : 0;
+    bool ok = ParallelPoolPin(network->pool, rank * ParallelPoolSize(network->pool));
+
+    network->placed    = true;
+    network->hugePages = hugePages;
+    if (!NetworkPlaceState(network)) {
+        fprintf(stderr, "Error: could not move the neuron state of the network\n");
+        ok = false;
+    }
+    if (!NetworkPlaceSynapses(network)) {
+        fprintf(stderr, "Error: could not move the synapses of the network\n");
+        ok = false;
+    }
+    return ok;
+}
+
+void NetworkFree(Network *network) {
+    if (!network) return;
+
+    NetworkJoin(network);
+
+    ParallelPoolDestroy(network->pool);
+    for (int g = 0; g < network->groupCount; g++) PopulationFree(network->groups[g]);
+    free(network->groups);
+    free(network->groupStart);
+    free(network->index);
+    free(network->order);
+    PopulationSignalsFree(&network->signals);
+    free(network->synapseStart);
+    free(network->synapseTarget);
+    free(network->synapseWeight);
+    free(network->chunks);
+    free(network->chunkOrder);
+    free(network->spikeBuffer);
+    free(network->spikes);
+    free(network->lastSpike);
+    free(network->period);
+    free(network);
+}
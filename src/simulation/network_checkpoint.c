@@ -0,0 +1,328 @@
+/**
+ * @file network_checkpoint.c
+ * @brief Implementation of network checkpoints.
+ *
+ * Saving streams the state group by group through one scratch buffer.
+ * Restoring checks the whole mapped file against the network first
+ * (sizes, groups, a valid numbering within the groups, synapse rows in
+ * range), allocates everything it needs, and only then copies the
+ * payloads in, so a rejected checkpoint leaves the network untouched.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "simulation/network_partition.h"
+#include "simulation/network_checkpoint.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Chunks of a network checkpoint (CKPT_TAG_NETWORK_META to CKPT_TAG_NETWORK_SPIKES). */
+#define NETWORK_CHECKPOINT_CHUNKS 10
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Returns the payload of a chunk if it has exactly 'size' bytes, else NULL.
+ */
+static const void *NetworkCheckpointChunk(const CheckpointMapping *mapping, CheckpointChunkTag tag, uint64_t size);
+
+/**
+ * @brief Checks that a saved numbering is a permutation that keeps every
+ * neuron in its group, and maps it back onto the network.
+ *
+ * @param savedIndex Receives caller index -> saved position.
+ * @param local Receives, for each position of the network, the saved
+ * position of its neuron relative to its group (a PopulationPermute
+ * destination per group).
+ * @return false if the numbering does not fit the network.
+ */
+static bool NetworkCheckpointMatchOrder(const Network *network, const int *savedOrder, int *savedIndex, int *local);
+
+/**
+ * @brief Checks that saved row offsets are monotone and every target lies in its group.
+ */
+static bool NetworkCheckpointValidSynapses(const Network *network, const int *start, const int *target, int synapseCount);
+
+// --- Private (static) Function Implementations ---
+
+static const void *NetworkCheckpointChunk(const CheckpointMapping *mapping, CheckpointChunkTag tag, uint64_t size) {
+    return (mapping->chunks[tag] && mapping->sizes[tag] == size) ? mapping->chunks[tag] : NULL;
+}
+
+static bool NetworkCheckpointMatchOrder(const Network *network, const int *savedOrder, int *savedIndex, int *local) {
+    const int n = network->neuronCount;
+    for (int c = 0; c < n; c++) savedIndex[c] = -1;
+    for (int p = 0; p < n; p++) {
+        const int c = savedOrder[p];
+        if (c < 0 || c >= n || savedIndex[c] >= 0) return false;
+        savedIndex[c] = p;
+    }
+
+    for (int g = 0; g < network->groupCount; g++) {
+        const int base = network->groupStart[g];
+        const int end  = network->groupStart[g + 1];
+        for (int p = base; p < end; p++) {
+            const int saved = savedIndex[network->order[p]];
+            if (saved < base || saved >= end) return false;
+            local[p] = saved - base;
+        }
+    }
+    return true;
+}
+
+static bool NetworkCheckpointValidSynapses(const Network *network, const int *start, const int *target, int synapseCount) {
+    const int groups = network->groupCount;
+    const int rows   = network->neuronCount * groups;
+    if (start[0] != 0 || start[rows] != synapseCount) return false;
+
+    for (int r = 0; r < rows; r++) {
+        if (start[r + 1] < start[r]) return false;
+        const int size = network->groupStart[r % groups + 1] - network->groupStart[r % groups];
+        for (int k = start[r]; k < start[r + 1]; k++) {
+            if (target[k] < 0 || target[k] >= size) return false;
+        }
+    }
+    return true;
+}
+
+// --- Public (API) Function Implementations ---
+
+bool NetworkCheckpointSave(const Network *network, const char *path) {
+    if (!network) return false;
+    if (network->distribution) {
+        fprintf(stderr, "Error: a distributed network cannot be checkpointed.\n");
+        return false;
+    }
+
+    const int n = network->neuronCount;
+    const int groups = network->groupCount;
+    const PopulationSignals *signals = &network->signals;
+
+    // 1. Scalars, group table and the scratch buffer of the largest group
+    const CheckpointNetworkMeta meta = {
+        .neuronCount    = n,
+        .groupCount     = groups,
+        .synapseCount   = network->synapseCount,
+        .spikeCount     = network->spikeCount,
+        .dt             = network->dt,
+        .signalCapacity = signals->capacity,
+        .step           = network->step,
+        .time           = network->time,
+        .binWidth       = signals->binWidth,
+        .signalTotal    = signals->total,
+        .binSteps       = signals->binSteps,
+        .syncSamples    = signals->syncSamples,
+        .binSpikes      = signals->binSpikes,
+        .binTime        = signals->binTime,
+        .lfpSum         = signals->lfpSum,
+        .syncSum        = signals->syncSum
+    };
+
+    CheckpointNetworkGroup *table = (CheckpointNetworkGroup*)calloc(groups, sizeof(CheckpointNetworkGroup));
+    if (!table) return false;
+
+    uint64_t stateBytes = 0;
+    size_t scratchBytes = 1;
+    for (int g = 0; g < groups; g++) {
+        const Population *pop = network->groups[g];
+        table[g].model      = (int32_t)pop->model;
+        table[g].count      = pop->count;
+        table[g].stateBytes = (int32_t)PopulationStateBytes(pop);
+        const size_t bytes = (size_t)pop->count * PopulationStateBytes(pop);
+        if (bytes > scratchBytes) scratchBytes = bytes;
+        stateBytes += bytes;
+    }
+
+    void *scratch = malloc(scratchBytes);
+    if (!scratch) {
+        free(table);
+        return false;
+    }
+
+    // 2. Write the chunks to a temporary file, then rename it into place
+    const uint64_t rows = (uint64_t)n * groups + 1;
+    const uint64_t synapses = (uint64_t)network->synapseCount;
+    const uint64_t bins = (uint64_t)signals->capacity * sizeof(float);
+
+    char tmpPath[1024];
+    FILE *file = CheckpointCreate(path, NETWORK_CHECKPOINT_CHUNKS, tmpPath, sizeof(tmpPath));
+    if (!file) {
+        free(table);
+        free(scratch);
+        return false;
+    }
+
+    bool ok = CheckpointWriteChunk(file, CKPT_TAG_NETWORK_META, &meta, sizeof(meta));
+    ok = ok && CheckpointWriteChunk(file, CKPT_TAG_NETWORK_GROUPS, table, (uint64_t)groups * sizeof(CheckpointNetworkGroup));
+    ok = ok && CheckpointWriteChunk(file, CKPT_TAG_NETWORK_ORDER, network->order, (uint64_t)n * sizeof(int));
+
+    ok = ok && CheckpointWriteChunkHeader(file, CKPT_TAG_NETWORK_STATE, stateBytes);
+    for (int g = 0; ok && g < groups; g++) {
+        const Population *pop = network->groups[g];
+        const size_t bytes = (size_t)pop->count * PopulationStateBytes(pop);
+        PopulationSaveState(pop, 0, pop->count, scratch);
+        if (bytes > 0) ok = (fwrite(scratch, bytes, 1, file) == 1);
+    }
+    ok = ok && CheckpointWritePadding(file, stateBytes);
+
+    ok = ok && CheckpointWriteChunkHeader(file, CKPT_TAG_NETWORK_SPIKE_TIMES, 2 * (uint64_t)n * sizeof(float));
+    ok = ok && (n == 0 || (fwrite(network->lastSpike, (size_t)n * sizeof(float), 1, file) == 1
+                        && fwrite(network->period, (size_t)n * sizeof(float), 1, file) == 1));
+    ok = ok && CheckpointWritePadding(file, 2 * (uint64_t)n * sizeof(float));
+
+    ok = ok && CheckpointWriteChunk(file, CKPT_TAG_NETWORK_SYNAPSE_START, network->synapseStart, rows * sizeof(int));
+    ok = ok && CheckpointWriteChunk(file, CKPT_TAG_NETWORK_SYNAPSE_TARGET, network->synapseTarget, synapses * sizeof(int));
+    ok = ok && CheckpointWriteChunk(file, CKPT_TAG_NETWORK_SYNAPSE_WEIGHT, network->synapseWeight, synapses * sizeof(float));
+
+    ok = ok && CheckpointWriteChunkHeader(file, CKPT_TAG_NETWORK_SIGNALS, 3 * bins);
+    ok = ok && (bins == 0 || (fwrite(signals->lfp, (size_t)bins, 1, file) == 1
+                           && fwrite(signals->rate, (size_t)bins, 1, file) == 1
+                           && fwrite(signals->synchrony, (size_t)bins, 1, file) == 1));
+    ok = ok && CheckpointWritePadding(file, 3 * bins);
+
+    ok = ok && CheckpointWriteChunk(file, CKPT_TAG_NETWORK_SPIKES, network->spikes, (uint64_t)network->spikeCount * sizeof(int));
+
+    free(table);
+    free(scratch);
+    return CheckpointCommit(file, tmpPath, path, ok);
+}
+
+bool NetworkCheckpointRestore(Network *network, const char *path) {
+    if (!network) return false;
+    if (network->distribution || network->placed) {
+        fprintf(stderr, "Error: restore a checkpoint before the network is distributed or placed.\n");
+        return false;
+    }
+
+    CheckpointMapping mapping;
+    if (!CheckpointMap(path, &mapping)) return false;
+
+    const int n = network->neuronCount;
+    const int groups = network->groupCount;
+    PopulationSignals *signals = &network->signals;
+
+    // 1. The sizes, groups and clock must be those of the network
+    const CheckpointNetworkMeta *meta = (const CheckpointNetworkMeta*)
+        NetworkCheckpointChunk(&mapping, CKPT_TAG_NETWORK_META, sizeof(CheckpointNetworkMeta));
+    const CheckpointNetworkGroup *table = (const CheckpointNetworkGroup*)
+        NetworkCheckpointChunk(&mapping, CKPT_TAG_NETWORK_GROUPS, (uint64_t)groups * sizeof(CheckpointNetworkGroup));
+
+    bool ok = meta && table
+           && meta->neuronCount == n && meta->groupCount == groups && meta->dt == network->dt
+           && meta->synapseCount >= 0 && meta->spikeCount >= 0 && meta->spikeCount <= n
+           && meta->signalCapacity == signals->capacity && meta->binWidth == signals->binWidth;
+
+    uint64_t stateBytes = 0;
+    size_t scratchBytes = 1;
+    for (int g = 0; ok && g < groups; g++) {
+        const Population *pop = network->groups[g];
+        ok = table[g].model == (int32_t)pop->model && table[g].count == pop->count
+          && table[g].stateBytes == (int32_t)PopulationStateBytes(pop);
+        const size_t bytes = PopulationPermuteBytes(pop);
+        if (bytes > scratchBytes) scratchBytes = bytes;
+        stateBytes += (uint64_t)pop->count * PopulationStateBytes(pop);
+    }
+
+    // 2. Every array must be present with the sizes the scalars imply
+    const uint64_t rows = (uint64_t)n * groups + 1;
+    const uint64_t synapses = ok ? (uint64_t)meta->synapseCount : 0;
+    const uint64_t bins = (uint64_t)signals->capacity * sizeof(float);
+
+    const int *savedOrder = NULL, *start = NULL, *target = NULL, *spikes = NULL;
+    const float *times = NULL, *weight = NULL, *rings = NULL;
+    const uint8_t *state = NULL;
+    if (ok) {
+        savedOrder = (const int*)NetworkCheckpointChunk(&mapping, CKPT_TAG_NETWORK_ORDER, (uint64_t)n * sizeof(int));
+        state      = (const uint8_t*)NetworkCheckpointChunk(&mapping, CKPT_TAG_NETWORK_STATE, stateBytes);
+        times      = (const float*)NetworkCheckpointChunk(&mapping, CKPT_TAG_NETWORK_SPIKE_TIMES, 2 * (uint64_t)n * sizeof(float));
+        start      = (const int*)NetworkCheckpointChunk(&mapping, CKPT_TAG_NETWORK_SYNAPSE_START, rows * sizeof(int));
+        target     = (const int*)NetworkCheckpointChunk(&mapping, CKPT_TAG_NETWORK_SYNAPSE_TARGET, synapses * sizeof(int));
+        weight     = (const float*)NetworkCheckpointChunk(&mapping, CKPT_TAG_NETWORK_SYNAPSE_WEIGHT, synapses * sizeof(float));
+        rings      = (const float*)NetworkCheckpointChunk(&mapping, CKPT_TAG_NETWORK_SIGNALS, 3 * bins);
+        spikes     = (const int*)NetworkCheckpointChunk(&mapping, CKPT_TAG_NETWORK_SPIKES, (uint64_t)meta->spikeCount * sizeof(int));
+        ok = savedOrder && state && times && start && target && weight && rings && spikes;
+    }
+
+    // 3. Allocate before the first change, then check the numbering and the rows
+    const size_t count = (size_t)(synapses > 0 ? synapses : 1);
+    int *savedIndex  = (int*)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *local       = (int*)malloc((n > 0 ? n : 1) * sizeof(int));
+    void *scratch    = malloc(scratchBytes);
+    int *newStart    = (int*)malloc(rows * sizeof(int));
+    int *newTarget   = (int*)malloc(count * sizeof(int));
+    float *newWeight = (float*)malloc(count * sizeof(float));
+    if (!savedIndex || !local || !scratch || !newStart || !newTarget || !newWeight) ok = false;
+
+    ok = ok && NetworkCheckpointMatchOrder(network, savedOrder, savedIndex, local)
+            && NetworkCheckpointValidSynapses(network, start, target, meta->synapseCount);
+    for (int k = 0; ok && k < meta->spikeCount; k++) ok = spikes[k] >= 0 && spikes[k] < n;
+
+    if (!ok) {
+        free(savedIndex);
+        free(local);
+        free(scratch);
+        free(newStart);
+        free(newTarget);
+        free(newWeight);
+        CheckpointUnmap(&mapping);
+        fprintf(stderr, "Error: checkpoint '%s' does not match the network.\n", path);
+        return false;
+    }
+
+    // 4. Renumber the groups like the saved network (so the parameters follow), then load the state
+    const uint8_t *cursor = state;
+    for (int g = 0; g < groups; g++) {
+        Population *pop = network->groups[g];
+        const int base = network->groupStart[g];
+        bool moved = false;
+        for (int p = base; p < network->groupStart[g + 1]; p++) moved = moved || (local[p] != p - base);
+        if (moved) PopulationPermute(pop, local + base, scratch);
+
+        PopulationLoadState(pop, 0, pop->count, cursor);
+        cursor += (size_t)pop->count * PopulationStateBytes(pop);
+    }
+
+    for (int p = 0; p < n; p++) {
+        network->order[p] = savedOrder[p];
+        network->index[savedOrder[p]] = p;
+    }
+    memcpy(network->lastSpike, times, (size_t)n * sizeof(float));
+    memcpy(network->period, times + n, (size_t)n * sizeof(float));
+
+    // 5. Synapses, clock, last spikes and signals
+    memcpy(newStart, start, (size_t)rows * sizeof(int));
+    memcpy(newTarget, target, (size_t)synapses * sizeof(int));
+    memcpy(newWeight, weight, (size_t)synapses * sizeof(float));
+    free(network->synapseStart);
+    free(network->synapseTarget);
+    free(network->synapseWeight);
+    network->synapseStart  = newStart;
+    network->synapseTarget = newTarget;
+    network->synapseWeight = newWeight;
+    network->synapseCount  = meta->synapseCount;
+
+    network->step = (long)meta->step;
+    network->time = meta->time;
+    memcpy(network->spikes, spikes, (size_t)meta->spikeCount * sizeof(int));
+    network->spikeCount = meta->spikeCount;
+
+    memcpy(signals->lfp, rings, (size_t)bins);
+    memcpy(signals->rate, rings + signals->capacity, (size_t)bins);
+    memcpy(signals->synchrony, rings + 2 * (size_t)signals->capacity, (size_t)bins);
+    signals->total       = meta->signalTotal;
+    signals->binTime     = meta->binTime;
+    signals->lfpSum      = meta->lfpSum;
+    signals->binSteps    = meta->binSteps;
+    signals->binSpikes   = meta->binSpikes;
+    signals->syncSum     = meta->syncSum;
+    signals->syncSamples = meta->syncSamples;
+
+    free(savedIndex);
+    free(local);
+    free(scratch);
+    CheckpointUnmap(&mapping);
+
+    NetworkEstimateCosts(network);
+    network->homeCount = 0;
+    NetworkAssignChunks(network);
+    return true;
+}
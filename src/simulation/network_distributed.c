@@ -0,0 +1,354 @@
+/**
+ * @file network_distributed.c
+ * @brief Implementation of multi-process network runs.
+ *
+ * The block a rank publishes each step is, for each of its chunks, an
+ * ExchangeChunk header followed by the chunk's spikes (network order).
+ * The block of a migration is, for each chunk leaving the rank, the chunk
+ * index followed by the neuron state (PopulationSaveState).
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "simulation/network_distributed.h"
+#include "simulation/network_partition.h"
+#include "utils/memory.h"
+
+// --- Internal Module Constants ---
+
+/**
+ * @struct ExchangeChunk
+ * @brief Header of one chunk inside an exchanged block (copied with memcpy,
+ * so blocks need no alignment).
+ */
+typedef struct {
+    int chunk;
+    int spikeCount;
+    double cost;
+    PopulationPartial partial;
+} ExchangeChunk;
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Largest block any rank can publish, spikes or migration, whatever
+ * chunks it owns.
+ */
+static size_t NetworkBlockBytes(const Network *network);
+
+/**
+ * @brief Replaces the synapses of the network with the rows of the
+ * complete matrix onto this rank's chunks, keeping their order.
+ * @return false on allocation failure (the network then delivers along
+ * the complete matrix, which only costs deliveries to neurons this rank
+ * does not update).
+ */
+static bool NetworkKeepOwnSynapses(Network *network);
+
+/**
+ * @brief Frees the synapses of the network unless they are the complete matrix.
+ */
+static void NetworkReleaseOwnSynapses(Network *network);
+
+// --- Private (static) Function Implementations ---
+
+static size_t NetworkBlockBytes(const Network *network) {
+    size_t spikes = 0, states = 0;
+    for (int c = 0; c < network->chunkCount; c++) {
+        const NetworkChunk *chunk = &network->chunks[c];
+        const size_t neurons = (size_t)(chunk->end - chunk->begin);
+        spikes += sizeof(ExchangeChunk) + neurons * sizeof(int);
+        states += sizeof(int) + neurons * PopulationStateBytes(network->groups[chunk->group]);
+    }
+    return spikes > states ? spikes : states;
+}
+
+static bool NetworkKeepOwnSynapses(Network *network) {
+    const NetworkDistribution *distribution = network->distribution;
+    const int *fullStart    = distribution->synapseStart;
+    const int *fullTarget   = distribution->synapseTarget;
+    const float *fullWeight = distribution->synapseWeight;
+
+    const int groups = network->groupCount;
+    const int rows = network->neuronCount * groups;
+    const int ownBegin = network->chunks[network->chunkBegin].begin;
+    const int ownEnd   = network->chunks[network->chunkEnd - 1].end;
+
+    int kept = 0;
+    for (int r = 0; r < rows; r++) {
+        const int base = network->groupStart[r % groups];
+        for (int k = fullStart[r]; k < fullStart[r + 1]; k++) {
+            const int position = base + fullTarget[k];
+            if (position >= ownBegin && position < ownEnd) kept++;
+        }
+    }
+
+    int *start    = (int*)MemoryAllocate(((size_t)rows + 1) * sizeof(int), network->hugePages);
+    int *target   = (int*)MemoryAllocate((kept > 0 ? kept : 1) * sizeof(int), network->hugePages);
+    float *weight = (float*)MemoryAllocate((kept > 0 ? kept : 1) * sizeof(float), network->hugePages);
+    if (!start || !target || !weight) {
+        free(start);
+        free(target);
+        free(weight);
+        NetworkReleaseOwnSynapses(network);
+        network->synapseStart  = distribution->synapseStart;
+        network->synapseTarget = distribution->synapseTarget;
+        network->synapseWeight = distribution->synapseWeight;
+        network->synapseCount  = distribution->synapseCount;
+        return false;
+    }
+
+    int next = 0;
+    for (int r = 0; r < rows; r++) {
+        const int base = network->groupStart[r % groups];
+        start[r] = next;
+        for (int k = fullStart[r]; k < fullStart[r + 1]; k++) {
+            const int position = base + fullTarget[k];
+            if (position < ownBegin || position >= ownEnd) continue;
+            target[next] = fullTarget[k];
+            weight[next] = fullWeight[k];
+            next++;
+        }
+    }
+    start[rows] = next;
+
+    NetworkReleaseOwnSynapses(network);
+    network->synapseStart  = start;
+    network->synapseTarget = target;
+    network->synapseWeight = weight;
+    network->synapseCount  = kept;
+    return true;
+}
+
+static void NetworkReleaseOwnSynapses(Network *network) {
+    if (network->synapseStart == network->distribution->synapseStart) return;
+    free(network->synapseStart);
+    free(network->synapseTarget);
+    free(network->synapseWeight);
+}
+
+// --- Public (API) Function Implementations ---
+
+int NetworkDistribute(Network *network, int processes, int threads) {
+    if (!network || network->distribution || processes < 1) return -1;
+    if (processes == 1) return 0;
+    if (processes > NETWORK_MAX_PROCESSES || processes > network->chunkCount) {
+        fprintf(stderr, "Error: cannot split %d chunks across %d processes\n", network->chunkCount, processes);
+        return -1;
+    }
+
+    const size_t capacity = NetworkBlockBytes(network);
+    NetworkDistribution *distribution = (NetworkDistribution*)calloc(1, sizeof(NetworkDistribution));
+    SpikeTransport *transport = SpikeTransportShmCreate(processes, capacity);
+    unsigned char *block = (unsigned char*)malloc(capacity);
+    int *processIds = (int*)calloc(processes, sizeof(int));
+    if (!distribution || !transport || !block || !processIds) {
+        free(distribution);
+        SpikeTransportFree(transport);
+        free(block);
+        free(processIds);
+        return -1;
+    }
+    NetworkPartitionChunks(network, 0, network->chunkCount, processes, distribution->firstChunk);
+
+    // Threads do not survive fork: every rank starts its own pool afterwards
+    ParallelPoolDestroy(network->pool);
+    network->pool = NULL;
+    fflush(NULL);
+
+    int rank = 0;
+    for (int r = 1; r < processes; r++) {
+        const pid_t pid = fork();
+        if (pid == 0) {
+            rank = r;
+            break;
+        }
+        if (pid < 0) {
+            fprintf(stderr, "Error: could not start process %d of %d\n", r, processes);
+            for (int k = 1; k < r; k++) {
+                kill((pid_t)processIds[k], SIGKILL);
+                waitpid((pid_t)processIds[k], NULL, 0);
+            }
+            free(distribution);
+            SpikeTransportFree(transport);
+            free(block);
+            free(processIds);
+            network->pool = ParallelPoolCreate(threads);
+            return -1;
+        }
+        processIds[r] = (int)pid;
+        SpikeTransportShmSetProcess(transport, r, (int)pid);
+    }
+
+    // The complete matrix stays shared copy-on-write with the other ranks: it is never written
+    transport->rank                = rank;
+    distribution->transport        = transport;
+    distribution->block            = block;
+    distribution->rank             = rank;
+    distribution->processCount     = processes;
+    distribution->synapseCount     = network->synapseCount;
+    distribution->synapseStart     = network->synapseStart;
+    distribution->synapseTarget    = network->synapseTarget;
+    distribution->synapseWeight    = network->synapseWeight;
+    if (rank == 0) {
+        distribution->processIds = processIds;
+    } else {
+        free(processIds);
+    }
+
+    network->distribution = distribution;
+    network->chunkBegin   = distribution->firstChunk[rank];
+    network->chunkEnd     = distribution->firstChunk[rank + 1];
+
+    network->pool = ParallelPoolCreate(threads);
+    NetworkAssignChunks(network);
+    if (!NetworkKeepOwnSynapses(network)) {
+        fprintf(stderr, "Warning: rank %d keeps every synapse (out of memory)\n", rank);
+    }
+    return rank;
+}
+
+bool NetworkJoin(Network *network) {
+    if (!network || !network->distribution) return true;
+
+    // Releases ranks still waiting for an exchange if this one stopped early
+    NetworkDistribution *distribution = network->distribution;
+    SpikeTransportAbort(distribution->transport);
+
+    bool ok = true;
+    for (int r = 1; distribution->rank == 0 && r < distribution->processCount; r++) {
+        int status = 0;
+        if (waitpid((pid_t)distribution->processIds[r], &status, 0) < 0 || !WIFEXITED(status)
+            || WEXITSTATUS(status) != 0) {
+            fprintf(stderr, "Error: process %d of the network did not exit cleanly\n", r);
+            ok = false;
+        }
+    }
+
+    NetworkReleaseOwnSynapses(network);
+    network->synapseStart  = distribution->synapseStart;
+    network->synapseTarget = distribution->synapseTarget;
+    network->synapseWeight = distribution->synapseWeight;
+    network->synapseCount  = distribution->synapseCount;
+
+    SpikeTransportFree(distribution->transport);
+    free(distribution->block);
+    free(distribution->processIds);
+    free(distribution);
+    network->distribution = NULL;
+    return ok;
+}
+
+bool NetworkExchangeSpikes(Network *network) {
+    NetworkDistribution *distribution = network->distribution;
+    unsigned char *block = distribution->block;
+
+    size_t bytes = 0;
+    for (int c = network->chunkBegin; c < network->chunkEnd; c++) {
+        const NetworkChunk *chunk = &network->chunks[c];
+        const ExchangeChunk header = { c, chunk->spikeCount, chunk->cost, chunk->partial };
+
+        memcpy(block + bytes, &header, sizeof(header));
+        bytes += sizeof(header);
+        memcpy(block + bytes, network->spikeBuffer + chunk->begin, chunk->spikeCount * sizeof(int));
+        bytes += chunk->spikeCount * sizeof(int);
+    }
+
+    const unsigned char *blocks[NETWORK_MAX_PROCESSES];
+    size_t sizes[NETWORK_MAX_PROCESSES];
+    if (!SpikeTransportAllGather(distribution->transport, block, bytes, blocks, sizes)) return false;
+
+    // Foreign chunks: spikes, observables and spike times, exactly as their owners computed them
+    const float now = (float)(network->time + network->dt);
+    for (int r = 0; r < distribution->processCount; r++) {
+        if (r == distribution->rank) continue;
+
+        for (size_t offset = 0; offset < sizes[r]; ) {
+            ExchangeChunk header;
+            memcpy(&header, blocks[r] + offset, sizeof(header));
+            offset += sizeof(header);
+
+            NetworkChunk *chunk = &network->chunks[header.chunk];
+            int *spikes = network->spikeBuffer + chunk->begin;
+            memcpy(spikes, blocks[r] + offset, header.spikeCount * sizeof(int));
+            offset += header.spikeCount * sizeof(int);
+            chunk->spikeCount = header.spikeCount;
+            chunk->partial    = header.partial;
+            chunk->cost       = header.cost;
+
+            for (int s = 0; s < header.spikeCount; s++) {
+                const int i = spikes[s];
+                if (network->lastSpike[i] >= 0.0f) network->period[i] = now - network->lastSpike[i];
+                network->lastSpike[i] = now;
+            }
+        }
+    }
+    return true;
+}
+
+bool NetworkRedistribute(Network *network) {
+    NetworkDistribution *distribution = network->distribution;
+    const int processes = distribution->processCount;
+    const int *current  = distribution->firstChunk;
+
+    // Every rank holds the same costs, so every rank takes the same decision
+    int next[NETWORK_MAX_PROCESSES + 1];
+    NetworkPartitionChunks(network, 0, network->chunkCount, processes, next);
+    if (!NetworkSplitImproves(network, current, next, processes)) return true;
+
+    // 1. Publish the state of the chunks leaving this rank
+    const int rank     = distribution->rank;
+    const int newBegin = next[rank];
+    const int newEnd   = next[rank + 1];
+    unsigned char *block = distribution->block;
+    size_t bytes = 0;
+    for (int c = network->chunkBegin; c < network->chunkEnd; c++) {
+        if (c >= newBegin && c < newEnd) continue;
+
+        const NetworkChunk *chunk = &network->chunks[c];
+        const Population *pop = network->groups[chunk->group];
+        const int base = network->groupStart[chunk->group];
+        memcpy(block + bytes, &c, sizeof(int));
+        bytes += sizeof(int);
+        PopulationSaveState(pop, chunk->begin - base, chunk->end - base, block + bytes);
+        bytes += (size_t)(chunk->end - chunk->begin) * PopulationStateBytes(pop);
+    }
+
+    const unsigned char *blocks[NETWORK_MAX_PROCESSES];
+    size_t sizes[NETWORK_MAX_PROCESSES];
+    if (!SpikeTransportAllGather(distribution->transport, block, bytes, blocks, sizes)) return false;
+
+    // 2. Take over the chunks arriving here
+    for (int r = 0; r < processes; r++) {
+        if (r == rank) continue;
+
+        for (size_t offset = 0; offset < sizes[r]; ) {
+            int c;
+            memcpy(&c, blocks[r] + offset, sizeof(int));
+            offset += sizeof(int);
+
+            const NetworkChunk *chunk = &network->chunks[c];
+            Population *pop = network->groups[chunk->group];
+            const int base = network->groupStart[chunk->group];
+            if (c >= newBegin && c < newEnd) {
+                PopulationLoadState(pop, chunk->begin - base, chunk->end - base, blocks[r] + offset);
+            }
+            offset += (size_t)(chunk->end - chunk->begin) * PopulationStateBytes(pop);
+        }
+    }
+
+    memcpy(distribution->firstChunk, next, (processes + 1) * sizeof(int));
+    distribution->migrations++;
+    network->chunkBegin = newBegin;
+    network->chunkEnd   = newEnd;
+    if (!NetworkKeepOwnSynapses(network)) {
+        fprintf(stderr, "Warning: rank %d keeps every synapse (out of memory)\n", rank);
+    }
+    return true;
+}
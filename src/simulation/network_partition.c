@@ -0,0 +1,181 @@
+/**
+ * @file network_partition.c
+ * @brief Implementation of the chunk cost model and partitioning.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "simulation/network_partition.h"
+
+// --- Internal Module Constants ---
+
+const double NETWORK_MODEL_COST[POPULATION_HODGKIN_HUXLEY + 1] = {
+    [POPULATION_IZHIKEVICH]      = 6.0,
+    [POPULATION_LIF]             = 8.0,
+    [POPULATION_ADEX]            = 12.0,
+    [POPULATION_HODGKIN_HUXLEY]  = 375.0
+};
+
+/** @brief Estimated cost of delivering one synaptic event (ns). */
+#define NETWORK_EVENT_COST 2.0
+
+/** @brief Firing rate assumed by the estimate (Hz). */
+#define NETWORK_ASSUMED_RATE 10.0
+
+/** @brief Bisection steps of the partition bound (relative precision 2^-40). */
+#define PARTITION_ITERATIONS 40
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Greedily splits the costs into ranges of total at most 'bound'.
+ * @return Number of ranges needed.
+ */
+static int PartitionCount(const Network *network, int begin, int end, double bound);
+
+/**
+ * @brief Largest total cost among the ranges [firstChunk[p], firstChunk[p + 1]).
+ */
+static double PartitionLargest(const Network *network, const int *firstChunk, int parts);
+
+// --- Private (static) Function Implementations ---
+
+static int PartitionCount(const Network *network, int begin, int end, double bound) {
+    int parts = 1;
+    double sum = 0.0;
+    for (int c = begin; c < end; c++) {
+        const double cost = network->chunks[c].cost;
+        if (sum + cost > bound && sum > 0.0) {
+            parts++;
+            sum = 0.0;
+        }
+        sum += cost;
+    }
+    return parts;
+}
+
+static double PartitionLargest(const Network *network, const int *firstChunk, int parts) {
+    double largest = 0.0;
+    for (int p = 0; p < parts; p++) {
+        double cost = 0.0;
+        for (int c = firstChunk[p]; c < firstChunk[p + 1]; c++) cost += network->chunks[c].cost;
+        if (cost > largest) largest = cost;
+    }
+    return largest;
+}
+
+// --- Public (API) Function Implementations ---
+
+double NetworkCostClock(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}
+
+void NetworkEstimateCosts(Network *network) {
+    const int groups = network->groupCount;
+    for (int c = 0; c < network->chunkCount; c++) network->chunks[c].synapses = 0;
+
+    // Chunks start at their group's first neuron and are NETWORK_CHUNK_SIZE long
+    int *firstChunk = (int*)malloc(groups * sizeof(int));
+    if (firstChunk) {
+        for (int c = network->chunkCount - 1; c >= 0; c--) firstChunk[network->chunks[c].group] = c;
+
+        const int rows = network->neuronCount * groups;
+        for (int r = 0; r < rows; r++) {
+            const int first = firstChunk[r % groups];
+            for (int k = network->synapseStart[r]; k < network->synapseStart[r + 1]; k++) {
+                network->chunks[first + network->synapseTarget[k] / NETWORK_CHUNK_SIZE].synapses++;
+            }
+        }
+        free(firstChunk);
+    }
+
+    const double events = NETWORK_ASSUMED_RATE * network->dt * 1e-3;
+    for (int c = 0; c < network->chunkCount; c++) {
+        NetworkChunk *chunk = &network->chunks[c];
+        const PopulationModel model = network->groups[chunk->group]->model;
+        chunk->cost = NETWORK_MODEL_COST[model] * (chunk->end - chunk->begin)
+                    + NETWORK_EVENT_COST * events * chunk->synapses;
+    }
+}
+
+void NetworkUpdateCosts(Network *network) {
+    long synapses = 0;
+    for (int c = network->chunkBegin; c < network->chunkEnd; c++) synapses += network->chunks[c].synapses;
+
+    for (int c = network->chunkBegin; c < network->chunkEnd; c++) {
+        NetworkChunk *chunk = &network->chunks[c];
+        double sample = chunk->sampled;
+        if (synapses > 0) sample += network->deliveryCost * chunk->synapses / synapses;
+        chunk->cost += NETWORK_COST_SMOOTHING * (sample - chunk->cost);
+    }
+}
+
+void NetworkPartitionChunks(const Network *network, int begin, int end, int parts, int *firstChunk) {
+    // Smallest feasible bound on the largest range, by bisection
+    double low = 0.0, high = 0.0;
+    for (int c = begin; c < end; c++) {
+        const double cost = network->chunks[c].cost;
+        if (cost > low) low = cost;
+        high += cost;
+    }
+    for (int i = 0; i < PARTITION_ITERATIONS && low < high; i++) {
+        const double middle = 0.5 * (low + high);
+        if (PartitionCount(network, begin, end, middle) <= parts) {
+            high = middle;
+        } else {
+            low = middle;
+        }
+    }
+
+    // Greedy ranges under that bound, leaving at least one chunk for each remaining range
+    firstChunk[0] = begin;
+    int c = begin;
+    for (int p = 1; p < parts; p++) {
+        double sum = network->chunks[c++].cost;
+        while (c < end - (parts - p) && sum + network->chunks[c].cost <= high) sum += network->chunks[c++].cost;
+        firstChunk[p] = c;
+    }
+    firstChunk[parts] = end;
+}
+
+bool NetworkSplitImproves(const Network *network, const int *current, const int *next, int parts) {
+    return PartitionLargest(network, next, parts)
+         < PartitionLargest(network, current, parts) * (1.0 - NETWORK_REBALANCE_GAIN);
+}
+
+bool NetworkAssignChunks(Network *network) {
+    int threads = ParallelPoolSize(network->pool);
+    if (threads > network->chunkEnd - network->chunkBegin) threads = network->chunkEnd - network->chunkBegin;
+
+    int next[PARALLEL_MAX_THREADS + 1];
+    NetworkPartitionChunks(network, network->chunkBegin, network->chunkEnd, threads, next);
+
+    // Moving homes costs cache contents (and placed memory): only for a clear gain
+    const bool valid = network->homeCount == threads && network->homeChunk[0] == network->chunkBegin
+                    && network->homeChunk[threads] == network->chunkEnd;
+    const bool changed = !valid || NetworkSplitImproves(network, network->homeChunk, next, threads);
+    if (changed) {
+        memcpy(network->homeChunk, next, (threads + 1) * sizeof(int));
+        network->homeCount = threads;
+    }
+
+    // Insertion sort of each home, stable: ties keep network order
+    for (int t = 0; t < network->homeCount; t++) {
+        int *order = network->chunkOrder + (network->homeChunk[t] - network->chunkBegin);
+        int count = 0;
+        for (int c = network->homeChunk[t]; c < network->homeChunk[t + 1]; c++) {
+            const double cost = network->chunks[c].cost;
+            int k = count++;
+            while (k > 0 && network->chunks[order[k - 1]].cost < cost) {
+                order[k] = order[k - 1];
+                k--;
+            }
+            order[k] = c;
+        }
+    }
+    return changed;
+}
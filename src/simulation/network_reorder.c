@@ -0,0 +1,377 @@
+/**
+ * @file network_reorder.c
+ * @brief Implementation of the locality passes (row sorting and RCM).
+ */
+#include <stdlib.h>
+#include "simulation/network_reorder.h"
+#include "simulation/network_partition.h"
+
+// --- Internal Module Constants ---
+
+const char *const NETWORK_REORDER_NAMES[] = { "none", "sort", "rcm" };
+
+/**
+ * @struct ReorderSynapse
+ * @brief One synapse of a row being sorted; 'slot' keeps the sort stable.
+ */
+typedef struct {
+    int target;
+    int slot;
+    float weight;
+} ReorderSynapse;
+
+/**
+ * @struct ReorderGraph
+ * @brief Undirected adjacency of the neurons (network positions), compressed rows.
+ */
+typedef struct {
+    int count;
+    int *start;                   ///< count + 1 offsets
+    int *neighbor;
+} ReorderGraph;
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief qsort comparator: by degree (REORDER_DEGREE), then by position.
+ */
+static int ReorderCompareNeighbors(const void *a, const void *b);
+
+/**
+ * @brief qsort comparator: by target, then by original slot.
+ */
+static int ReorderCompareSynapses(const void *a, const void *b);
+
+/**
+ * @brief Returns the length of the longest synapse row.
+ */
+static int ReorderLongestRow(const Network *network);
+
+/**
+ * @brief Sorts every synapse row by target (stable).
+ * @param row Scratch of ReorderLongestRow entries.
+ */
+static void ReorderSortRows(Network *network, ReorderSynapse *row);
+
+/**
+ * @brief Builds the undirected graph of the synapses (both directions,
+ * without self-connections).
+ * @return false on allocation failure.
+ */
+static bool ReorderBuildGraph(const Network *network, ReorderGraph *graph);
+
+/**
+ * @brief Computes the Reverse Cuthill-McKee order of a graph.
+ * @param order Output: the positions in RCM order.
+ * @return false on allocation failure.
+ */
+static bool ReorderCuthillMcKee(const ReorderGraph *graph, int *order);
+
+/**
+ * @brief Moves every neuron from network position p to destination[p]
+ * (destination keeps each neuron inside its group).
+ * @return false on allocation failure (the network is unchanged).
+ */
+static bool ReorderApply(Network *network, const int *destination);
+
+/** @brief Degrees seen by ReorderCompareNeighbors (qsort takes no context). */
+static const int *REORDER_DEGREE;
+
+// --- Private (static) Function Implementations ---
+
+static int ReorderCompareNeighbors(const void *a, const void *b) {
+    const int x = *(const int*)a, y = *(const int*)b;
+    if (REORDER_DEGREE[x] != REORDER_DEGREE[y]) return REORDER_DEGREE[x] < REORDER_DEGREE[y] ? -1 : 1;
+    return (x > y) - (x < y);
+}
+
+static int ReorderCompareSynapses(const void *a, const void *b) {
+    const ReorderSynapse *x = (const ReorderSynapse*)a;
+    const ReorderSynapse *y = (const ReorderSynapse*)b;
+    if (x->target != y->target) return x->target < y->target ? -1 : 1;
+    return (x->slot > y->slot) - (x->slot < y->slot);
+}
+
+static int ReorderLongestRow(const Network *network) {
+    const int rows = network->neuronCount * network->groupCount;
+
+    int longest = 0;
+    for (int r = 0; r < rows; r++) {
+        const int length = network->synapseStart[r + 1] - network->synapseStart[r];
+        if (length > longest) longest = length;
+    }
+    return longest;
+}
+
+static void ReorderSortRows(Network *network, ReorderSynapse *row) {
+    const int rows = network->neuronCount * network->groupCount;
+
+    for (int r = 0; r < rows; r++) {
+        const int first = network->synapseStart[r];
+        const int length = network->synapseStart[r + 1] - first;
+
+        bool sorted = true;
+        for (int k = 1; k < length && sorted; k++) {
+            sorted = network->synapseTarget[first + k - 1] <= network->synapseTarget[first + k];
+        }
+        if (sorted) continue;
+
+        for (int k = 0; k < length; k++) {
+            row[k] = (ReorderSynapse){ network->synapseTarget[first + k], k, network->synapseWeight[first + k] };
+        }
+        qsort(row, length, sizeof(ReorderSynapse), ReorderCompareSynapses);
+        for (int k = 0; k < length; k++) {
+            network->synapseTarget[first + k] = row[k].target;
+            network->synapseWeight[first + k] = row[k].weight;
+        }
+    }
+}
+
+static bool ReorderBuildGraph(const Network *network, ReorderGraph *graph) {
+    const int n = network->neuronCount;
+    const int groups = network->groupCount;
+
+    graph->count    = n;
+    graph->start    = (int*)calloc((size_t)n + 1, sizeof(int));
+    graph->neighbor = (int*)malloc(((size_t)network->synapseCount * 2 + 1) * sizeof(int));
+    if (!graph->start || !graph->neighbor) {
+        free(graph->start);
+        free(graph->neighbor);
+        return false;
+    }
+
+    // Two passes over the synapses: degrees, then a scatter into the rows
+    for (int pass = 0; pass < 2; pass++) {
+        for (int source = 0; source < n; source++) {
+            const int *row = network->synapseStart + (size_t)source * groups;
+            for (int g = 0; g < groups; g++) {
+                for (int k = row[g]; k < row[g + 1]; k++) {
+                    const int target = network->groupStart[g] + network->synapseTarget[k];
+                    if (target == source) continue;
+                    if (pass == 0) {
+                        graph->start[source + 1]++;
+                        graph->start[target + 1]++;
+                    } else {
+                        graph->neighbor[graph->start[source]++] = target;
+                        graph->neighbor[graph->start[target]++] = source;
+                    }
+                }
+            }
+        }
+        if (pass == 0) {
+            for (int i = 0; i < n; i++) graph->start[i + 1] += graph->start[i];
+        } else {
+            for (int i = n; i > 0; i--) graph->start[i] = graph->start[i - 1];
+            graph->start[0] = 0;
+        }
+    }
+    return true;
+}
+
+static bool ReorderCuthillMcKee(const ReorderGraph *graph, int *order) {
+    const int n = graph->count;
+    int *degree    = (int*)malloc(n * sizeof(int));
+    int *byDegree  = (int*)malloc(n * sizeof(int));
+    bool *visited  = (bool*)calloc(n, sizeof(bool));
+    if (!degree || !byDegree || !visited) {
+        free(degree);
+        free(byDegree);
+        free(visited);
+        return false;
+    }
+
+    for (int i = 0; i < n; i++) {
+        degree[i]   = graph->start[i + 1] - graph->start[i];
+        byDegree[i] = i;
+    }
+    REORDER_DEGREE = degree;
+    qsort(byDegree, n, sizeof(int), ReorderCompareNeighbors);
+
+    // Breadth-first from a minimum-degree neuron of each component, neighbors by increasing degree
+    int tail = 0;
+    for (int s = 0; s < n; s++) {
+        if (visited[byDegree[s]]) continue;
+
+        int head = tail;
+        order[tail++] = byDegree[s];
+        visited[byDegree[s]] = true;
+        while (head < tail) {
+            const int node = order[head++];
+            const int first = tail;
+            for (int k = graph->start[node]; k < graph->start[node + 1]; k++) {
+                const int next = graph->neighbor[k];
+                if (visited[next]) continue;
+                visited[next] = true;
+                order[tail++] = next;
+            }
+            qsort(order + first, tail - first, sizeof(int), ReorderCompareNeighbors);
+        }
+    }
+    REORDER_DEGREE = NULL;
+
+    // Reversing the Cuthill-McKee order never widens the profile (George, 1971)
+    for (int i = 0; i < n / 2; i++) {
+        const int tmp = order[i];
+        order[i] = order[n - 1 - i];
+        order[n - 1 - i] = tmp;
+    }
+
+    free(degree);
+    free(byDegree);
+    free(visited);
+    return true;
+}
+
+static bool ReorderApply(Network *network, const int *destination) {
+    const int n = network->neuronCount;
+    const int groups = network->groupCount;
+    const int rows = n * groups;
+
+    size_t scratchBytes = 1;
+    for (int g = 0; g < groups; g++) {
+        const size_t bytes = PopulationPermuteBytes(network->groups[g]);
+        if (bytes > scratchBytes) scratchBytes = bytes;
+    }
+
+    // Everything is allocated before the first change, so a failure leaves the network intact
+    void *scratch  = malloc(scratchBytes);
+    int *local     = (int*)malloc(n * sizeof(int));
+    int *order     = (int*)malloc(n * sizeof(int));
+    float *times   = (float*)malloc(2 * (size_t)n * sizeof(float));
+    int *start     = (int*)calloc((size_t)rows + 1, sizeof(int));
+    int *target    = (int*)malloc(((size_t)network->synapseCount + 1) * sizeof(int));
+    float *weight  = (float*)malloc(((size_t)network->synapseCount + 1) * sizeof(float));
+    if (!scratch || !local || !order || !times || !start || !target || !weight) {
+        free(scratch);
+        free(local);
+        free(order);
+        free(times);
+        free(start);
+        free(target);
+        free(weight);
+        return false;
+    }
+
+    // 1. Neuron state, group by group (local destinations)
+    for (int g = 0; g < groups; g++) {
+        const int base = network->groupStart[g];
+        for (int p = base; p < network->groupStart[g + 1]; p++) local[p - base] = destination[p] - base;
+        PopulationPermute(network->groups[g], local, scratch);
+    }
+
+    // 2. Index maps and spike times
+    for (int p = 0; p < n; p++) {
+        order[destination[p]]     = network->order[p];
+        times[destination[p]]     = network->lastSpike[p];
+        times[n + destination[p]] = network->period[p];
+    }
+    for (int p = 0; p < n; p++) {
+        network->order[p]          = order[p];
+        network->index[order[p]]   = p;
+        network->lastSpike[p]      = times[p];
+        network->period[p]         = times[n + p];
+    }
+
+    // 3. Synapse rows move with their source, targets are renumbered within their group
+    for (int p = 0; p < n; p++) {
+        for (int g = 0; g < groups; g++) {
+            const int r = p * groups + g;
+            start[destination[p] * groups + g + 1] = network->synapseStart[r + 1] - network->synapseStart[r];
+        }
+    }
+    for (int r = 0; r < rows; r++) start[r + 1] += start[r];
+    for (int p = 0; p < n; p++) {
+        for (int g = 0; g < groups; g++) {
+            const int base = network->groupStart[g];
+            const int r = p * groups + g;
+            int slot = start[destination[p] * groups + g];
+            for (int k = network->synapseStart[r]; k < network->synapseStart[r + 1]; k++, slot++) {
+                target[slot] = destination[base + network->synapseTarget[k]] - base;
+                weight[slot] = network->synapseWeight[k];
+            }
+        }
+    }
+
+    free(network->synapseStart);
+    free(network->synapseTarget);
+    free(network->synapseWeight);
+    network->synapseStart  = start;
+    network->synapseTarget = target;
+    network->synapseWeight = weight;
+
+    free(scratch);
+    free(local);
+    free(order);
+    free(times);
+    return true;
+}
+
+// --- Public (API) Function Implementations ---
+
+bool NetworkReorder(Network *network, NetworkReorderMode mode) {
+    if (!network || network->distribution || network->placed) return false;
+    if (mode == NETWORK_REORDER_NONE) return true;
+
+    // Rows keep their lengths under renumbering: one scratch row serves both passes
+    const int longest = ReorderLongestRow(network);
+    ReorderSynapse *row = (ReorderSynapse*)malloc((longest > 0 ? longest : 1) * sizeof(ReorderSynapse));
+    if (!row) return false;
+
+    if (mode == NETWORK_REORDER_RCM) {
+        const int n = network->neuronCount;
+        ReorderGraph graph;
+        int *rcm = (int*)malloc(n * sizeof(int));
+        int *destination = (int*)malloc(n * sizeof(int));
+        int *cursor = (int*)malloc(network->groupCount * sizeof(int));
+        if (!rcm || !destination || !cursor || !ReorderBuildGraph(network, &graph)) {
+            free(row);
+            free(rcm);
+            free(destination);
+            free(cursor);
+            return false;
+        }
+        const bool ordered = ReorderCuthillMcKee(&graph, rcm);
+        free(graph.start);
+        free(graph.neighbor);
+
+        // Keep the groups contiguous: each group takes its neurons in RCM order
+        bool ok = ordered;
+        if (ok) {
+            for (int g = 0; g < network->groupCount; g++) cursor[g] = network->groupStart[g];
+            for (int k = 0; k < n; k++) {
+                int g = 0;
+                while (rcm[k] >= network->groupStart[g + 1]) g++;
+                destination[rcm[k]] = cursor[g]++;
+            }
+            ok = ReorderApply(network, destination);
+        }
+        free(rcm);
+        free(destination);
+        free(cursor);
+        if (!ok) {
+            free(row);
+            return false;
+        }
+    }
+
+    ReorderSortRows(network, row);
+    free(row);
+
+    NetworkEstimateCosts(network);
+    network->homeCount = 0;
+    NetworkAssignChunks(network);
+    return true;
+}
+
+double NetworkRowSpread(const Network *network) {
+    const int rows = network->neuronCount * network->groupCount;
+    double spread = 0.0;
+    long gaps = 0;
+    for (int r = 0; r < rows; r++) {
+        for (int k = network->synapseStart[r] + 1; k < network->synapseStart[r + 1]; k++) {
+            spread += abs(network->synapseTarget[k] - network->synapseTarget[k - 1]);
+            gaps++;
+        }
+    }
+    return gaps > 0 ? spread / gaps : 0.0;
+}
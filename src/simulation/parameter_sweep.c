@@ -0,0 +1,217 @@
+/**
+ * @file parameter_sweep.c
+ * @brief Implementation of memoized parameter sweeps.
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils/disk_cache.h"
+#include "simulation/parameter_sweep.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Version of the cached point layout. Bump to invalidate old entries. */
+#define SWEEP_CACHE_VERSION 2u
+
+/** @brief Number of model parameters stored in a cache key. */
+#define KEY_PARAMS 7
+
+/**
+ * @brief Grid values are rounded to the power of ten at or below this
+ * fraction of the axis span, so overlapping grids produce identical values
+ * (and cache keys) for the points they share.
+ */
+#define SWEEP_VALUE_RESOLUTION 1e-6
+
+/**
+ * @struct SweepCacheKey
+ * @brief Everything a point result depends on. All fields are 4 bytes
+ * wide, so the struct has no padding and hashes deterministically.
+ */
+typedef struct {
+    uint32_t version;
+    int32_t neuronModel;
+    int32_t integrator;
+    int32_t warmStart;
+    int32_t stepFromRest;
+    int32_t traceLength;
+    float params[KEY_PARAMS];
+    float externCurrent;
+    float dt;
+    float duration;
+} SweepCacheKey;
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Builds the cache key of a fully resolved point spec.
+ * @param key Output key.
+ * @param spec The resolved RunSpec of the point.
+ * @param traceLength Trace samples stored with the point.
+ */
+static void SweepBuildKey(SweepCacheKey *key, const RunSpec *spec, int traceLength);
+
+/**
+ * @brief Returns the value of grid index 'index' along an axis, quantized
+ * (see SWEEP_VALUE_RESOLUTION).
+ */
+static float SweepAxisValue(const SweepAxis *axis, int index);
+
+// --- Private (static) Function Implementations ---
+
+static void SweepBuildKey(SweepCacheKey *key, const RunSpec *spec, int traceLength) {
+    memset(key, 0, sizeof(*key));
+
+    key->version      = SWEEP_CACHE_VERSION;
+    key->neuronModel  = (int32_t)spec->neuronModel;
+    key->integrator   = (int32_t)spec->integrator;
+    key->warmStart    = spec->warmStart ? 1 : 0;
+    key->stepFromRest = spec->stepFromRest ? 1 : 0;
+    key->traceLength  = traceLength;
+
+    if (spec->neuronModel == IZHIKEVICH_MODEL) {
+        key->params[0] = spec->izParams.a;
+        key->params[1] = spec->izParams.b;
+        key->params[2] = spec->izParams.c;
+        key->params[3] = spec->izParams.d;
+    } else {
+        key->params[0] = spec->hhParams.C;
+        key->params[1] = spec->hhParams.gL;
+        key->params[2] = spec->hhParams.eL;
+        key->params[3] = spec->hhParams.eK;
+        key->params[4] = spec->hhParams.gK;
+        key->params[5] = spec->hhParams.eNa;
+        key->params[6] = spec->hhParams.gNa;
+    }
+
+    key->externCurrent = spec->externCurrent;
+    key->dt            = spec->dt;
+    key->duration      = spec->duration;
+}
+
+static float SweepAxisValue(const SweepAxis *axis, int index) {
+    const double span = (double)axis->max - (double)axis->min;
+    if (axis->steps < 2 || span == 0.0) return axis->min;
+
+    // Power-of-ten quanta nest: a value on a coarse grid's lattice lies on every finer one
+    const double raw     = axis->min + span * index / (axis->steps - 1);
+    const double quantum = pow(10.0, floor(log10(fabs(span) * SWEEP_VALUE_RESOLUTION)));
+    return (float)(round(raw / quantum) * quantum);
+}
+
+// --- Public (API) Function Implementations ---
+
+void SweepConfigDefaults(SweepConfig *config, NeuronModel neuronModel) {
+    memset(config, 0, sizeof(*config));
+
+    RunSpecDefaults(&config->base, neuronModel);
+    config->base.warmStart = true;
+
+    config->axes[0]     = (SweepAxis){ SWEEP_PARAM_CURRENT, 0.0f, 10.0f, 11 };
+    config->numAxes     = 1;
+    config->traceLength = 0;
+    config->useCache    = true;
+}
+
+void SweepApplyParameter(RunSpec *spec, SweepParameter param, float value) {
+    switch (param) {
+        case SWEEP_PARAM_CURRENT: spec->externCurrent = value; break;
+        case SWEEP_PARAM_IZ_A:    spec->izParams.a = value; break;
+        case SWEEP_PARAM_IZ_B:    spec->izParams.b = value; break;
+        case SWEEP_PARAM_IZ_C:    spec->izParams.c = value; break;
+        case SWEEP_PARAM_IZ_D:    spec->izParams.d = value; break;
+        case SWEEP_PARAM_HH_GNA:  spec->hhParams.gNa = value; break;
+        case SWEEP_PARAM_HH_GK:   spec->hhParams.gK = value; break;
+        case SWEEP_PARAM_HH_GL:   spec->hhParams.gL = value; break;
+        default: break;
+    }
+}
+
+bool ParameterSweepRun(const SweepConfig *config, SweepResult *result) {
+    if (!config || !result) return false;
+    if (config->numAxes < 1 || config->numAxes > SWEEP_MAX_AXES || config->traceLength < 0) return false;
+
+    memset(result, 0, sizeof(*result));
+
+    // 1. Size the grid
+    int count = 1;
+    for (int a = 0; a < config->numAxes; a++) {
+        if (config->axes[a].steps < 1) return false;
+        count *= config->axes[a].steps;
+    }
+
+    result->count       = count;
+    result->traceLength = config->traceLength;
+    result->points      = (SweepPoint*)calloc(count, sizeof(SweepPoint));
+    if (!result->points) return false;
+
+    if (config->traceLength > 0) {
+        result->traces = (float*)calloc((size_t)count * config->traceLength, sizeof(float));
+        if (!result->traces) {
+            ParameterSweepFree(result);
+            return false;
+        }
+    }
+
+    // Cache value layout: RunMetrics followed by 'traceLength' floats
+    const size_t traceBytes = (size_t)config->traceLength * sizeof(float);
+    const size_t valueSize  = sizeof(RunMetrics) + traceBytes;
+    unsigned char *value = (unsigned char*)malloc(valueSize);
+    if (!value) {
+        ParameterSweepFree(result);
+        return false;
+    }
+
+    // 2. Visit every grid point (first axis varies slowest)
+    bool ok = true;
+    for (int p = 0; ok && p < count; p++) {
+        SweepPoint *point = &result->points[p];
+        float *trace = result->traces ? result->traces + (size_t)p * config->traceLength : NULL;
+
+        RunSpec spec = config->base;
+        int rest = p;
+        for (int a = config->numAxes - 1; a >= 0; a--) {
+            const SweepAxis *axis = &config->axes[a];
+            int index = rest % axis->steps;
+            rest /= axis->steps;
+
+            const float value = SweepAxisValue(axis, index);
+            point->values[a] = value;
+            SweepApplyParameter(&spec, axis->param, value);
+        }
+
+        SweepCacheKey key;
+        SweepBuildKey(&key, &spec, config->traceLength);
+
+        if (config->useCache && DiskCacheLoad(SWEEP_CACHE_DIR, &key, sizeof(key), value, valueSize) == (long)valueSize) {
+            memcpy(&point->metrics, value, sizeof(RunMetrics));
+            if (trace) memcpy(trace, value + sizeof(RunMetrics), traceBytes);
+            point->fromCache = true;
+            result->cacheHits++;
+            continue;
+        }
+
+        ok = SimulationRunHeadless(&spec, &point->metrics, trace, config->traceLength);
+
+        if (ok && config->useCache) {
+            memcpy(value, &point->metrics, sizeof(RunMetrics));
+            if (trace) memcpy(value + sizeof(RunMetrics), trace, traceBytes);
+            DiskCacheStore(SWEEP_CACHE_DIR, &key, sizeof(key), value, valueSize);
+        }
+    }
+
+    free(value);
+    if (!ok) ParameterSweepFree(result);
+    return ok;
+}
+
+void ParameterSweepFree(SweepResult *result) {
+    if (!result) return;
+
+    free(result->points);
+    free(result->traces);
+    result->points = NULL;
+    result->traces = NULL;
+    result->count  = 0;
+}
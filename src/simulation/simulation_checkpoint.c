@@ -0,0 +1,236 @@
+/**
+ * @file simulation_checkpoint.c
+ * @brief Implementation of binary checkpointing of the simulation state.
+ *
+ * Saving streams each chunk into a temporary file; restoring maps the
+ * whole file (see checkpoint_format.h) and copies the chunk payloads into
+ * the freshly created model, avoiding any intermediate buffering.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "gui/plotting/plot_state.h"
+#include "simulation/simulation_logic.h"
+#include "simulation/simulation_checkpoint.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Number of recorded series stored in the CKPT_TAG_TRACES chunk. */
+#define NUM_TRACES 8
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Collects pointers to every recorded series, in file order.
+ * @param plotData The plot data buffers.
+ * @param traces Output array of NUM_TRACES series pointers.
+ */
+static void CheckpointCollectTraces(const SimulationPlotData *plotData, Vector2 *traces[NUM_TRACES]);
+
+/**
+ * @brief Copies a chunk payload into a float buffer of a known length.
+ * @param dest Destination buffer.
+ * @param count Number of floats expected.
+ * @param payload Chunk payload.
+ * @param size Payload size in bytes.
+ * @return true if the payload matches the expected size.
+ */
+static bool CheckpointCopyFloats(float *dest, int count, const uint8_t *payload, uint64_t size);
+
+// --- Private (static) Function Implementations ---
+
+static void CheckpointCollectTraces(const SimulationPlotData *plotData, Vector2 *traces[NUM_TRACES]) {
+    SimulationPlotData *data = (SimulationPlotData*)plotData;
+
+    traces[0] = data->membranePotential;
+    traces[1] = data->phase;
+    traces[2] = data->hhGatePlots.MGate;
+    traces[3] = data->hhGatePlots.HGate;
+    traces[4] = data->hhGatePlots.NGate;
+    traces[5] = data->hhCurrentPlots.kCurrent;
+    traces[6] = data->hhCurrentPlots.naCurrent;
+    traces[7] = data->hhCurrentPlots.leakCurrent;
+}
+
+static bool CheckpointCopyFloats(float *dest, int count, const uint8_t *payload, uint64_t size) {
+    if (!dest || size != (uint64_t)count * sizeof(float)) return false;
+    memcpy(dest, payload, (size_t)size);
+    return true;
+}
+
+// --- Public (API) Function Implementations ---
+
+bool SimulationCheckpointSave(const AppContext *ctx, const char *path) {
+    const SimulationState *sim = &ctx->simState;
+    if (!sim->models.izModel && !sim->models.hhModel) {
+        fprintf(stderr, "Error: no active model to checkpoint.\n");
+        return false;
+    }
+
+    // 1. Resolve the buffers of the active model
+    const float *stateVector = NULL;
+    const float *internalBuffer = NULL;
+    int stateSize = 0;
+    int internalSize = 0;
+    float dt = K_DT;
+
+    if (ctx->tabs.activeNeuronModel == IZHIKEVICH_MODEL && sim->models.izModel) {
+        stateVector    = sim->models.izModel->stateVector;
+        internalBuffer = sim->models.izModel->internalBuffer;
+        stateSize      = IZHIKEVICH_SYS_DIM;
+        internalSize   = IZHIKEVICH_INTERNAL_SIZE;
+        dt             = sim->models.izModel->integrator.dt;
+    } else if (ctx->tabs.activeNeuronModel == HODGKIN_HUXLEY_MODEL && sim->models.hhModel) {
+        stateVector    = sim->models.hhModel->stateVector;
+        internalBuffer = sim->models.hhModel->internalBuffer;
+        stateSize      = HODGKIN_HUXLEY_SYS_DIM;
+        internalSize   = HODGKIN_HUXLEY_NUM_CURRENTS;
+        dt             = sim->models.hhModel->integrator.dt;
+    } else {
+        fprintf(stderr, "Error: active model does not match the selected neuron model.\n");
+        return false;
+    }
+
+    CheckpointMeta meta = {
+        .neuronModel      = (int32_t)ctx->tabs.activeNeuronModel,
+        .izhikevichType   = (int32_t)ctx->tabs.activeIzhikevichModel,
+        .externCurrent    = sim->inputs.externCurrent,
+        .ampaConductancy  = sim->inputs.ampaConductancy,
+        .gabaaConductancy = sim->inputs.gabaaConductancy,
+        .currentTime      = sim->runtime.currentTime,
+        .dt               = dt,
+        .dataCount        = (int32_t)sim->plotData.dataCount
+    };
+
+    const CheckpointStimulus stimulus = {
+        .zapEnabled   = sim->inputs.zapEnabled ? 1 : 0,
+        .zapAmplitude = sim->inputs.zap.amplitude,
+        .zapStart     = sim->inputs.zap.fStart,
+        .zapEnd       = sim->inputs.zap.fEnd,
+        .zapDuration  = sim->inputs.zap.duration
+    };
+
+    // 2. Write everything to a temporary file, then rename it into place
+    bool hasHHParams = (ctx->tabs.activeNeuronModel == HODGKIN_HUXLEY_MODEL);
+    char tmpPath[1024];
+    FILE *file = CheckpointCreate(path, hasHHParams ? 7u : 6u, tmpPath, sizeof(tmpPath));
+    if (!file) return false;
+
+    Vector2 *traces[NUM_TRACES];
+    CheckpointCollectTraces(&sim->plotData, traces);
+
+    bool ok = CheckpointWriteChunk(file, CKPT_TAG_META, &meta, sizeof(meta));
+    ok = ok && CheckpointWriteChunk(file, CKPT_TAG_PLOT_AXES, &G_PLOT_STATE, sizeof(G_PLOT_STATE));
+    ok = ok && CheckpointWriteChunk(file, CKPT_TAG_STIMULUS, &stimulus, sizeof(stimulus));
+    ok = ok && CheckpointWriteChunk(file, CKPT_TAG_MODEL_STATE, stateVector, (uint64_t)stateSize * sizeof(float));
+    ok = ok && CheckpointWriteChunk(file, CKPT_TAG_MODEL_BUFFER, internalBuffer, (uint64_t)internalSize * sizeof(float));
+    if (hasHHParams) {
+        ok = ok && CheckpointWriteChunk(file, CKPT_TAG_HH_PARAMS, &sim->models.hhModel->neuron.params, sizeof(HodgkinHuxleyParams));
+    }
+
+    // Traces: NUM_TRACES series of 'dataCount' points each, back to back
+    uint64_t traceBytes = (uint64_t)meta.dataCount * sizeof(Vector2);
+    ok = ok && CheckpointWriteChunkHeader(file, CKPT_TAG_TRACES, traceBytes * NUM_TRACES);
+    for (int i = 0; ok && i < NUM_TRACES; i++) {
+        if (traceBytes > 0) ok = (fwrite(traces[i], (size_t)traceBytes, 1, file) == 1);
+    }
+    // sizeof(Vector2) is 8, so the traces chunk needs no alignment padding
+
+    return CheckpointCommit(file, tmpPath, path, ok);
+}
+
+bool SimulationCheckpointRestore(AppContext *ctx, const char *path) {
+    // 1. Map the file and locate the chunks
+    CheckpointMapping mapping;
+    if (!CheckpointMap(path, &mapping)) return false;
+
+    const uint8_t *const *chunks = mapping.chunks;
+    const uint64_t *sizes = mapping.sizes;
+    const CheckpointMeta *meta = NULL;
+
+    // 2. Validate the scalar state
+    if (chunks[CKPT_TAG_META] && sizes[CKPT_TAG_META] == sizeof(CheckpointMeta)) {
+        meta = (const CheckpointMeta*)chunks[CKPT_TAG_META];
+    }
+
+    bool ok = meta && chunks[CKPT_TAG_MODEL_STATE] && chunks[CKPT_TAG_MODEL_BUFFER]
+            && meta->dataCount >= 0 && meta->dataCount <= K_MAX_PLOT_POINTS
+            && meta->izhikevichType >= CHATTERING && meta->izhikevichType <= THALAMO_CORTICAL;
+
+    if (!ok) {
+        CheckpointUnmap(&mapping);
+        fprintf(stderr, "Error: checkpoint '%s' is malformed.\n", path);
+        return false;
+    }
+
+    // 3. Rebuild the saved model and copy the chunks into it
+    SimulationReset(ctx);
+
+    SimulationState *sim = &ctx->simState;
+    ctx->tabs.activeNeuronModel     = (NeuronModel)meta->neuronModel;
+    ctx->tabs.activeIzhikevichModel = (IzNeuronType)meta->izhikevichType;
+
+    switch (ctx->tabs.activeNeuronModel) {
+        case IZHIKEVICH_MODEL: {
+            IzhikevichModel *model = IzhikevichInitModel(ctx->tabs.activeIzhikevichModel, meta->dt);
+            sim->models.izModel = model;
+            ok = model
+                && CheckpointCopyFloats(model->stateVector, IZHIKEVICH_SYS_DIM, chunks[CKPT_TAG_MODEL_STATE], sizes[CKPT_TAG_MODEL_STATE])
+                && CheckpointCopyFloats(model->internalBuffer, IZHIKEVICH_INTERNAL_SIZE, chunks[CKPT_TAG_MODEL_BUFFER], sizes[CKPT_TAG_MODEL_BUFFER]);
+        } break;
+
+        case HODGKIN_HUXLEY_MODEL: {
+            HodgkinHuxleyModel *model = HodgkinHuxleyInitModel(meta->dt);
+            sim->models.hhModel = model;
+            ok = model
+                && CheckpointCopyFloats(model->stateVector, HODGKIN_HUXLEY_SYS_DIM, chunks[CKPT_TAG_MODEL_STATE], sizes[CKPT_TAG_MODEL_STATE])
+                && CheckpointCopyFloats(model->internalBuffer, HODGKIN_HUXLEY_NUM_CURRENTS, chunks[CKPT_TAG_MODEL_BUFFER], sizes[CKPT_TAG_MODEL_BUFFER]);
+            if (ok && chunks[CKPT_TAG_HH_PARAMS] && sizes[CKPT_TAG_HH_PARAMS] == sizeof(HodgkinHuxleyParams)) {
+                memcpy(&model->neuron.params, chunks[CKPT_TAG_HH_PARAMS], sizeof(HodgkinHuxleyParams));
+            }
+        } break;
+
+        default: ok = false; break;
+    }
+
+    if (ok) {
+        sim->inputs.externCurrent    = meta->externCurrent;
+        sim->inputs.ampaConductancy  = meta->ampaConductancy;
+        sim->inputs.gabaaConductancy = meta->gabaaConductancy;
+        sim->runtime.currentTime     = meta->currentTime;
+        sim->runtime.isRunning       = false;
+
+        sim->inputs.zapEnabled = false;
+        if (chunks[CKPT_TAG_STIMULUS] && sizes[CKPT_TAG_STIMULUS] == sizeof(CheckpointStimulus)) {
+            const CheckpointStimulus *stimulus = (const CheckpointStimulus*)chunks[CKPT_TAG_STIMULUS];
+            sim->inputs.zapEnabled    = stimulus->zapEnabled != 0;
+            sim->inputs.zap.amplitude = stimulus->zapAmplitude;
+            sim->inputs.zap.fStart    = stimulus->zapStart;
+            sim->inputs.zap.fEnd      = stimulus->zapEnd;
+            sim->inputs.zap.duration  = stimulus->zapDuration;
+        }
+
+        if (chunks[CKPT_TAG_PLOT_AXES] && sizes[CKPT_TAG_PLOT_AXES] == sizeof(PlotState)) {
+            memcpy(&G_PLOT_STATE, chunks[CKPT_TAG_PLOT_AXES], sizeof(PlotState));
+        }
+
+        uint64_t traceBytes = (uint64_t)meta->dataCount * sizeof(Vector2);
+        if (chunks[CKPT_TAG_TRACES] && sizes[CKPT_TAG_TRACES] == traceBytes * NUM_TRACES) {
+            Vector2 *traces[NUM_TRACES];
+            CheckpointCollectTraces(&sim->plotData, traces);
+            for (int i = 0; i < NUM_TRACES; i++) {
+                memcpy(traces[i], chunks[CKPT_TAG_TRACES] + traceBytes * i, (size_t)traceBytes);
+            }
+            sim->plotData.dataCount = meta->dataCount;
+        }
+    }
+
+    CheckpointUnmap(&mapping);
+
+    if (!ok) {
+        SimulationReset(ctx);
+        fprintf(stderr, "Error: checkpoint '%s' does not match the saved model.\n", path);
+        return false;
+    }
+
+    return true;
+}
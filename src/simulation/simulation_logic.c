@@ -8,6 +8,7 @@
  */
 #include "gui/plotting/plot_state.h"
 #include "simulation/simulation_logic.h"
+#include "simulation/steady_state_cache.h"
 #include "model/neural/izhikevich/izhikevich_model.h"
 #include "model/neural/hodgkin-huxley/hodgkin_huxley_model.h"
 
@@ -42,6 +43,15 @@ static void SimulationRunStepIzhikevich(AppContext *ctx);
  */
 static void SimulationRunStepHodgkinHuxley(AppContext *ctx);
 
+/**
+ * @brief Computes the injected current at a given time: the GUI current
+ * plus the ZAP stimulus when enabled.
+ * @param ctx Pointer to the global AppContext.
+ * @param time Simulation time (ms).
+ * @return The total injected current.
+ */
+static float SimulationInputCurrent(const AppContext *ctx, float time);
+
 // --- Public Function Implementations ---
 
 void SimulationUpdate(AppContext *ctx) {
@@ -66,6 +76,23 @@ void SimulationUpdate(AppContext *ctx) {
     ctx->simState.plotData.dataCount++;
 }
 
+void SimulationStart(AppContext *ctx) {
+    SimulationReset(ctx);
+
+    SimulationState *sim = &ctx->simState;
+    sim->runtime.isRunning = true;
+
+    if (ctx->tabs.activeNeuronModel == IZHIKEVICH_MODEL) {
+        sim->models.izModel = IzhikevichInitModel(ctx->tabs.activeIzhikevichModel, K_DT);
+        if (sim->inputs.warmStart) SteadyStateWarmStartIzhikevich(sim->models.izModel, sim->inputs.externCurrent);
+    }
+
+    if (ctx->tabs.activeNeuronModel == HODGKIN_HUXLEY_MODEL) {
+        sim->models.hhModel = HodgkinHuxleyInitModel(K_DT);
+        if (sim->inputs.warmStart) SteadyStateWarmStartHodgkinHuxley(sim->models.hhModel, sim->inputs.externCurrent);
+    }
+}
+
 void SimulationReset(AppContext *ctx) {
     ctx->simState.runtime.isRunning   = false;
     ctx->simState.runtime.currentTime = 0.0f;
@@ -79,6 +106,8 @@ void SimulationReset(AppContext *ctx) {
 
     ctx->tabs.phasePlotScroll = (Vector2){ 0, 0 };
 
+    SpectrumReset(&ctx->simState.spectrum);
+
     PlotStateReset();
 }
 
@@ -91,12 +120,15 @@ static void SimulationRunStepIzhikevich(AppContext *ctx) {
     IzhikevichModel *model = ctx->simState.models.izModel;
     if (!model) return;
 
-    IzhikevichSetExternalCurrent(ctx->simState.models.izModel, ctx->simState.inputs.externCurrent);
+    int index  = ctx->simState.plotData.dataCount;
+    float time = ctx->simState.runtime.currentTime;
+
+    float current = SimulationInputCurrent(ctx, time);
+    IzhikevichSetExternalCurrent(ctx->simState.models.izModel, current);
     float potential = IzhikevichUpdateModel(ctx->simState.models.izModel);
     float recovery  = IzhikevichGetRecovery(ctx->simState.models.izModel);
 
-    int index  = ctx->simState.plotData.dataCount;
-    float time = ctx->simState.runtime.currentTime;
+    SpectrumPush(&ctx->simState.spectrum, current, potential);
 
     ctx->simState.plotData.membranePotential[index] = (Vector2){ time, potential };
     ctx->simState.plotData.phase[index]             = (Vector2){ recovery, potential };
@@ -109,7 +141,11 @@ static void SimulationRunStepHodgkinHuxley(AppContext *ctx) {
     HodgkinHuxleyModel *model = ctx->simState.models.hhModel;
     if (!model) return;
 
-    HodgkinHuxleySetExternalCurent(ctx->simState.models.hhModel, ctx->simState.inputs.externCurrent);
+    int index  = ctx->simState.plotData.dataCount;
+    float time = ctx->simState.runtime.currentTime;
+
+    float current = SimulationInputCurrent(ctx, time);
+    HodgkinHuxleySetExternalCurent(ctx->simState.models.hhModel, current);
     float potential = HodgkinHuxleyUpdateModel(ctx->simState.models.hhModel);
     float iK        = HodgkinHuxleyGetIK(ctx->simState.models.hhModel);
     float iNa       = HodgkinHuxleyGetINa(ctx->simState.models.hhModel);
@@ -118,10 +154,10 @@ static void SimulationRunStepHodgkinHuxley(AppContext *ctx) {
     float nGateProb = HodgkinHuxleyGetNGate(ctx->simState.models.hhModel);
     float hGateProb = HodgkinHuxleyGetHGate(ctx->simState.models.hhModel);
 
-    int index  = ctx->simState.plotData.dataCount;
-    float time = ctx->simState.runtime.currentTime;
+    SpectrumPush(&ctx->simState.spectrum, current, potential);
 
     ctx->simState.plotData.membranePotential[index] = (Vector2){ time, potential };
+    ctx->simState.plotData.phase[index]             = (Vector2){ nGateProb, potential };
 
     ctx->simState.plotData.hhGatePlots.MGate[index] = (Vector2){ time, mGateProb };
     ctx->simState.plotData.hhGatePlots.NGate[index] = (Vector2){ time, nGateProb };
@@ -132,6 +168,15 @@ static void SimulationRunStepHodgkinHuxley(AppContext *ctx) {
     ctx->simState.plotData.hhCurrentPlots.leakCurrent[index] = (Vector2){ time, iLeak };
 }
 
+/**
+ * @brief Implementation of the injected current (GUI current + optional ZAP).
+ */
+static float SimulationInputCurrent(const AppContext *ctx, float time) {
+    float current = ctx->simState.inputs.externCurrent;
+    if (ctx->simState.inputs.zapEnabled) current += ZapCurrent(&ctx->simState.inputs.zap, time);
+    return current;
+}
+
 static void SimulationUpdateAutoScale(AppContext *ctx) {
     int index  = ctx->simState.plotData.dataCount;
     float time = ctx->simState.runtime.currentTime;
@@ -0,0 +1,204 @@
+/**
+ * @file simulation_run.c
+ * @brief Implementation of headless single-neuron runs.
+ */
+#include <float.h>
+#include <string.h>
+#include "simulation/simulation_state.h"
+#include "simulation/simulation_run.h"
+#include "simulation/steady_state_cache.h"
+#include "model/neural/izhikevich/izhikevich_model.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_config.h"
+#include "model/neural/hodgkin-huxley/hodgkin_huxley_model.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Default duration of a headless run (ms). */
+#define DEFAULT_DURATION 500.0f
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Builds the implicit single-neuron HH batch of a RunSpec.
+ *
+ * The warm start settles an RK4 model at K_DT (RK4 is not stable at the
+ * large steps the implicit schemes are used with) and copies its state.
+ */
+static bool RunNeuronInitImplicit(RunNeuron *neuron, const RunSpec *spec, float settleCurrent);
+
+// --- Private (static) Function Implementations ---
+
+static bool RunNeuronInitImplicit(RunNeuron *neuron, const RunSpec *spec, float settleCurrent) {
+    const HodgkinHuxleyImplicitScheme scheme = spec->integrator == RUN_INTEGRATOR_BDF2
+                                             ? HH_IMPLICIT_BDF2 : HH_IMPLICIT_BACKWARD_EULER;
+
+    HodgkinHuxleyImplicitBatch *batch = HodgkinHuxleyImplicitInit(1, &spec->hhParams, spec->dt, scheme);
+    if (!batch) return false;
+
+    if (spec->warmStart) {
+        HodgkinHuxleyModel *settle = HodgkinHuxleyInitModel(K_DT);
+        if (!settle) {
+            HodgkinHuxleyImplicitFree(batch);
+            return false;
+        }
+        HodgkinHuxleySetParameters(settle, &spec->hhParams);
+        SteadyStateWarmStartHodgkinHuxley(settle, settleCurrent);
+        HodgkinHuxleyImplicitSetState(batch, 0, settle->stateVector);
+        HodgkinHuxleyFreeModel(settle);
+    }
+    batch->iExt[0] = spec->externCurrent;
+
+    neuron->hhImplicit = batch;
+    neuron->state      = batch->v;
+    neuron->stateSize  = HODGKIN_HUXLEY_SYS_DIM;
+    neuron->potential  = batch->v[0];
+    return true;
+}
+
+// --- Public (API) Function Implementations ---
+
+void RunSpecDefaults(RunSpec *spec, NeuronModel neuronModel) {
+    memset(spec, 0, sizeof(*spec));
+
+    spec->neuronModel   = neuronModel;
+    spec->izParams      = IZHIKEVICH_PARAMETERS[REGULAR_SPIKING];
+    spec->hhParams      = (HodgkinHuxleyParams){
+        .C   = HH_CONFIG.membraneCapacitancy,
+        .gL  = HH_CONFIG.leakConductance,
+        .eL  = HH_CONFIG.leakReversal,
+        .eK  = HH_CONFIG.potassiumReversal,
+        .gK  = HH_CONFIG.potassiumConductance,
+        .eNa = HH_CONFIG.sodiumReversal,
+        .gNa = HH_CONFIG.sodiumConductance
+    };
+    spec->integrator    = RUN_INTEGRATOR_RK4;
+    spec->externCurrent = 0.0f;
+    spec->dt            = K_DT;
+    spec->duration      = DEFAULT_DURATION;
+    spec->warmStart     = false;
+}
+
+bool SimulationRunHeadless(const RunSpec *spec, RunMetrics *metrics, float *trace, int traceLength) {
+    if (!spec || !metrics || spec->duration <= 0.0f) return false;
+
+    // 1. Build and (optionally) settle the model
+    RunNeuron neuron;
+    if (!RunNeuronInit(&neuron, spec)) return false;
+
+    // 2. Run and collect metrics
+    const int steps = (int)(spec->duration / spec->dt + 0.5f);
+    const int decimation = (trace && traceLength > 0) ? (steps + traceLength - 1) / traceLength : 0;
+
+    memset(metrics, 0, sizeof(*metrics));
+    metrics->firstSpikeTime = -1.0f;
+    metrics->lastSpikeTime  = -1.0f;
+    metrics->minPotential   = FLT_MAX;
+    metrics->maxPotential   = -FLT_MAX;
+
+    double sumPotential = 0.0;
+    int traceIndex = 0;
+
+    for (int i = 0; i < steps; i++) {
+        bool spiked = RunNeuronStep(&neuron);
+        float v     = neuron.potential;
+
+        if (spiked) {
+            float t = (i + 1) * spec->dt;
+            if (metrics->spikeCount == 0) metrics->firstSpikeTime = t;
+            metrics->lastSpikeTime = t;
+            metrics->spikeCount++;
+        }
+
+        sumPotential += v;
+        if (v < metrics->minPotential) metrics->minPotential = v;
+        if (v > metrics->maxPotential) metrics->maxPotential = v;
+
+        if (decimation > 0 && i % decimation == 0 && traceIndex < traceLength) trace[traceIndex++] = v;
+    }
+
+    // Pad the trace if the decimation did not fill it exactly
+    while (decimation > 0 && traceIndex < traceLength) trace[traceIndex++] = neuron.potential;
+
+    metrics->meanPotential = (float)(sumPotential / steps);
+    metrics->firingRate    = metrics->spikeCount * 1000.0f / spec->duration;
+
+    RunNeuronFree(&neuron);
+    return true;
+}
+
+bool RunNeuronInit(RunNeuron *neuron, const RunSpec *spec) {
+    if (!neuron || !spec || spec->dt <= 0.0f) return false;
+    if (spec->integrator != RUN_INTEGRATOR_RK4 && spec->neuronModel != HODGKIN_HUXLEY_MODEL) return false;
+
+    memset(neuron, 0, sizeof(*neuron));
+    neuron->neuronModel = spec->neuronModel;
+    neuron->dt          = spec->dt;
+
+    const float settleCurrent = spec->stepFromRest ? 0.0f : spec->externCurrent;
+
+    switch (spec->neuronModel) {
+        case IZHIKEVICH_MODEL: {
+            IzhikevichModel *model = IzhikevichInitModelFromConfig(&spec->izParams, spec->dt);
+            if (!model) return false;
+            if (spec->warmStart) SteadyStateWarmStartIzhikevich(model, settleCurrent);
+            IzhikevichSetExternalCurrent(model, spec->externCurrent);
+
+            neuron->izModel   = model;
+            neuron->state     = model->stateVector;
+            neuron->stateSize = IZHIKEVICH_SYS_DIM;
+            neuron->potential = *(model->neuron.state.v);
+        } break;
+
+        case HODGKIN_HUXLEY_MODEL: {
+            if (spec->integrator != RUN_INTEGRATOR_RK4) return RunNeuronInitImplicit(neuron, spec, settleCurrent);
+
+            HodgkinHuxleyModel *model = HodgkinHuxleyInitModel(spec->dt);
+            if (!model) return false;
+            HodgkinHuxleySetParameters(model, &spec->hhParams);
+            if (spec->warmStart) SteadyStateWarmStartHodgkinHuxley(model, settleCurrent);
+            HodgkinHuxleySetExternalCurent(model, spec->externCurrent);
+
+            neuron->hhModel   = model;
+            neuron->state     = model->stateVector;
+            neuron->stateSize = HODGKIN_HUXLEY_SYS_DIM;
+            neuron->potential = *(model->neuron.state.v);
+        } break;
+
+        default: return false;
+    }
+
+    return true;
+}
+
+bool RunNeuronStep(RunNeuron *neuron) {
+    const float previous = neuron->potential;
+
+    if (neuron->izModel) {
+        neuron->potential = IzhikevichUpdateModel(neuron->izModel);
+        return neuron->potential >= IZHIKEVICH_SPIKE_PEAK;
+    }
+
+    if (neuron->hhImplicit) {
+        HodgkinHuxleyImplicitStep(neuron->hhImplicit);
+        neuron->potential = neuron->hhImplicit->v[0];
+    } else {
+        neuron->potential = HodgkinHuxleyUpdateModel(neuron->hhModel);
+    }
+    return previous < HH_SPIKE_THRESHOLD && neuron->potential >= HH_SPIKE_THRESHOLD;
+}
+
+void RunNeuronSetCurrent(RunNeuron *neuron, float current) {
+    if (neuron->izModel) IzhikevichSetExternalCurrent(neuron->izModel, current);
+    if (neuron->hhModel) HodgkinHuxleySetExternalCurent(neuron->hhModel, current);
+    if (neuron->hhImplicit) neuron->hhImplicit->iExt[0] = current;
+}
+
+void RunNeuronFree(RunNeuron *neuron) {
+    IzhikevichFreeModel(neuron->izModel);
+    HodgkinHuxleyFreeModel(neuron->hhModel);
+    HodgkinHuxleyImplicitFree(neuron->hhImplicit);
+    neuron->izModel    = NULL;
+    neuron->hhModel    = NULL;
+    neuron->hhImplicit = NULL;
+    neuron->state      = NULL;
+}
@@ -0,0 +1,297 @@
+/**
+ * @file spike_transport.c
+ * @brief Shared-memory implementation of the spike transport.
+ *
+ * Segment layout: a header with the process-shared barrier, then the block
+ * sizes [2][size], then the blocks [2][size][capacity]. Interval k uses
+ * buffer k % 2.
+ *
+ * The barrier is a robust mutex and a condition variable rather than a
+ * pthread_barrier_t, whose wait can neither time out nor be cancelled:
+ * waiters wake up every SPIKE_TRANSPORT_LIVENESS_MS to check the other
+ * ranks, and an abort wakes them all.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include "simulation/spike_transport.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Alignment of the blocks inside the segment. */
+#define BLOCK_ALIGN 64
+
+/**
+ * @struct ShmHeader
+ * @brief Start of the shared segment.
+ */
+typedef struct {
+    pthread_mutex_t mutex;      ///< Robust: a rank dying while holding it does not block the others
+    pthread_cond_t passed;      ///< Signalled when the last rank arrives, or on abort
+    int size;
+    int waiting;                ///< Ranks arrived at the current barrier
+    long generation;            ///< Barriers completed
+    int aborted;
+} ShmHeader;
+
+/**
+ * @struct ShmTransport
+ * @brief Per-process view of the shared segment.
+ */
+typedef struct {
+    SpikeTransport base;
+    void *mapping;
+    size_t mappedBytes;
+    size_t capacity;            ///< Bytes per block (aligned)
+    ShmHeader *header;
+    size_t *sizes;              ///< [2][size] published block sizes
+    unsigned char *data;        ///< [2][size][capacity] blocks
+    long interval;              ///< Exchanges done by this process
+    int parent;                 ///< Process id of rank 0
+    int *processIds;            ///< [size] process ids of the other ranks (rank 0 only, 0 if unknown)
+} ShmTransport;
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief Locks the header mutex, taking over (and aborting) if its owner died.
+ * @return false if the mutex is unusable.
+ */
+static bool ShmLock(ShmTransport *shm);
+
+/**
+ * @brief Returns false if another rank has died (see SpikeTransportShmCreate).
+ */
+static bool ShmPeersAlive(const ShmTransport *shm);
+
+/**
+ * @brief Waits until every rank has arrived.
+ * @return false if the transport was or got aborted first.
+ */
+static bool ShmBarrier(ShmTransport *shm);
+
+/**
+ * @brief SpikeTransport::allGather: copy into this rank's slot, barrier,
+ * return the slots of the current buffer.
+ */
+static bool ShmAllGather(SpikeTransport *transport, const void *block, size_t bytes,
+                         const unsigned char **blocks, size_t *sizes);
+
+/**
+ * @brief SpikeTransport::abort: marks the segment aborted and wakes every waiter.
+ */
+static void ShmAbort(SpikeTransport *transport);
+
+/**
+ * @brief SpikeTransport::free: unmaps the segment; rank 0 also destroys the barrier.
+ */
+static void ShmFree(SpikeTransport *transport);
+
+// --- Private (static) Function Implementations ---
+
+static bool ShmLock(ShmTransport *shm) {
+    const int rc = pthread_mutex_lock(&shm->header->mutex);
+    if (rc == EOWNERDEAD) {
+        pthread_mutex_consistent(&shm->header->mutex);
+        shm->header->aborted = 1;
+        return true;
+    }
+    return rc == 0;
+}
+
+static bool ShmPeersAlive(const ShmTransport *shm) {
+    if (shm->base.rank != 0) return getppid() == (pid_t)shm->parent;
+
+    // WNOWAIT leaves an exited child waitable, so NetworkJoin still gets its status
+    for (int r = 1; r < shm->base.size; r++) {
+        if (shm->processIds[r] <= 0) continue;
+
+        siginfo_t info;
+        memset(&info, 0, sizeof(info));
+        if (waitid(P_PID, (id_t)shm->processIds[r], &info, WEXITED | WNOHANG | WNOWAIT) != 0 || info.si_pid != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool ShmBarrier(ShmTransport *shm) {
+    ShmHeader *header = shm->header;
+    if (!ShmLock(shm)) return false;
+    if (header->aborted) {
+        pthread_mutex_unlock(&header->mutex);
+        return false;
+    }
+
+    const long generation = header->generation;
+    if (++header->waiting == shm->base.size) {
+        header->waiting = 0;
+        header->generation++;
+        pthread_cond_broadcast(&header->passed);
+    }
+
+    while (header->generation == generation && !header->aborted) {
+        struct timespec deadline;
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_nsec += SPIKE_TRANSPORT_LIVENESS_MS * 1000000L;
+        deadline.tv_sec  += deadline.tv_nsec / 1000000000L;
+        deadline.tv_nsec %= 1000000000L;
+
+        const int rc = pthread_cond_timedwait(&header->passed, &header->mutex, &deadline);
+        if (rc == EOWNERDEAD) {
+            pthread_mutex_consistent(&header->mutex);
+            header->aborted = 1;
+        } else if (rc == ETIMEDOUT && header->generation == generation && !ShmPeersAlive(shm)) {
+            fprintf(stderr, "Error: a process of the spike exchange died\n");
+            header->aborted = 1;
+        }
+    }
+    if (header->aborted) pthread_cond_broadcast(&header->passed);
+
+    // A barrier completed before the abort still counts
+    const bool passed = header->generation != generation;
+    pthread_mutex_unlock(&header->mutex);
+    return passed;
+}
+
+static bool ShmAllGather(SpikeTransport *transport, const void *block, size_t bytes,
+                         const unsigned char **blocks, size_t *sizes) {
+    ShmTransport *shm = (ShmTransport*)transport;
+    const int size = transport->size;
+    const int buffer = (int)(shm->interval++ & 1);
+
+    if (bytes > shm->capacity) {
+        fprintf(stderr, "Error: spike block of %zu bytes exceeds the transport capacity (%zu)\n", bytes, shm->capacity);
+        ShmAbort(transport);
+        return false;
+    }
+
+    unsigned char *slot = shm->data + ((size_t)buffer * size + transport->rank) * shm->capacity;
+    if (bytes > 0) memcpy(slot, block, bytes);
+    shm->sizes[buffer * size + transport->rank] = bytes;
+
+    // The barrier's mutex also orders the writes above before every reader
+    if (!ShmBarrier(shm)) return false;
+
+    for (int r = 0; r < size; r++) {
+        blocks[r] = shm->data + ((size_t)buffer * size + r) * shm->capacity;
+        sizes[r]  = shm->sizes[buffer * size + r];
+    }
+    return true;
+}
+
+static void ShmAbort(SpikeTransport *transport) {
+    ShmTransport *shm = (ShmTransport*)transport;
+    if (!ShmLock(shm)) return;
+    shm->header->aborted = 1;
+    pthread_cond_broadcast(&shm->header->passed);
+    pthread_mutex_unlock(&shm->header->mutex);
+}
+
+static void ShmFree(SpikeTransport *transport) {
+    ShmTransport *shm = (ShmTransport*)transport;
+    if (transport->rank == 0) {
+        pthread_cond_destroy(&shm->header->passed);
+        pthread_mutex_destroy(&shm->header->mutex);
+    }
+    munmap(shm->mapping, shm->mappedBytes);
+    free(shm->processIds);
+    free(shm);
+}
+
+// --- Public (API) Function Implementations ---
+
+SpikeTransport *SpikeTransportShmCreate(int processes, size_t blockCapacity) {
+    if (processes < 1) return NULL;
+
+    const size_t capacity = (blockCapacity + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN;
+    const size_t headerBytes = (sizeof(ShmHeader) + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN;
+    const size_t sizeBytes = (2 * processes * sizeof(size_t) + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN;
+    const size_t total = headerBytes + sizeBytes + 2 * (size_t)processes * capacity;
+
+    ShmTransport *shm = (ShmTransport*)calloc(1, sizeof(ShmTransport));
+    int *processIds = (int*)calloc(processes, sizeof(int));
+    if (!shm || !processIds) {
+        free(shm);
+        free(processIds);
+        return NULL;
+    }
+    shm->processIds = processIds;
+
+    // A unique name; the object is unlinked right after mapping, so it never outlives the run
+    char name[64];
+    snprintf(name, sizeof(name), "/neurolab-spikes-%ld-%p", (long)getpid(), (void*)shm);
+    const int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        fprintf(stderr, "Error: could not create shared memory object %s\n", name);
+        free(processIds);
+        free(shm);
+        return NULL;
+    }
+    void *mapping = MAP_FAILED;
+    if (ftruncate(fd, (off_t)total) == 0) {
+        mapping = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    shm_unlink(name);
+    if (mapping == MAP_FAILED) {
+        fprintf(stderr, "Error: could not map %zu bytes of shared memory\n", total);
+        free(processIds);
+        free(shm);
+        return NULL;
+    }
+
+    shm->mapping     = mapping;
+    shm->mappedBytes = total;
+    shm->capacity    = capacity;
+    shm->header      = (ShmHeader*)mapping;
+    shm->sizes       = (size_t*)((unsigned char*)mapping + headerBytes);
+    shm->data        = (unsigned char*)mapping + headerBytes + sizeBytes;
+    shm->header->size = processes;
+
+    pthread_mutexattr_t mutexAttr;
+    pthread_condattr_t condAttr;
+    const bool mutexAttrOk = pthread_mutexattr_init(&mutexAttr) == 0;
+    const bool condAttrOk  = pthread_condattr_init(&condAttr) == 0;
+    bool ok = mutexAttrOk && condAttrOk;
+    ok = ok && pthread_mutexattr_setpshared(&mutexAttr, PTHREAD_PROCESS_SHARED) == 0;
+    ok = ok && pthread_mutexattr_setrobust(&mutexAttr, PTHREAD_MUTEX_ROBUST) == 0;
+    ok = ok && pthread_condattr_setpshared(&condAttr, PTHREAD_PROCESS_SHARED) == 0;
+    ok = ok && pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC) == 0;
+    const bool mutexOk = ok && pthread_mutex_init(&shm->header->mutex, &mutexAttr) == 0;
+    ok = mutexOk && pthread_cond_init(&shm->header->passed, &condAttr) == 0;
+    if (mutexAttrOk) pthread_mutexattr_destroy(&mutexAttr);
+    if (condAttrOk) pthread_condattr_destroy(&condAttr);
+    if (!ok) {
+        fprintf(stderr, "Error: could not create a process-shared barrier\n");
+        if (mutexOk) pthread_mutex_destroy(&shm->header->mutex);
+        munmap(mapping, total);
+        free(processIds);
+        free(shm);
+        return NULL;
+    }
+
+    shm->base.rank      = 0;
+    shm->base.size      = processes;
+    shm->parent         = (int)getpid();
+    shm->base.allGather = ShmAllGather;
+    shm->base.abort     = ShmAbort;
+    shm->base.free      = ShmFree;
+    return &shm->base;
+}
+
+void SpikeTransportShmSetProcess(SpikeTransport *transport, int rank, int processId) {
+    ShmTransport *shm = (ShmTransport*)transport;
+    if (!transport || transport->rank != 0 || rank <= 0 || rank >= transport->size) return;
+    shm->processIds[rank] = processId;
+}
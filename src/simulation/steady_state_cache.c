@@ -0,0 +1,152 @@
+/**
+ * @file steady_state_cache.c
+ * @brief Implementation of the steady-state warm-start cache.
+ */
+#include <math.h>
+#include <string.h>
+#include "utils/disk_cache.h"
+#include "simulation/steady_state_cache.h"
+
+// --- Internal Module Constants ---
+
+/** @brief Version of the cached state layout. Bump to invalidate old entries. */
+#define STEADY_STATE_VERSION 2u
+
+/** @brief Largest state dimension of the supported models. */
+#define STEADY_STATE_MAX_DIM HODGKIN_HUXLEY_SYS_DIM
+
+/** @brief Advances a model by one step (IzhikevichUpdateModel, HodgkinHuxleyUpdateModel). */
+typedef float (*SteadyStateStep)(void *model);
+
+// --- Static Forward Declarations ---
+
+/**
+ * @brief SteadyStateStep adapters of the two models.
+ */
+static float SteadyStateStepIzhikevich(void *model);
+static float SteadyStateStepHodgkinHuxley(void *model);
+
+/**
+ * @brief Loads or computes the settled state of a model already in its
+ * reset state with its input set.
+ * @return true if the model was moved to a settled state, false if it was
+ * left in its reset state.
+ */
+static bool SteadyStateWarmStart(const SteadyStateKey *key, void *model, SteadyStateStep step,
+                                 float *state, int dim, float dt);
+
+// --- Private (static) Function Implementations ---
+
+static float SteadyStateStepIzhikevich(void *model) {
+    return IzhikevichUpdateModel((IzhikevichModel*)model);
+}
+
+static float SteadyStateStepHodgkinHuxley(void *model) {
+    return HodgkinHuxleyUpdateModel((HodgkinHuxleyModel*)model);
+}
+
+static bool SteadyStateWarmStart(const SteadyStateKey *key, void *model, SteadyStateStep step,
+                                 float *state, int dim, float dt) {
+    const size_t stateBytes = dim * sizeof(float);
+
+    // Loaded into a copy: a short or damaged entry must not touch the model.
+    // An empty entry records that this input has no fixed point.
+    float cached[STEADY_STATE_MAX_DIM];
+    const long stored = DiskCacheLoad(STEADY_STATE_CACHE_DIR, key, sizeof(*key), cached, stateBytes);
+    if (stored == (long)stateBytes) {
+        memcpy(state, cached, stateBytes);
+        return true;
+    }
+    if (stored == 0) return false;
+
+    // Cache miss: settle from the reset state until every variable stays still for a whole window
+    float reset[STEADY_STATE_MAX_DIM];
+    memcpy(reset, state, stateBytes);
+
+    const int windowSteps = (int)(STEADY_STATE_WINDOW / dt) > 0 ? (int)(STEADY_STATE_WINDOW / dt) : 1;
+    const int maxSteps = (int)(STEADY_STATE_SETTLE_TIME / dt);
+    bool settled = false;
+    float rate = 0.0f;
+
+    for (int i = 1; i <= maxSteps && !settled; i++) {
+        float previous[STEADY_STATE_MAX_DIM];
+        memcpy(previous, state, stateBytes);
+        step(model);
+
+        for (int k = 0; k < dim; k++) {
+            const float change = fabsf(state[k] - previous[k]) / dt;
+            if (!(change <= rate)) rate = change;   // NaN counts as not settled
+        }
+        if (i % windowSteps == 0) {
+            settled = rate < STEADY_STATE_TOLERANCE;
+            rate = 0.0f;
+        }
+    }
+
+    if (!settled) {
+        memcpy(state, reset, stateBytes);
+        DiskCacheStore(STEADY_STATE_CACHE_DIR, key, sizeof(*key), NULL, 0);
+        return false;
+    }
+    DiskCacheStore(STEADY_STATE_CACHE_DIR, key, sizeof(*key), state, stateBytes);
+    return true;
+}
+
+// --- Public (API) Function Implementations ---
+
+void SteadyStateKeyIzhikevich(SteadyStateKey *key, const IzhikevichModel *model, float iExt) {
+    memset(key, 0, sizeof(*key));
+
+    key->version       = STEADY_STATE_VERSION;
+    key->neuronModel   = IZHIKEVICH_MODEL;
+    key->params[0]     = *(model->neuron.params.a);
+    key->params[1]     = *(model->neuron.params.b);
+    key->params[2]     = *(model->neuron.params.c);
+    key->params[3]     = *(model->neuron.params.d);
+    key->externCurrent = iExt;
+    key->dt            = model->integrator.dt;
+    key->settleTime    = STEADY_STATE_SETTLE_TIME;
+    key->tolerance     = STEADY_STATE_TOLERANCE;
+}
+
+void SteadyStateKeyHodgkinHuxley(SteadyStateKey *key, const HodgkinHuxleyModel *model, float iExt) {
+    memset(key, 0, sizeof(*key));
+
+    key->version       = STEADY_STATE_VERSION;
+    key->neuronModel   = HODGKIN_HUXLEY_MODEL;
+    key->params[0]     = model->neuron.params.C;
+    key->params[1]     = model->neuron.params.gL;
+    key->params[2]     = model->neuron.params.eL;
+    key->params[3]     = model->neuron.params.eK;
+    key->params[4]     = model->neuron.params.gK;
+    key->params[5]     = model->neuron.params.eNa;
+    key->params[6]     = model->neuron.params.gNa;
+    key->externCurrent = iExt;
+    key->dt            = model->integrator.dt;
+    key->settleTime    = STEADY_STATE_SETTLE_TIME;
+    key->tolerance     = STEADY_STATE_TOLERANCE;
+}
+
+bool SteadyStateWarmStartIzhikevich(IzhikevichModel *model, float iExt) {
+    if (!model) return false;
+
+    SteadyStateKey key;
+    SteadyStateKeyIzhikevich(&key, model, iExt);
+    IzhikevichResetState(model);
+    IzhikevichSetExternalCurrent(model, iExt);
+
+    return SteadyStateWarmStart(&key, model, SteadyStateStepIzhikevich, model->stateVector,
+                                IZHIKEVICH_SYS_DIM, model->integrator.dt);
+}
+
+bool SteadyStateWarmStartHodgkinHuxley(HodgkinHuxleyModel *model, float iExt) {
+    if (!model) return false;
+
+    SteadyStateKey key;
+    SteadyStateKeyHodgkinHuxley(&key, model, iExt);
+    HodgkinHuxleyResetState(model);
+    HodgkinHuxleySetExternalCurent(model, iExt);
+
+    return SteadyStateWarmStart(&key, model, SteadyStateStepHodgkinHuxley, model->stateVector,
+                                HODGKIN_HUXLEY_SYS_DIM, model->integrator.dt);
+}
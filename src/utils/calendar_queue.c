@@ -0,0 +1,247 @@
+#include <math.h>
+#include <stdlib.h>
+#include "utils/calendar_queue.h"
+
+/** @brief Initial size of the node pool. */
+#define INITIAL_CAPACITY 64
+
+/** @brief Events sampled to re-estimate the day length on a resize. */
+#define WIDTH_SAMPLES 25
+
+/**
+ * @brief Absolute day index of a time.
+ */
+static long CalendarDay(const CalendarQueue *queue, double time) {
+    return (long)floor(time / queue->width);
+}
+
+/**
+ * @brief Whether node a is popped before node b.
+ */
+static bool CalendarBefore(const CalendarNode *a, const CalendarNode *b) {
+    return a->event.time < b->event.time || (a->event.time == b->event.time && a->order < b->order);
+}
+
+/**
+ * @brief Links a node into its bucket, keeping the bucket sorted.
+ */
+static void CalendarLink(CalendarQueue *queue, int node) {
+    CalendarNode *nodes = queue->nodes;
+    int *link = &queue->bucket[CalendarDay(queue, nodes[node].event.time) & (queue->bucketCount - 1)];
+
+    while (*link >= 0 && !CalendarBefore(&nodes[node], &nodes[*link])) link = &nodes[*link].next;
+    nodes[node].next = *link;
+    *link = node;
+}
+
+/**
+ * @brief Unlinks a node from its bucket (the node itself is left as is).
+ */
+static void CalendarUnlink(CalendarQueue *queue, int node) {
+    CalendarNode *nodes = queue->nodes;
+    int *link = &queue->bucket[CalendarDay(queue, nodes[node].event.time) & (queue->bucketCount - 1)];
+
+    while (*link != node) link = &nodes[*link].next;
+    *link = nodes[node].next;
+}
+
+/**
+ * @brief Advances the scan to the bucket holding the earliest event.
+ * @return The bucket index, or -1 if the queue is empty.
+ */
+static int CalendarLocate(CalendarQueue *queue) {
+    if (queue->size == 0) return -1;
+
+    const int mask = queue->bucketCount - 1;
+    for (int k = 0; k < queue->bucketCount; k++) {
+        const int b    = (int)(queue->day & mask);
+        const int head = queue->bucket[b];
+        if (head >= 0 && CalendarDay(queue, queue->nodes[head].event.time) <= queue->day) return b;
+        queue->day++;
+    }
+
+    // A whole year without events: jump straight to the earliest one
+    int best = -1;
+    for (int b = 0; b < queue->bucketCount; b++) {
+        const int head = queue->bucket[b];
+        if (head >= 0 && (best < 0 || CalendarBefore(&queue->nodes[head], &queue->nodes[queue->bucket[best]]))) best = b;
+    }
+    queue->day = CalendarDay(queue, queue->nodes[queue->bucket[best]].event.time);
+    return best;
+}
+
+/**
+ * @brief Rebuilds the queue with a new bucket count and a re-estimated day length.
+ *
+ * The earliest events are unlinked in order to measure their mean spacing
+ * (ignoring gaps over twice the first mean, as in Brown's scheme, and
+ * ties, which would collapse the estimate); the day length becomes three
+ * times that. Every node is then relinked, keeping
+ * its sequence number, so the pop order is unchanged.
+ */
+static bool CalendarResize(CalendarQueue *queue, int bucketCount) {
+    int *bucket = (int*)malloc(bucketCount * sizeof(int));
+    if (!bucket) return false;
+
+    // 1. Unlink the earliest events into a list, in pop order
+    double times[WIDTH_SAMPLES];
+    int samples = 0;
+    int list = -1, *tail = &list;
+    while (samples < WIDTH_SAMPLES && samples < queue->size) {
+        const int b    = CalendarLocate(queue);
+        const int node = queue->bucket[b];
+        queue->bucket[b] = queue->nodes[node].next;
+        queue->size--;
+
+        times[samples++] = queue->nodes[node].event.time;
+        *tail = node;
+        tail  = &queue->nodes[node].next;
+    }
+    queue->size += samples;
+
+    // 2. Append every remaining bucket to the list
+    for (int b = 0; b < queue->bucketCount; b++) {
+        *tail = queue->bucket[b];
+        while (*tail >= 0) tail = &queue->nodes[*tail].next;
+    }
+
+    // 3. New day length from the sampled spacing
+    if (samples > 1) {
+        const double mean = (times[samples - 1] - times[0]) / (samples - 1);
+        double sum = 0.0;
+        int gaps = 0;
+        for (int k = 1; k < samples; k++) {
+            const double gap = times[k] - times[k - 1];
+            if (gap > 0.0 && gap <= 2.0 * mean) {
+                sum += gap;
+                gaps++;
+            }
+        }
+        if (gaps > 0 && sum > 0.0) queue->width = 3.0 * sum / gaps;
+    }
+
+    // 4. Relink everything into the new buckets
+    free(queue->bucket);
+    queue->bucket      = bucket;
+    queue->bucketCount = bucketCount;
+    for (int b = 0; b < bucketCount; b++) bucket[b] = -1;
+
+    while (list >= 0) {
+        const int next = queue->nodes[list].next;
+        CalendarLink(queue, list);
+        list = next;
+    }
+    if (samples > 0) queue->day = CalendarDay(queue, times[0]);
+    return true;
+}
+
+bool CalendarQueueInit(CalendarQueue *queue, double width) {
+    if (!queue || !(width > 0.0)) return false;
+
+    queue->bucket = (int*)malloc(CALENDAR_MIN_BUCKETS * sizeof(int));
+    queue->nodes  = (CalendarNode*)malloc(INITIAL_CAPACITY * sizeof(CalendarNode));
+    if (!queue->bucket || !queue->nodes) {
+        free(queue->bucket);
+        free(queue->nodes);
+        return false;
+    }
+
+    queue->bucketCount = CALENDAR_MIN_BUCKETS;
+    queue->width       = width;
+    queue->capacity    = INITIAL_CAPACITY;
+    CalendarQueueClear(queue);
+    return true;
+}
+
+int CalendarQueuePush(CalendarQueue *queue, double time, int target, int data) {
+    if (queue->freeList < 0) {
+        const int capacity = queue->capacity * 2;
+        CalendarNode *nodes = (CalendarNode*)realloc(queue->nodes, capacity * sizeof(CalendarNode));
+        if (!nodes) return -1;
+
+        for (int k = queue->capacity; k < capacity; k++) nodes[k].next = k + 1 < capacity ? k + 1 : -1;
+        queue->nodes    = nodes;
+        queue->freeList = queue->capacity;
+        queue->capacity = capacity;
+    }
+
+    const int node = queue->freeList;
+    queue->freeList = queue->nodes[node].next;
+    queue->nodes[node].event = (CalendarEvent){ time, target, data };
+    queue->nodes[node].order = queue->sequence++;
+
+    CalendarLink(queue, node);
+    queue->size++;
+
+    const long day = CalendarDay(queue, time);
+    if (day < queue->day) queue->day = day;
+
+    if (queue->size > 2 * queue->bucketCount) CalendarResize(queue, queue->bucketCount * 2);
+    return node;
+}
+
+void CalendarQueueReschedule(CalendarQueue *queue, int node, double time) {
+    CalendarUnlink(queue, node);
+    queue->nodes[node].event.time = time;
+    queue->nodes[node].order      = queue->sequence++;
+    CalendarLink(queue, node);
+
+    const long day = CalendarDay(queue, time);
+    if (day < queue->day) queue->day = day;
+}
+
+void CalendarQueueRemove(CalendarQueue *queue, int node) {
+    CalendarUnlink(queue, node);
+    queue->nodes[node].next = queue->freeList;
+    queue->freeList         = node;
+    queue->size--;
+
+    if (queue->bucketCount > CALENDAR_MIN_BUCKETS && queue->size < queue->bucketCount / 2) {
+        CalendarResize(queue, queue->bucketCount / 2);
+    }
+}
+
+bool CalendarQueuePeek(CalendarQueue *queue, CalendarEvent *event) {
+    const int b = CalendarLocate(queue);
+    if (b < 0) return false;
+
+    *event = queue->nodes[queue->bucket[b]].event;
+    return true;
+}
+
+bool CalendarQueuePop(CalendarQueue *queue, CalendarEvent *event) {
+    const int b = CalendarLocate(queue);
+    if (b < 0) return false;
+
+    const int node = queue->bucket[b];
+    if (event) *event = queue->nodes[node].event;
+
+    queue->bucket[b]        = queue->nodes[node].next;
+    queue->nodes[node].next = queue->freeList;
+    queue->freeList         = node;
+    queue->size--;
+
+    if (queue->bucketCount > CALENDAR_MIN_BUCKETS && queue->size < queue->bucketCount / 2) {
+        CalendarResize(queue, queue->bucketCount / 2);
+    }
+    return true;
+}
+
+void CalendarQueueClear(CalendarQueue *queue) {
+    for (int b = 0; b < queue->bucketCount; b++) queue->bucket[b] = -1;
+    for (int k = 0; k < queue->capacity; k++) queue->nodes[k].next = k + 1 < queue->capacity ? k + 1 : -1;
+
+    queue->freeList = 0;
+    queue->size     = 0;
+    queue->day      = 0;
+    queue->sequence = 0;
+}
+
+void CalendarQueueFree(CalendarQueue *queue) {
+    if (!queue) return;
+    free(queue->bucket);
+    free(queue->nodes);
+    queue->bucket = NULL;
+    queue->nodes  = NULL;
+    queue->size   = 0;
+}
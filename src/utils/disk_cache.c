@@ -0,0 +1,106 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "utils/hash.h"
+#include "utils/disk_cache.h"
+
+/** @brief Magic number at the start of every cache entry ("NLDC"). */
+#define ENTRY_MAGIC 0x43444c4eu
+
+/** @brief Maximum length of an entry path. */
+#define MAX_PATH_LEN 512
+
+/**
+ * @struct DiskCacheEntryHeader
+ * @brief Header written before the key and value bytes of each entry.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t reserved;
+    uint64_t keySize;
+    uint64_t valueSize;
+} DiskCacheEntryHeader;
+
+/**
+ * @brief Builds the entry path for a key and creates its directory if needed.
+ * @return true if the path fits in the buffer and the directory exists.
+ */
+static bool DiskCacheEntryPath(char *path, size_t size, const char *dir, const void *key, size_t keySize, bool create) {
+    char dirPath[MAX_PATH_LEN];
+    if (snprintf(dirPath, sizeof(dirPath), "%s/%s", DISK_CACHE_ROOT, dir) >= (int)sizeof(dirPath)) return false;
+
+    if (create) {
+        if (mkdir(DISK_CACHE_ROOT, 0755) != 0 && errno != EEXIST) return false;
+        if (mkdir(dirPath, 0755) != 0 && errno != EEXIST) return false;
+    }
+
+    uint64_t hash = HashBytes(key, keySize, HASH_SEED);
+    return snprintf(path, size, "%s/%016llx.bin", dirPath, (unsigned long long)hash) < (int)size;
+}
+
+bool DiskCacheStore(const char *dir, const void *key, size_t keySize, const void *value, size_t valueSize) {
+    char path[MAX_PATH_LEN];
+    char tmpPath[MAX_PATH_LEN + 8];
+    if (!DiskCacheEntryPath(path, sizeof(path), dir, key, keySize, true)) return false;
+
+    // Unique temporary name: concurrent writers of the same key never share a file
+    snprintf(tmpPath, sizeof(tmpPath), "%s.XXXXXX", path);
+    int fd = mkstemp(tmpPath);
+    if (fd < 0) return false;
+
+    FILE *file = fdopen(fd, "wb");
+    if (!file) {
+        close(fd);
+        remove(tmpPath);
+        return false;
+    }
+
+    DiskCacheEntryHeader header = { ENTRY_MAGIC, 0, keySize, valueSize };
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1
+           && fwrite(key, keySize, 1, file) == 1
+           && (valueSize == 0 || fwrite(value, valueSize, 1, file) == 1);
+
+    if (fclose(file) != 0) ok = false;
+    if (!ok || rename(tmpPath, path) != 0) {
+        remove(tmpPath);
+        return false;
+    }
+
+    return true;
+}
+
+long DiskCacheLoad(const char *dir, const void *key, size_t keySize, void *value, size_t capacity) {
+    char path[MAX_PATH_LEN];
+    if (!DiskCacheEntryPath(path, sizeof(path), dir, key, keySize, false)) return -1;
+
+    FILE *file = fopen(path, "rb");
+    if (!file) return -1;
+
+    long result = -1;
+    DiskCacheEntryHeader header;
+    void *storedKey = NULL;
+
+    if (fread(&header, sizeof(header), 1, file) == 1
+        && header.magic == ENTRY_MAGIC
+        && header.keySize == keySize
+        && header.valueSize <= capacity)
+    {
+        storedKey = malloc(keySize);
+        if (storedKey
+            && fread(storedKey, keySize, 1, file) == 1
+            && memcmp(storedKey, key, keySize) == 0
+            && (header.valueSize == 0 || fread(value, (size_t)header.valueSize, 1, file) == 1))
+        {
+            result = (long)header.valueSize;
+        }
+    }
+
+    free(storedKey);
+    fclose(file);
+    return result;
+}
@@ -0,0 +1,56 @@
+#include <math.h>
+#include "utils/fft.h"
+
+/** @brief 2*pi in double precision. */
+#define TWO_PI 6.283185307179586
+
+bool FftIsPowerOfTwo(int n) {
+    return n > 0 && (n & (n - 1)) == 0;
+}
+
+bool FftRadix2(float *re, float *im, int n) {
+    if (!FftIsPowerOfTwo(n)) return false;
+
+    // 1. Bit-reversal permutation
+    for (int i = 1, j = 0; i < n; i++) {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+
+        if (i < j) {
+            float tr = re[i]; re[i] = re[j]; re[j] = tr;
+            float ti = im[i]; im[i] = im[j]; im[j] = ti;
+        }
+    }
+
+    // 2. Butterflies; twiddles advanced by recurrence in double precision
+    for (int len = 2; len <= n; len <<= 1) {
+        const double angle = -TWO_PI / len;
+        const double wStepRe = cos(angle);
+        const double wStepIm = sin(angle);
+        const int half = len >> 1;
+
+        for (int start = 0; start < n; start += len) {
+            double wRe = 1.0, wIm = 0.0;
+
+            for (int k = 0; k < half; k++) {
+                const int a = start + k;
+                const int b = a + half;
+
+                const float tRe = (float)(re[b] * wRe - im[b] * wIm);
+                const float tIm = (float)(re[b] * wIm + im[b] * wRe);
+
+                re[b] = re[a] - tRe;
+                im[b] = im[a] - tIm;
+                re[a] += tRe;
+                im[a] += tIm;
+
+                const double next = wRe * wStepRe - wIm * wStepIm;
+                wIm = wRe * wStepIm + wIm * wStepRe;
+                wRe = next;
+            }
+        }
+    }
+
+    return true;
+}
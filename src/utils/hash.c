@@ -0,0 +1,16 @@
+#include "utils/hash.h"
+
+/** @brief FNV-1a 64-bit prime. */
+#define FNV_PRIME 0x100000001b3ULL
+
+uint64_t HashBytes(const void *data, size_t size, uint64_t seed) {
+    const unsigned char *p = (const unsigned char*)data;
+    uint64_t hash = seed;
+
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (uint64_t)p[i];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
@@ -0,0 +1,22 @@
+#define _POSIX_C_SOURCE 200809L
+#ifdef __linux__
+#define _DEFAULT_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "utils/memory.h"
+
+void *MemoryAllocate(size_t bytes, bool hugePages) {
+    if (bytes == 0) bytes = 1;
+    if (!hugePages || bytes < MEMORY_HUGE_PAGE) return malloc(bytes);
+
+    // Whole huge pages, so the tail of the array does not share one with other data
+    const size_t rounded = (bytes + MEMORY_HUGE_PAGE - 1) / MEMORY_HUGE_PAGE * MEMORY_HUGE_PAGE;
+    void *memory = NULL;
+    if (posix_memalign(&memory, MEMORY_HUGE_PAGE, rounded) != 0) return NULL;
+#ifdef MADV_HUGEPAGE
+    madvise(memory, rounded, MADV_HUGEPAGE);
+#endif
+    return memory;
+}
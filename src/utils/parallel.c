@@ -0,0 +1,321 @@
+#ifdef __linux__
+#define _GNU_SOURCE
+#else
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "utils/parallel.h"
+
+/**
+ * @struct ParallelJob
+ * @brief State shared by the workers of one loop.
+ *
+ * The iterations are split into ranges; thread t starts on range
+ * t % ranges and, if 'steal' is set, moves on to the next ranges once its
+ * own is exhausted. A plain loop is a single range.
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    int next[PARALLEL_MAX_THREADS]; ///< Next iteration to hand out, per range
+    int end[PARALLEL_MAX_THREADS];  ///< End of each range
+    int ranges;
+    bool steal;
+    ParallelBody body;
+    void *userData;
+} ParallelJob;
+
+/**
+ * @struct ParallelThread
+ * @brief Start argument of a pool worker: the pool and the worker's thread index.
+ */
+typedef struct {
+    struct ParallelPool *pool;
+    int index;
+} ParallelThread;
+
+/**
+ * @brief Claims the next iteration of a job for thread 'thread'.
+ * @return The claimed index, or -1 when the job is exhausted.
+ */
+static int ParallelClaim(ParallelJob *job, int thread) {
+    pthread_mutex_lock(&job->lock);
+    int index = -1;
+    for (int k = 0; k < job->ranges && index < 0; k++) {
+        const int range = (thread + k) % job->ranges;
+        if (job->next[range] < job->end[range]) index = job->next[range]++;
+        if (!job->steal) break;
+    }
+    pthread_mutex_unlock(&job->lock);
+    return index;
+}
+
+/**
+ * @brief Runs iterations of a job until it is exhausted (for this thread).
+ */
+static void ParallelDrain(ParallelJob *job, int thread) {
+    for (int index = ParallelClaim(job, thread); index >= 0; index = ParallelClaim(job, thread)) {
+        job->body(index, job->userData);
+    }
+}
+
+/**
+ * @brief ParallelFor worker.
+ */
+static void *ParallelWorker(void *arg) {
+    ParallelDrain((ParallelJob*)arg, 0);
+    return NULL;
+}
+
+int ParallelWorkerCount(void) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online < 1) return 1;
+    if (online > PARALLEL_MAX_THREADS) return PARALLEL_MAX_THREADS;
+    return (int)online;
+}
+
+bool ParallelFor(int count, ParallelBody body, void *userData) {
+    if (count <= 0 || !body) return false;
+
+    ParallelJob job = { .ranges = 1, .steal = true, .body = body, .userData = userData };
+    job.end[0] = count;
+
+    int workers = ParallelWorkerCount();
+    if (workers > count) workers = count;
+
+    if (workers <= 1 || pthread_mutex_init(&job.lock, NULL) != 0) {
+        for (int i = 0; i < count; i++) body(i, userData);
+        return false;
+    }
+
+    // The calling thread works too, so only 'workers - 1' threads are spawned
+    pthread_t threads[PARALLEL_MAX_THREADS];
+    int spawned = 0;
+    for (int t = 0; t < workers - 1; t++) {
+        if (pthread_create(&threads[spawned], NULL, ParallelWorker, &job) != 0) break;
+        spawned++;
+    }
+
+    ParallelDrain(&job, 0);
+
+    for (int t = 0; t < spawned; t++) pthread_join(threads[t], NULL);
+    pthread_mutex_destroy(&job.lock);
+
+    return spawned > 0;
+}
+
+/**
+ * @struct ParallelPool
+ * @brief Worker threads plus the job they are currently running.
+ *
+ * Each ParallelPoolRun publishes a job and bumps 'generation'; parked
+ * workers wake up, drain the job and report back through 'active'.
+ */
+struct ParallelPool {
+    pthread_mutex_t lock;
+    pthread_cond_t wake;       ///< Signalled when a job is published or on shutdown
+    pthread_cond_t done;       ///< Signalled when the last worker leaves a job
+    pthread_t threads[PARALLEL_MAX_THREADS];
+    ParallelThread slots[PARALLEL_MAX_THREADS]; ///< Start arguments (worker t has thread index t + 1)
+    int spawned;               ///< Number of worker threads (the caller is not counted)
+    unsigned generation;       ///< Incremented once per published job
+    int active;                ///< Workers still inside the current job
+    bool shutdown;
+    ParallelJob job;
+#ifdef __linux__
+    bool callerPinned;         ///< ParallelPoolPin changed the caller's affinity (restored on destroy)
+    pthread_t caller;          ///< Thread 0 when the pool was pinned
+    cpu_set_t callerMask;      ///< Its affinity before the pin
+#endif
+};
+
+/**
+ * @brief Pool worker: waits for a new generation, drains the job, repeats.
+ */
+static void *ParallelPoolWorker(void *arg) {
+    const ParallelThread *slot = (const ParallelThread*)arg;
+    ParallelPool *pool = slot->pool;
+    unsigned seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutdown && pool->generation == seen) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        if (pool->shutdown) break;
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        ParallelDrain(&pool->job, slot->index);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->active == 0) pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+ParallelPool *ParallelPoolCreate(int threads) {
+    if (threads <= 0) threads = ParallelWorkerCount();
+    if (threads > PARALLEL_MAX_THREADS) threads = PARALLEL_MAX_THREADS;
+
+    ParallelPool *pool = (ParallelPool*)calloc(1, sizeof(ParallelPool));
+    if (!pool) return NULL;
+
+    if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+        free(pool);
+        return NULL;
+    }
+    if (pthread_mutex_init(&pool->job.lock, NULL) != 0) {
+        pthread_mutex_destroy(&pool->lock);
+        free(pool);
+        return NULL;
+    }
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for (int t = 0; t < threads - 1; t++) {
+        pool->slots[t] = (ParallelThread){ pool, t + 1 };
+        if (pthread_create(&pool->threads[pool->spawned], NULL, ParallelPoolWorker, &pool->slots[t]) != 0) break;
+        pool->spawned++;
+    }
+
+    return pool;
+}
+
+int ParallelPoolSize(const ParallelPool *pool) {
+    return pool ? pool->spawned + 1 : 1;
+}
+
+/**
+ * @brief Publishes a job prepared in pool->job, drains it as thread 0 and
+ * waits for the workers.
+ */
+static void ParallelPoolExecute(ParallelPool *pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->active = pool->spawned;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    ParallelDrain(&pool->job, 0);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->active > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void ParallelPoolRun(ParallelPool *pool, int count, ParallelBody body, void *userData) {
+    const int first[2] = { 0, count };
+    ParallelPoolRunRanges(pool, first, 1, body, userData);
+}
+
+void ParallelPoolRunRanges(ParallelPool *pool, const int *first, int ranges, ParallelBody body, void *userData) {
+    const int last = first[ranges];
+    if (last <= first[0] || !body) return;
+
+    if (!pool || pool->spawned == 0 || last - first[0] == 1) {
+        for (int i = first[0]; i < last; i++) body(i, userData);
+        return;
+    }
+
+    // Workers are parked between runs: the job can be written before it is published
+    if (ranges > PARALLEL_MAX_THREADS) ranges = PARALLEL_MAX_THREADS;
+    for (int r = 0; r < ranges; r++) {
+        pool->job.next[r] = first[r];
+        pool->job.end[r]  = first[r + 1];
+    }
+    pool->job.end[ranges - 1] = last;
+    pool->job.ranges   = ranges;
+    pool->job.steal    = true;
+    pool->job.body     = body;
+    pool->job.userData = userData;
+    ParallelPoolExecute(pool);
+}
+
+void ParallelPoolRunEach(ParallelPool *pool, ParallelBody body, void *userData) {
+    if (!body) return;
+
+    if (!pool || pool->spawned == 0) {
+        body(0, userData);
+        return;
+    }
+
+    const int size = pool->spawned + 1;
+    for (int t = 0; t < size; t++) {
+        pool->job.next[t] = t;
+        pool->job.end[t]  = t + 1;
+    }
+    pool->job.ranges   = size;
+    pool->job.steal    = false;
+    pool->job.body     = body;
+    pool->job.userData = userData;
+    ParallelPoolExecute(pool);
+}
+
+bool ParallelPoolPin(ParallelPool *pool, int firstCpu) {
+#ifdef __linux__
+    if (!pool || firstCpu < 0) return false;
+
+    // The caller's own mask is saved once: a second pin must not read the single CPU of the first
+    if (!pool->callerPinned) {
+        pool->caller = pthread_self();
+        if (pthread_getaffinity_np(pool->caller, sizeof(pool->callerMask), &pool->callerMask) != 0) return false;
+    } else if (!pthread_equal(pool->caller, pthread_self())) {
+        return false;
+    }
+
+    // CPUs the caller may run on, in ascending order (not capped at PARALLEL_MAX_THREADS)
+    int allowed[CPU_SETSIZE];
+    int cpus = 0;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &pool->callerMask)) allowed[cpus++] = cpu;
+    }
+    if (cpus == 0) return false;
+
+    bool ok = true;
+    for (int t = 0; t <= pool->spawned; t++) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(allowed[(firstCpu + t) % cpus], &set);
+        const pthread_t thread = t == 0 ? pool->caller : pool->threads[t - 1];
+        if (pthread_setaffinity_np(thread, sizeof(set), &set) != 0) {
+            ok = false;
+        } else if (t == 0) {
+            pool->callerPinned = true;
+        }
+    }
+    return ok;
+#else
+    (void)pool;
+    (void)firstCpu;
+    return false;
+#endif
+}
+
+void ParallelPoolDestroy(ParallelPool *pool) {
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int t = 0; t < pool->spawned; t++) pthread_join(pool->threads[t], NULL);
+
+#ifdef __linux__
+    // Thread 0 is the caller's own thread: give it back the affinity it had before the pin
+    if (pool->callerPinned && pthread_equal(pool->caller, pthread_self())) {
+        pthread_setaffinity_np(pool->caller, sizeof(pool->callerMask), &pool->callerMask);
+    }
+#endif
+
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->done);
+    pthread_mutex_destroy(&pool->job.lock);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}